@@ -0,0 +1,212 @@
+# Jenova Runtime Benchmark Runner Script
+# Developed by Hamid.Memar (2024-2025)
+# Usage : python3 ./Jenova.Benchmark.py --godot ./Godot_v4.3-stable_linux.x86_64 --scripts 10,100,1000
+# Requires a Benchmark Build : python3 ./Jenova.Builder.py --compiler linux-gcc --benchmark
+# Use python3 ./Jenova.Benchmark.py --help For More Information.
+
+# Imports
+import os
+import sys
+import json
+import time
+import shutil
+import argparse
+import platform
+import subprocess
+from colored import fg, attr
+
+# Set Encoding
+sys.stdout.reconfigure(encoding='utf-8')
+sys.stderr.reconfigure(encoding='utf-8')
+
+# Shared Database
+property_groups = [0, 8, 32]
+runtime_files = {
+    "Linux": ("Linux64/Benchmark", "Jenova.Runtime.Linux64.so"),
+    "Windows": ("Win64/Benchmark", "Jenova.Runtime.Win64.dll")
+}
+tracked_metrics = [
+    "Build.FullBuildTime",
+    "Build.IncrementalBuildTime",
+    "Build.SpeculativeBuildTime",
+    "DatabaseDeploy.MedianTime",
+    "CallFunction.AsmJIT.void.MedianTime",
+    "CallFunction.AsmJIT.variant_x8.MedianTime",
+    "CallFunction.TinyCC.void.MedianTime",
+    "CallFunction.TinyCC.variant_x8.MedianTime",
+    "MetadataLookup.GetFunctionAddress.MedianTime",
+    "MetadataLookup.GetPropertyAddress.MedianTime",
+    "GlobalStore.HandleRead.MedianTime",
+    "GlobalStore.ContendedRead_x8.MedianTime",
+    "Allocators.FrameArena.MedianTime",
+    "Allocators.ObjectPool.MedianTime",
+    "SceneIndex.IndexedFindByName.MedianTime",
+    "SceneIndex.IndexedNodeByUniqueID.MedianTime",
+    "Clektron.CachedExecute.MedianTime",
+    "Clektron.ContextExecute.MedianTime",
+    "Compression.LZ4-1.Decompress.MedianTime",
+    "Compression.Zstd-19.Decompress.MedianTime"
+]
+
+# Global Functions
+def rgb_print(hex_color, output):
+    hex_color = hex_color.lstrip('#')
+    rgb = tuple(int(hex_color[i:i+2], 16) for i in (0, 2, 4))
+    ansi_color = 16 + (36 * (rgb[0] // 51) + 6 * (rgb[1] // 51) + (rgb[2] // 51))
+    print(f"{fg(ansi_color)}{output}{attr('reset')}")
+def generate_script_source(scriptIndex, propertyCount):
+    properties = "\n".join([f"JENOVA_PROPERTY(int, BenchProperty{p}, {p})" for p in range(propertyCount)])
+    return f"""/* Jenova Benchmark Script {scriptIndex:04d} [Generated] */
+
+// Godot SDK
+#include <Godot/godot.hpp>
+
+// Jenova SDK
+#include <JenovaSDK.h>
+
+// Namespaces
+using namespace godot;
+using namespace jenova::sdk;
+
+// Jenova Script Block Start
+JENOVA_SCRIPT_BEGIN
+
+// Properties
+{properties}
+
+// Benchmark Methods [Layout Must Match Source/benchmark_suite.cpp]
+void BenchVoid() {{}}
+void BenchCaller(Caller* instance) {{}}
+void BenchVariant1(Variant a) {{}}
+void BenchVariant4(Variant a, Variant b, Variant c, Variant d) {{}}
+void BenchVariant8(Variant a, Variant b, Variant c, Variant d, Variant e, Variant f, Variant g, Variant h) {{}}
+Variant BenchReturn(Variant a) {{ return a; }}
+
+// Compile Workload
+int BenchWorkload(int seed)
+{{
+    int accumulator = seed + {scriptIndex};
+    for (int i = 0; i < 64; i++) accumulator = (accumulator * 31) ^ (i + {scriptIndex});
+    return accumulator;
+}}
+
+// Jenova Script Block End
+JENOVA_SCRIPT_END
+"""
+def generate_project(projectDir, scriptCount, runtimeDir, runtimeName):
+    # Create Clean Project
+    if os.path.exists(projectDir): shutil.rmtree(projectDir)
+    os.makedirs(f"{projectDir}/Scripts", exist_ok=True)
+    os.makedirs(f"{projectDir}/Jenova/JenovaSDK", exist_ok=True)
+    os.makedirs(f"{projectDir}/.godot", exist_ok=True)
+
+    # Project Configuration
+    with open(f"{projectDir}/project.godot", "w") as projectFile:
+        projectFile.write(f'config_version=5\n\n[application]\n\nconfig/name="Jenova Benchmark {scriptCount}"\n')
+
+    # Install Benchmark Runtime [Register Extension Without Import Pass]
+    shutil.copy2(f"{runtimeDir}/{runtimeName}", f"{projectDir}/Jenova/{runtimeName}")
+    shutil.copy2(f"{runtimeDir}/Jenova.Runtime.gdextension", f"{projectDir}/Jenova/Jenova.Runtime.gdextension")
+    shutil.copy2("./Source/JenovaSDK.h", f"{projectDir}/Jenova/JenovaSDK/JenovaSDK.h")
+    with open(f"{projectDir}/.godot/extension_list.cfg", "w") as extensionList:
+        extensionList.write("res://Jenova/Jenova.Runtime.gdextension\n")
+
+    # Generate Scripts [Property Groups Rotate Per Script]
+    for scriptIndex in range(scriptCount):
+        propertyCount = property_groups[scriptIndex % len(property_groups)]
+        with open(f"{projectDir}/Scripts/BenchScript_{scriptIndex:04d}.cpp", "w") as scriptFile:
+            scriptFile.write(generate_script_source(scriptIndex, propertyCount))
+def run_benchmark(godotBinary, projectDir, resultFile, timeout):
+    # Import Pass
+    subprocess.run([godotBinary, "--headless", "--editor", "--import", "--path", projectDir],
+        stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, timeout=timeout)
+
+    # Benchmark Pass
+    if os.path.exists(resultFile): os.remove(resultFile)
+    command = [godotBinary, "--headless", "--editor", "--path", projectDir, "--Run-Jenova-Benchmark", f"--Jenova-Benchmark-Output={resultFile}"]
+    process = subprocess.run(command, capture_output=True, text=True, timeout=timeout)
+    if not os.path.exists(resultFile):
+        rgb_print("#e02626", f"[ x ] Benchmark Produced No Results (Exit Code {process.returncode}) :\n{process.stdout[-4000:]}{process.stderr[-4000:]}")
+        return None
+    with open(resultFile, "r") as result: return json.load(result)
+def get_metric(results, metricPath):
+    value = results
+    for key in metricPath.split("."):
+        if not isinstance(value, dict) or key not in value: return None
+        value = value[key]
+    return value if isinstance(value, (int, float)) else None
+def compare_with_baseline(report, baseline, threshold):
+    regressions = 0
+    for scriptCount, results in report["Runs"].items():
+        baselineResults = baseline.get("Runs", {}).get(scriptCount)
+        if not baselineResults: continue
+        for metricPath in tracked_metrics:
+            current, previous = get_metric(results, metricPath), get_metric(baselineResults, metricPath)
+            if current is None or previous is None or previous <= 0: continue
+            change = (current - previous) / previous * 100.0
+            if change > threshold:
+                regressions += 1
+                rgb_print("#e02626", f"[ x ] Regression [{scriptCount} Scripts] {metricPath} : {previous:.3f} -> {current:.3f} (+{change:.1f}%)")
+            elif change < -threshold:
+                rgb_print("#03fc6f", f"[ √ ] Improvement [{scriptCount} Scripts] {metricPath} : {previous:.3f} -> {current:.3f} ({change:.1f}%)")
+    return regressions
+
+# Entrypoint
+if __name__ == "__main__":
+    # Disable PyCache
+    sys.dont_write_bytecode = True
+    os.environ['PYTHONDONTWRITEBYTECODE'] = "1"
+
+    # Create Arguments Parser
+    parser = argparse.ArgumentParser(description="Jenova Runtime Benchmark Runner Developed by Hamid.Memar")
+    parser.add_argument('--godot', type=str, required=True, help='Path to Godot Editor Binary')
+    parser.add_argument('--scripts', default="10,100,1000", help='Generated Script Counts (default: 10,100,1000)')
+    parser.add_argument('--work-dir', default="Benchmark", help='Directory for Generated Projects and Results (default: Benchmark)')
+    parser.add_argument('--output', type=str, help='Merged Result File (default: <work-dir>/Jenova.Benchmark.<timestamp>.json)')
+    parser.add_argument('--baseline', type=str, help='Previous Result File to Compare Against')
+    parser.add_argument('--threshold', type=float, default=10.0, help='Regression Threshold in Percent (default: 10)')
+    parser.add_argument('--timeout', type=int, default=3600, help='Timeout Per Run in Seconds (default: 3600)')
+    args = parser.parse_args()
+
+    # Validate Runtime
+    if platform.system() not in runtime_files:
+        rgb_print("#e02626", f"[ x ] Error : Unsupported Platform {platform.system()}.")
+        exit(-1)
+    runtimeDir, runtimeName = runtime_files[platform.system()]
+    if not os.path.exists(f"{runtimeDir}/{runtimeName}"):
+        rgb_print("#e02626", f"[ x ] Error : Benchmark Runtime Not Found, Build It Using Jenova.Builder.py --benchmark.")
+        exit(-1)
+
+    # Query Godot Version
+    godotVersion = subprocess.run([args.godot, "--version"], capture_output=True, text=True).stdout.strip()
+
+    # Run Benchmarks
+    report = {
+        "Timestamp": time.strftime("%Y-%m-%dT%H:%M:%S"),
+        "Machine": { "System": platform.platform(), "Processor": platform.processor(), "CPUCount": os.cpu_count() },
+        "Godot": godotVersion,
+        "Runs": {}
+    }
+    failed = False
+    for scriptCount in [int(count) for count in args.scripts.split(",")]:
+        rgb_print("#367fff", f"[ ^ ] Running Benchmark With {scriptCount} Generated Scripts...")
+        projectDir = os.path.abspath(f"{args.work_dir}/Projects/Scripts{scriptCount}")
+        generate_project(projectDir, scriptCount, runtimeDir, runtimeName)
+        startTime = time.time()
+        results = run_benchmark(args.godot, projectDir, os.path.abspath(f"{args.work_dir}/Scripts{scriptCount}.json"), args.timeout)
+        if results is None or not results.get("Succeeded", False): failed = True
+        if results is not None: report["Runs"][str(scriptCount)] = results
+        rgb_print("#367fff", f"[ ^ ] Benchmark With {scriptCount} Scripts Finished in {time.time() - startTime:.1f}s.")
+
+    # Write Merged Results
+    outputFile = args.output or f"{args.work_dir}/Jenova.Benchmark.{time.strftime('%Y%m%d-%H%M%S')}.json"
+    with open(outputFile, "w") as output: json.dump(report, output, indent=2)
+    rgb_print("#03fc6f", f"[ √ ] Benchmark Results Written to {outputFile}")
+
+    # Compare With Baseline
+    if args.baseline:
+        with open(args.baseline, "r") as baselineFile: baseline = json.load(baselineFile)
+        if compare_with_baseline(report, baseline, args.threshold) > 0: failed = True
+
+    # Exit Code Reflects Failures/Regressions
+    exit(1 if failed else 0)
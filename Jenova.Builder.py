@@ -9,6 +9,7 @@ import sys
 import json
 import time
 import shutil
+import tarfile
 import hashlib
 import requests
 import argparse
@@ -53,20 +54,33 @@ sources = [
     "Source/script_compiler.cpp",
     "Source/script_manager.cpp",
     "Source/clektron.cpp",
+    "Source/log_system.cpp",
     "Source/tiny_profiler.cpp",
+    "Source/sampling_profiler.cpp",
+    "Source/memory_tracker.cpp",
+    "Source/global_store.cpp",
+    "Source/arena_allocator.cpp",
+    "Source/scene_index.cpp",
+    "Source/build_service.cpp",
     "Source/task_system.cpp",
     "Source/package_manager.cpp",
     "Source/asset_monitor.cpp",
     "Source/gdextension_exporter.cpp"
 ]
+benchmark_sources = [
+    "Source/benchmark_suite.cpp"
+]
 
 # Global Options
 deps_version        = "4.3"
+zstd_version        = "1.5.6"
+lz4_version         = "1.10.0"
 skip_deps           = False
 skip_cache          = False
 skip_packaging      = False
 deploy_mode         = False
 lithium_edition     = False
+benchmark_build     = False
 
 # Global Functions
 def rgb_print(hex_color, output, inplace = False):
@@ -242,6 +256,33 @@ def install_dependencies():
 
     # Delete Downloaded Package
     os.remove("Jenova-Runtime-Dependencies-Universal.jnvpkg")
+def install_compression_dependencies():
+
+    # Zstd And LZ4 Are Not Part of Dependencies Package 4.3, Fetch Their Source Releases Directly
+    compression_sources = [
+        ("Zstd", "./Dependencies/libzstd", f"https://github.com/facebook/zstd/releases/download/v{zstd_version}/zstd-{zstd_version}.tar.gz", f"zstd-{zstd_version}"),
+        ("LZ4", "./Dependencies/liblz4", f"https://github.com/lz4/lz4/releases/download/v{lz4_version}/lz4-{lz4_version}.tar.gz", f"lz4-{lz4_version}")
+    ]
+    for source_name, source_dir, source_url, source_root in compression_sources:
+
+        # Validate Source
+        if os.path.exists(source_dir): continue
+
+        # Downloading Source Release
+        rgb_print("#367fff", f"[ ^ ] Downloading {source_name} Source Release...")
+        response = requests.get(source_url, stream=True)
+        if response.status_code != 200:
+            rgb_print("#e02626", f"[ x ] Error : Failed to Download {source_name} Source Release.")
+            exit(1)
+        source_archive = f"{source_root}.tar.gz"
+        with open(source_archive, "wb") as f:
+            for data in response.iter_content(1024 * 64): f.write(data)
+
+        # Extracting Source Release
+        with tarfile.open(source_archive, "r:gz") as archive: archive.extractall(path="./Dependencies")
+        os.rename("./Dependencies/" + source_root, source_dir)
+        os.remove(source_archive)
+        rgb_print("#38f227", f"[ √ ] {source_name} Source Release Installed.")
 def build_with_ninja(buildPath):
     if platform.system() == "Windows": subprocess.run(["ninja.exe", "-C", buildPath, "-j", f"{os.cpu_count()}"], check=True)
     if platform.system() == "Linux": subprocess.run(["ninja", "-C", buildPath, "-j", f"{os.cpu_count()}"], check=True)
@@ -292,6 +333,7 @@ def build_dependencies_linux(buildMode, cacheDir):
     
     # Install Dependencies
     install_dependencies()
+    install_compression_dependencies()
 
     # Create Library
     os.makedirs("Libs", exist_ok=True)
@@ -430,6 +472,49 @@ def build_dependencies_linux(buildMode, cacheDir):
         shutil.copyfile(buildPath + "/libz.a", "./Libs/libzlib-static-x86_64.a")
         rgb_print("#38f227", "[ √ ] Jenova Runtime Dependency 'ZLIB' Compiled Successfully.")
 
+    # Build Zstd
+    if not os.path.exists("./Libs/libzstd-static-x86_64.a"):
+        buildPath = cacheDir + "/Dependencies/zstd"
+        if os.path.exists(buildPath): shutil.rmtree(buildPath)
+        subprocess.run([
+            "cmake",
+            "-S", "./Dependencies/libzstd/build/cmake",
+            "-B", buildPath,
+            "-G", "Ninja",
+            "-DCMAKE_BUILD_TYPE=MinSizeRel",
+            "-DBUILD_SHARED_LIBS=OFF",
+            "-DZSTD_BUILD_STATIC=ON",
+            "-DZSTD_BUILD_SHARED=OFF",
+            "-DZSTD_BUILD_PROGRAMS=OFF",
+            "-DZSTD_BUILD_TESTS=OFF",
+            "-DZSTD_MULTITHREAD_SUPPORT=ON"
+        ], check=True)
+        build_with_ninja(buildPath)
+        shutil.copyfile(buildPath + "/lib/libzstd.a", "./Libs/libzstd-static-x86_64.a")
+        os.makedirs("./Libs/Zstd", exist_ok=True)
+        for header in ["zstd.h", "zstd_errors.h", "zdict.h"]: shutil.copyfile("./Dependencies/libzstd/lib/" + header, "./Libs/Zstd/" + header)
+        rgb_print("#38f227", "[ √ ] Jenova Runtime Dependency 'Zstd' Compiled Successfully.")
+
+    # Build LZ4
+    if not os.path.exists("./Libs/liblz4-static-x86_64.a"):
+        buildPath = cacheDir + "/Dependencies/lz4"
+        if os.path.exists(buildPath): shutil.rmtree(buildPath)
+        subprocess.run([
+            "cmake",
+            "-S", "./Dependencies/liblz4/build/cmake",
+            "-B", buildPath,
+            "-G", "Ninja",
+            "-DCMAKE_BUILD_TYPE=MinSizeRel",
+            "-DBUILD_SHARED_LIBS=OFF",
+            "-DBUILD_STATIC_LIBS=ON",
+            "-DLZ4_BUILD_CLI=OFF"
+        ], check=True)
+        build_with_ninja(buildPath)
+        shutil.copyfile(buildPath + "/liblz4.a", "./Libs/liblz4-static-x86_64.a")
+        os.makedirs("./Libs/LZ4", exist_ok=True)
+        for header in ["lz4.h", "lz4hc.h"]: shutil.copyfile("./Dependencies/liblz4/lib/" + header, "./Libs/LZ4/" + header)
+        rgb_print("#38f227", "[ √ ] Jenova Runtime Dependency 'LZ4' Compiled Successfully.")
+
     # Build TinyCC
     if not os.path.exists("./Libs/libtcc-static-x86_64.a"):
         buildPath = cacheDir + "/Dependencies/tinycc"
@@ -479,6 +564,8 @@ def build_linux(compilerBinary, linkerBinary, buildMode, buildSystem):
     if platform.system() == "Linux" and "fedora" in platform.freedesktop_os_release().get("ID", "").lower():
         libs = [
             "Libs/libzlib-static-x86_64.a",
+            "Libs/libzstd-static-x86_64.a",
+            "Libs/liblz4-static-x86_64.a",
             "Libs/libtcc-static-x86_64.a",
             "Libs/libgodotcpp-static-x86_64.a",
             "-lcurl",
@@ -494,6 +581,8 @@ def build_linux(compilerBinary, linkerBinary, buildMode, buildSystem):
     else:
         libs = [
             "Libs/libzlib-static-x86_64.a",
+            "Libs/libzstd-static-x86_64.a",
+            "Libs/liblz4-static-x86_64.a",
             "Libs/libtcc-static-x86_64.a",
             "Libs/libgodotcpp-static-x86_64.a",
             "Libs/libcurl-static-x86_64.a",
@@ -506,7 +595,7 @@ def build_linux(compilerBinary, linkerBinary, buildMode, buildSystem):
     # Configuration
     compiler = compilerBinary
     linker = linkerBinary
-    outputDir = "Linux64"
+    outputDir = "Linux64/Benchmark" if benchmark_build else "Linux64"
     outputName = "Jenova.Runtime.Linux64.so"
     mapFileName = "Jenova.Runtime.Linux64.map"
     cacheDir = f"{outputDir}/Cache"
@@ -673,6 +762,7 @@ def build_dependencies_windows(buildMode, cacheDir):
 
     # Install Dependencies
     install_dependencies()
+    install_compression_dependencies()
 
     # Create Library
     os.makedirs("Libs", exist_ok=True)
@@ -827,6 +917,51 @@ def build_dependencies_windows(buildMode, cacheDir):
             shutil.copyfile(buildPath + "/zs.lib", "./Libs/libzlib-static-x86_64.lib")
             rgb_print("#38f227", "[ √ ] Jenova Runtime Dependency 'ZLIB' Compiled Successfully.")
 
+        # Build Zstd
+        if not os.path.exists("./Libs/libzstd-static-x86_64.lib"):
+            buildPath = cacheDir + "/Dependencies/zstd"
+            if os.path.exists(buildPath): shutil.rmtree(buildPath)
+            subprocess.run([
+                "cmake.exe",
+                "-S", "./Dependencies/libzstd/build/cmake",
+                "-B", buildPath,
+                "-G", "Ninja",
+                "-DCMAKE_BUILD_TYPE=MinSizeRel",
+                "-DBUILD_SHARED_LIBS=OFF",
+                "-DZSTD_BUILD_STATIC=ON",
+                "-DZSTD_BUILD_SHARED=OFF",
+                "-DZSTD_BUILD_PROGRAMS=OFF",
+                "-DZSTD_BUILD_TESTS=OFF",
+                "-DZSTD_MULTITHREAD_SUPPORT=ON",
+                "-DCMAKE_MSVC_RUNTIME_LIBRARY=MultiThreaded"
+            ], check=True)
+            build_with_ninja(buildPath)
+            shutil.copyfile(buildPath + "/lib/zstd_static.lib", "./Libs/libzstd-static-x86_64.lib")
+            os.makedirs("./Libs/Zstd", exist_ok=True)
+            for header in ["zstd.h", "zstd_errors.h", "zdict.h"]: shutil.copyfile("./Dependencies/libzstd/lib/" + header, "./Libs/Zstd/" + header)
+            rgb_print("#38f227", "[ √ ] Jenova Runtime Dependency 'Zstd' Compiled Successfully.")
+
+        # Build LZ4
+        if not os.path.exists("./Libs/liblz4-static-x86_64.lib"):
+            buildPath = cacheDir + "/Dependencies/lz4"
+            if os.path.exists(buildPath): shutil.rmtree(buildPath)
+            subprocess.run([
+                "cmake.exe",
+                "-S", "./Dependencies/liblz4/build/cmake",
+                "-B", buildPath,
+                "-G", "Ninja",
+                "-DCMAKE_BUILD_TYPE=MinSizeRel",
+                "-DBUILD_SHARED_LIBS=OFF",
+                "-DBUILD_STATIC_LIBS=ON",
+                "-DLZ4_BUILD_CLI=OFF",
+                "-DCMAKE_MSVC_RUNTIME_LIBRARY=MultiThreaded"
+            ], check=True)
+            build_with_ninja(buildPath)
+            shutil.copyfile(buildPath + "/lz4.lib", "./Libs/liblz4-static-x86_64.lib")
+            os.makedirs("./Libs/LZ4", exist_ok=True)
+            for header in ["lz4.h", "lz4hc.h"]: shutil.copyfile("./Dependencies/liblz4/lib/" + header, "./Libs/LZ4/" + header)
+            rgb_print("#38f227", "[ √ ] Jenova Runtime Dependency 'LZ4' Compiled Successfully.")
+
         # Build PThread
         if not os.path.exists("./Libs/libpthread-static-x86_64.lib"):
             buildPath = cacheDir + "/Dependencies/pthread"
@@ -1028,6 +1163,49 @@ def build_dependencies_windows(buildMode, cacheDir):
             shutil.copyfile(buildPath + "/libzs.a", "./Libs/libzlib-static-x86_64.a")
             rgb_print("#38f227", "[ √ ] Jenova Runtime Dependency 'ZLIB' Compiled Successfully.")
 
+        # Build Zstd
+        if not os.path.exists("./Libs/libzstd-static-x86_64.a"):
+            buildPath = cacheDir + "/Dependencies/zstd"
+            if os.path.exists(buildPath): shutil.rmtree(buildPath)
+            subprocess.run([
+                "cmake.exe",
+                "-S", "./Dependencies/libzstd/build/cmake",
+                "-B", buildPath,
+                "-G", "Ninja",
+                "-DCMAKE_BUILD_TYPE=MinSizeRel",
+                "-DBUILD_SHARED_LIBS=OFF",
+                "-DZSTD_BUILD_STATIC=ON",
+                "-DZSTD_BUILD_SHARED=OFF",
+                "-DZSTD_BUILD_PROGRAMS=OFF",
+                "-DZSTD_BUILD_TESTS=OFF",
+                "-DZSTD_MULTITHREAD_SUPPORT=ON"
+            ], check=True)
+            build_with_ninja(buildPath)
+            shutil.copyfile(buildPath + "/lib/libzstd.a", "./Libs/libzstd-static-x86_64.a")
+            os.makedirs("./Libs/Zstd", exist_ok=True)
+            for header in ["zstd.h", "zstd_errors.h", "zdict.h"]: shutil.copyfile("./Dependencies/libzstd/lib/" + header, "./Libs/Zstd/" + header)
+            rgb_print("#38f227", "[ √ ] Jenova Runtime Dependency 'Zstd' Compiled Successfully.")
+
+        # Build LZ4
+        if not os.path.exists("./Libs/liblz4-static-x86_64.a"):
+            buildPath = cacheDir + "/Dependencies/lz4"
+            if os.path.exists(buildPath): shutil.rmtree(buildPath)
+            subprocess.run([
+                "cmake.exe",
+                "-S", "./Dependencies/liblz4/build/cmake",
+                "-B", buildPath,
+                "-G", "Ninja",
+                "-DCMAKE_BUILD_TYPE=MinSizeRel",
+                "-DBUILD_SHARED_LIBS=OFF",
+                "-DBUILD_STATIC_LIBS=ON",
+                "-DLZ4_BUILD_CLI=OFF"
+            ], check=True)
+            build_with_ninja(buildPath)
+            shutil.copyfile(buildPath + "/liblz4.a", "./Libs/liblz4-static-x86_64.a")
+            os.makedirs("./Libs/LZ4", exist_ok=True)
+            for header in ["lz4.h", "lz4hc.h"]: shutil.copyfile("./Dependencies/liblz4/lib/" + header, "./Libs/LZ4/" + header)
+            rgb_print("#38f227", "[ √ ] Jenova Runtime Dependency 'LZ4' Compiled Successfully.")
+
         # Build TinyCC
         if not os.path.exists("./Libs/libtcc-static-x86_64.a"):
             buildPath = cacheDir + "/Dependencies/tinycc"
@@ -1077,7 +1255,7 @@ def build_windows(compilerBinary, linkerBinary, buildMode, buildSystem):
     # Configuration
     compiler = compilerBinary
     linker = linkerBinary
-    outputDir = "Win64"
+    outputDir = "Win64/Benchmark" if benchmark_build else "Win64"
     outputName = "Jenova.Runtime.Win64.dll"
     symbolFileName = "Jenova.Runtime.Win64.pdb"
     mapFileName = "Jenova.Runtime.Win64.map"
@@ -1118,6 +1296,8 @@ def build_windows(compilerBinary, linkerBinary, buildMode, buildSystem):
             "Libs/libgodotcpp-static-x86_64.lib",
             "Libs/libasmjit-static-x86_64.lib",
             "Libs/libzlib-static-x86_64.lib",
+            "Libs/libzstd-static-x86_64.lib",
+            "Libs/liblz4-static-x86_64.lib",
             "Libs/liblzma-static-x86_64.lib",
             "Libs/libarchive-static-x86_64.lib",
             "Libs/libcurl-static-x86_64.lib",
@@ -1249,6 +1429,8 @@ def build_windows(compilerBinary, linkerBinary, buildMode, buildSystem):
         # Dependencies
         libs = [
             "Libs/libzlib-static-x86_64.a",
+            "Libs/libzstd-static-x86_64.a",
+            "Libs/liblz4-static-x86_64.a",
             "Libs/libtcc-static-x86_64.a",
             "Libs/libgodotcpp-static-x86_64.a",
             "Libs/libcurl-static-x86_64.a",
@@ -1388,6 +1570,7 @@ if __name__ == "__main__":
     parser.add_argument('--clean-up', action='store_true', help='Clean Up Build Files')
     parser.add_argument('--deep-clean-up', action='store_true', help='Clean Up Everything')
     parser.add_argument('--lithium-edition', action='store_true', help='Build Jenova Runtime foR Lithium IDE')
+    parser.add_argument('--benchmark', action='store_true', help='Build Jenova Runtime With Benchmark Suite (Separate Output, No Packaging)')
 
     # Parser Arguments
     args = parser.parse_args()
@@ -1425,6 +1608,13 @@ if __name__ == "__main__":
         lithium_edition = True
         flags.append("LITHIUM_EDITION")
 
+    # Handle Benchmark Build
+    if args.benchmark:
+        benchmark_build = True
+        skip_packaging = True
+        flags.append("JENOVA_BENCHMARK")
+        sources.extend(benchmark_sources)
+
     # Set Compiler And Start Build
     start_time = time.time()
     if args.compiler:
@@ -18,6 +18,10 @@
 // Loader Interface [Windows]
 class JenovaLoader
 {
+public:
+	// Called After Load While Staged Image Is Still Valid
+	typedef std::function<void(jenova::ModuleHandle moduleHandle)> ImageInspector;
+
 public:
 	static bool Initialize()
 	{
@@ -76,27 +80,53 @@ public:
 		SetAgressiveReleaseMode(agrState);
 		return true;
 	}
-	static jenova::ModuleHandle LoadModule(void* bufferPtr, size_t bufferSize, int flags = 0)
+	static void* AllocateModuleImage(size_t imageSize)
+	{
+		// Discard Previous Pending Image
+		if (pendingImage) VirtualFree(pendingImage, 0, MEM_RELEASE);
+
+		// Allocate Staging Image [Memory Module Maps Sections Into Its Own Allocation]
+		pendingImage = VirtualAlloc(nullptr, imageSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+		return pendingImage;
+	}
+	static void DiscardModuleImage(void* imagePtr)
+	{
+		if (!imagePtr || imagePtr != pendingImage) return;
+		VirtualFree(pendingImage, 0, MEM_RELEASE);
+		pendingImage = nullptr;
+	}
+	static jenova::ModuleHandle LoadModule(void* bufferPtr, size_t bufferSize, int flags = 0, const ImageInspector& imageInspector = nullptr)
 	{
 		// Update Flags
 		loaderFlags = flags;
 
 		// Load From Memory
-		return LoadLibraryMemory(bufferPtr);
+		jenova::ModuleHandle moduleHandle = LoadLibraryMemory(bufferPtr);
+		if (moduleHandle && imageInspector) imageInspector(moduleHandle);
+		DiscardModuleImage(bufferPtr);
+		return moduleHandle;
 	}
-	static jenova::ModuleHandle LoadModuleAsVirtual(void* bufferPtr, size_t bufferSize, const char* moduleName, const char* modulePath, int flags = 0)
+	static jenova::ModuleHandle LoadModuleAsVirtual(void* bufferPtr, size_t bufferSize, const char* moduleName, const char* modulePath, int flags = 0, const ImageInspector& imageInspector = nullptr)
 	{
 		// Update Flags
 		loaderFlags = flags;
 
 		// If Debug Mode Required Load From Disk
+		jenova::ModuleHandle moduleHandle = nullptr;
 		if ((loaderFlags & jenova::LoaderFlag::LoadInDebugMode) != 0)
 		{
-			return LoadLibraryA(jenova::CreateTemporaryModuleCache((uint8_t*)bufferPtr, bufferSize).c_str());
+			moduleHandle = LoadLibraryA(jenova::CreateTemporaryModuleCache((uint8_t*)bufferPtr, bufferSize).c_str());
+		}
+		else
+		{
+			// Load From Memory
+			moduleHandle = LoadLibraryMemoryExA(bufferPtr, bufferSize, moduleName, modulePath, LOAD_FLAGS_USE_DLL_NAME);
 		}
 
-		// Load From Memory
-		return LoadLibraryMemoryExA(bufferPtr, bufferSize, moduleName, modulePath, LOAD_FLAGS_USE_DLL_NAME);
+		// Release Staging Image
+		if (moduleHandle && imageInspector) imageInspector(moduleHandle);
+		DiscardModuleImage(bufferPtr);
+		return moduleHandle;
 	}
 	static jenova::ModuleAddress GetModuleBaseAddress(jenova::ModuleHandle moduleHandle)
 	{
@@ -110,9 +140,31 @@ public:
 	{
 		return FreeLibraryMemory(HMODULE(moduleHandle));
 	}
+	static jenova::ModuleGenerationRef GetModuleGeneration(jenova::ModuleHandle moduleHandle)
+	{
+		// Memory Module Shell Owns Module Lifetime
+		return nullptr;
+	}
+	static bool AcquireModuleInstance(const jenova::ModuleGenerationRef& moduleGeneration)
+	{
+		return true;
+	}
+	static void ReleaseModuleInstance(const jenova::ModuleGenerationRef& moduleGeneration)
+	{
+	}
+	static size_t RebindModuleSymbols(jenova::ModuleHandle targetHandle, jenova::ModuleHandle providerHandle, const jenova::SymbolList& symbolNames)
+	{
+		// Satellite Modules Are Linux Only
+		return 0;
+	}
+	static size_t GetLoadedGenerationCount()
+	{
+		return 0;
+	}
 
 private:
 	static inline jenova::LoaderFlags loaderFlags = 0;
+	static inline void* pendingImage = nullptr;
 
 private:
 	static inline NTSTATUS(NTAPI*InitializeMemoryModuleLoader)() = nullptr;
@@ -128,9 +180,29 @@ private:
 // Linux Module Loader
 #ifdef TARGET_PLATFORM_LINUX
 
+// Loader Structures [Linux]
+struct LoaderModuleImage
+{
+	int fd = -1;
+	void* imagePtr = nullptr;
+	size_t imageSize = 0;
+};
+struct jenova::ModuleGeneration
+{
+	void* handle = nullptr;
+	int fd = -1;
+	std::atomic<size_t> instanceCount = 0;
+	std::atomic<bool> isRetired = false;
+	std::atomic<bool> isUnloading = false;
+};
+
 // Loader Interface [Linux]
 class JenovaLoader
 {
+public:
+	// Called After Load While Staged Image Is Still Mapped
+	typedef std::function<void(jenova::ModuleHandle moduleHandle)> ImageInspector;
+
 public:
 	static bool Initialize()
 	{
@@ -138,6 +210,15 @@ public:
 	}
 	static bool Release()
 	{
+		// Release Pending Image And Cached Descriptors
+		std::lock_guard<std::mutex> lock(loaderMutex);
+		if (pendingImage.imagePtr) munmap(pendingImage.imagePtr, pendingImage.imageSize);
+		if (pendingImage.fd != -1) close(pendingImage.fd);
+		pendingImage = LoaderModuleImage();
+		for (int fd : descriptorPool) close(fd);
+		descriptorPool.clear();
+		for (int fd : residentDescriptors) close(fd);
+		residentDescriptors.clear();
 		return true;
 	}
 	static bool SetAgressiveMode(bool agrState)
@@ -145,42 +226,76 @@ public:
 		aggressiveMode = agrState;
 		return true;
 	}
-	static jenova::ModuleHandle LoadModule(void* bufferPtr, size_t bufferSize, int flags = 0)
+	static void* AllocateModuleImage(size_t imageSize)
 	{
-		// Generate Memory-Mapped File Name
-		pid_t pid = getpid();
-		char moduleName[64];
-		snprintf((char*)moduleName, sizeof(moduleName), "jenova_module_%d", pid);
+		// Validate
+		if (imageSize == 0) return nullptr;
+		std::lock_guard<std::mutex> lock(loaderMutex);
 
-		// Create Memory-Mapped File
-		int fd = memfd_create(moduleName, MFD_CLOEXEC | MFD_ALLOW_SEALING);
-		if (fd == -1)
-		{
-			perror("[Jenova Loader] memfd_create failed.");
-			return nullptr;
-		}
+		// Discard Previous Pending Image
+		if (pendingImage.imagePtr) DiscardPendingImage();
+
+		// Acquire Memory-Mapped File
+		int fd = AcquireDescriptor();
+		if (fd == -1) return nullptr;
 
 		// Resize Memory-Mapped File
-		if (ftruncate(fd, bufferSize) == -1)
+		if (ftruncate(fd, imageSize) == -1)
 		{
 			perror("[Jenova Loader] ftruncate failed.");
 			close(fd);
 			return nullptr;
 		}
 
-		// Write Module to Memory-Mapped File
-		ssize_t written = write(fd, bufferPtr, bufferSize);
-		if (written != static_cast<ssize_t>(bufferSize))
+		// Map Memory-Mapped File as Writable Image
+		void* imagePtr = mmap(nullptr, imageSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (imagePtr == MAP_FAILED)
 		{
-			perror("[Jenova Loader] write failed.");
+			perror("[Jenova Loader] mmap failed.");
 			close(fd);
 			return nullptr;
 		}
 
-		// Seal Memory-Mapped File
-		if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE) == -1)
+		// Store Pending Image
+		pendingImage.fd = fd;
+		pendingImage.imagePtr = imagePtr;
+		pendingImage.imageSize = imageSize;
+		return imagePtr;
+	}
+	static void DiscardModuleImage(void* imagePtr)
+	{
+		std::lock_guard<std::mutex> lock(loaderMutex);
+		if (imagePtr && imagePtr == pendingImage.imagePtr) DiscardPendingImage();
+	}
+	static jenova::ModuleHandle LoadModule(void* bufferPtr, size_t bufferSize, int flags = 0, const ImageInspector& imageInspector = nullptr)
+	{
+		// Validate
+		if (!bufferPtr || bufferSize == 0) return nullptr;
+
+		// Stage Module Into Memory-Mapped File Unless It Was Decoded In Place
+		bool isPendingImage = false;
+		{
+			std::lock_guard<std::mutex> lock(loaderMutex);
+			isPendingImage = (bufferPtr == pendingImage.imagePtr && bufferSize <= pendingImage.imageSize);
+		}
+		if (!isPendingImage)
+		{
+			void* imagePtr = AllocateModuleImage(bufferSize);
+			if (!imagePtr) return nullptr;
+			memcpy(imagePtr, bufferPtr, bufferSize);
+		}
+		std::lock_guard<std::mutex> lock(loaderMutex);
+
+		// Take Ownership of Pending Image [Stays Mapped Until Inspected]
+		LoaderModuleImage moduleImage = pendingImage;
+		int fd = moduleImage.fd;
+		pendingImage = LoaderModuleImage();
+
+		// Trim Trailing Data Decoded Alongside Module
+		if (ftruncate(fd, bufferSize) == -1)
 		{
-			perror("[Jenova Loader] fcntl failed.");
+			perror("[Jenova Loader] ftruncate failed.");
+			munmap(moduleImage.imagePtr, moduleImage.imageSize);
 			close(fd);
 			return nullptr;
 		}
@@ -189,24 +304,36 @@ public:
 		char fd_path[64];
 		snprintf(fd_path, sizeof(fd_path), "/proc/self/fd/%d", fd);
 
+		// Translate Loader Flags to Binding Mode [Module Imports SDK Through Its Own DT_NEEDED, Local Scope Is Safe]
+		int bindingMode = (flags & jenova::LoaderFlag::LazySymbolBinding) ? RTLD_LAZY : RTLD_NOW;
+		bindingMode |= (flags & jenova::LoaderFlag::LocalSymbolScope) ? RTLD_LOCAL : RTLD_GLOBAL;
+
 		// Load the Shared Object from Memory-Mapped File
-		void* handle = dlopen(fd_path, RTLD_NOW | RTLD_GLOBAL | flags);
+		void* handle = dlopen(fd_path, bindingMode);
 		if (!handle)
 		{
 			fprintf(stderr, "[Jenova Loader] dlopen failed: %s\n", dlerror());
+			munmap(moduleImage.imagePtr, moduleImage.imageSize);
 			close(fd);
 			return nullptr;
 		}
 
-		// Store Memory-Mapped File
-		moduleFdMap[handle] = fd;
+		// Register Module Generation
+		jenova::ModuleGenerationRef moduleGeneration = std::make_shared<jenova::ModuleGeneration>();
+		moduleGeneration->handle = handle;
+		moduleGeneration->fd = fd;
+		moduleGenerations.push_back(moduleGeneration);
+
+		// Let Caller Read Sections And Symbols, Then Release Staged Image
+		if (imageInspector) imageInspector(reinterpret_cast<jenova::ModuleHandle>(handle));
+		munmap(moduleImage.imagePtr, moduleImage.imageSize);
 
 		// Return Loaded Module Handle
 		return reinterpret_cast<jenova::ModuleHandle>(handle);
 	}
-	static jenova::ModuleHandle LoadModuleAsVirtual(void* bufferPtr, size_t bufferSize, const char* moduleName, const char* modulePath, int flags = 0)
+	static jenova::ModuleHandle LoadModuleAsVirtual(void* bufferPtr, size_t bufferSize, const char* moduleName, const char* modulePath, int flags = 0, const ImageInspector& imageInspector = nullptr)
 	{
-		return LoadModule(bufferPtr, bufferSize, flags);
+		return LoadModule(bufferPtr, bufferSize, flags, imageInspector);
 	}
 	static jenova::ModuleAddress GetModuleBaseAddress(jenova::ModuleHandle moduleHandle)
 	{
@@ -222,26 +349,232 @@ public:
 	{
 		// Validate
 		if (!moduleHandle) return false;
-		if (!aggressiveMode) return true;
+		std::lock_guard<std::mutex> lock(loaderMutex);
 
-		// Close Shared Object
-		dlclose(moduleHandle);
+		// Find Module Generation
+		auto it = FindGeneration(moduleHandle);
+		if (it == moduleGenerations.end()) return false;
+
+		// Retire Module Generation
+		(*it)->isRetired = true;
 
-		// Release Memory-Mapped File
-		auto it = moduleFdMap.find(moduleHandle);
-		if (it != moduleFdMap.end())
+		// Unload Immediately In Aggressive Mode, Otherwise Leave It to Generation Collector
+		if (aggressiveMode && BeginUnloadGeneration(**it))
 		{
-			close(it->second);
-			moduleFdMap.erase(it);
+			UnloadGeneration(**it);
+			moduleGenerations.erase(it);
+			return true;
 		}
+		CollectGenerations();
 
 		// All Good
 		return true;
 	}
+	static jenova::ModuleGenerationRef GetModuleGeneration(jenova::ModuleHandle moduleHandle)
+	{
+		// Resolve Generation Owning Module Handle
+		std::lock_guard<std::mutex> lock(loaderMutex);
+		auto it = FindGeneration(moduleHandle);
+		return it != moduleGenerations.end() ? *it : nullptr;
+	}
+	static bool AcquireModuleInstance(const jenova::ModuleGenerationRef& moduleGeneration)
+	{
+		// Pin Generation Without Loader Lock [Fails Only If Collector Already Started Unloading It]
+		if (!moduleGeneration) return false;
+		moduleGeneration->instanceCount.fetch_add(1);
+		if (!moduleGeneration->isUnloading.load()) return true;
+		moduleGeneration->instanceCount.fetch_sub(1);
+		return false;
+	}
+	static void ReleaseModuleInstance(const jenova::ModuleGenerationRef& moduleGeneration)
+	{
+		// Unpin Generation, Last Pin of A Retired Generation Runs Collector
+		if (!moduleGeneration) return;
+		if (moduleGeneration->instanceCount.fetch_sub(1) != 1 || !moduleGeneration->isRetired.load()) return;
+		std::lock_guard<std::mutex> lock(loaderMutex);
+		CollectGenerations();
+	}
+	static size_t RebindModuleSymbols(jenova::ModuleHandle targetHandle, jenova::ModuleHandle providerHandle, const jenova::SymbolList& symbolNames)
+	{
+		// Validate
+		struct link_map* targetMap = nullptr;
+		if (!targetHandle || !providerHandle || symbolNames.empty()) return 0;
+		if (dlinfo(targetHandle, RTLD_DI_LINKMAP, &targetMap) != 0 || !targetMap) return 0;
+		std::unordered_set<std::string> reboundSymbols(symbolNames.begin(), symbolNames.end());
+
+		// Read Dynamic Section [Loader Usually Relocates Pointers In Place]
+		auto ResolveDynamicPointer = [&](ElfW(Addr) dynamicPointer) { return dynamicPointer < targetMap->l_addr ? targetMap->l_addr + dynamicPointer : dynamicPointer; };
+		const ElfW(Sym)* symbolTable = nullptr;
+		const char* stringTable = nullptr;
+		const ElfW(Rela)* relocationTables[2] = {};
+		size_t relocationSizes[2] = {};
+		for (const ElfW(Dyn)* dynamicEntry = targetMap->l_ld; dynamicEntry->d_tag != DT_NULL; dynamicEntry++)
+		{
+			switch (dynamicEntry->d_tag)
+			{
+			case DT_SYMTAB: symbolTable = reinterpret_cast<const ElfW(Sym)*>(ResolveDynamicPointer(dynamicEntry->d_un.d_ptr)); break;
+			case DT_STRTAB: stringTable = reinterpret_cast<const char*>(ResolveDynamicPointer(dynamicEntry->d_un.d_ptr)); break;
+			case DT_RELA: relocationTables[0] = reinterpret_cast<const ElfW(Rela)*>(ResolveDynamicPointer(dynamicEntry->d_un.d_ptr)); break;
+			case DT_RELASZ: relocationSizes[0] = dynamicEntry->d_un.d_val; break;
+			case DT_JMPREL: relocationTables[1] = reinterpret_cast<const ElfW(Rela)*>(ResolveDynamicPointer(dynamicEntry->d_un.d_ptr)); break;
+			case DT_PLTRELSZ: relocationSizes[1] = dynamicEntry->d_un.d_val; break;
+			}
+		}
+		if (!symbolTable || !stringTable) return 0;
+
+		// Locate Read-Only After Relocation Segment
+		struct RelroSegment { ElfW(Addr) baseAddress; uintptr_t segmentStart; uintptr_t segmentEnd; } relroSegment = { targetMap->l_addr, 0, 0 };
+		dl_iterate_phdr([](struct dl_phdr_info* objectInfo, size_t, void* userData) -> int
+		{
+			RelroSegment* relroSegment = static_cast<RelroSegment*>(userData);
+			if (objectInfo->dlpi_addr != relroSegment->baseAddress) return 0;
+			for (ElfW(Half) i = 0; i < objectInfo->dlpi_phnum; i++)
+			{
+				if (objectInfo->dlpi_phdr[i].p_type != PT_GNU_RELRO) continue;
+				relroSegment->segmentStart = objectInfo->dlpi_addr + objectInfo->dlpi_phdr[i].p_vaddr;
+				relroSegment->segmentEnd = relroSegment->segmentStart + objectInfo->dlpi_phdr[i].p_memsz;
+			}
+			return 1;
+		}, &relroSegment);
+
+		// Point Import And Address Slots at Provider Definitions
+		uintptr_t pageSize = uintptr_t(sysconf(_SC_PAGESIZE));
+		std::unordered_set<uintptr_t> unlockedPages;
+		size_t reboundSlots = 0;
+		for (size_t t = 0; t < 2; t++)
+		{
+			for (size_t r = 0; relocationTables[t] && r < relocationSizes[t] / sizeof(ElfW(Rela)); r++)
+			{
+				const ElfW(Rela)& relocation = relocationTables[t][r];
+				uint32_t relocationType = ELF64_R_TYPE(relocation.r_info);
+				if (relocationType != R_X86_64_JUMP_SLOT && relocationType != R_X86_64_GLOB_DAT && relocationType != R_X86_64_64) continue;
+				uint32_t symbolIndex = ELF64_R_SYM(relocation.r_info);
+				if (symbolIndex == 0) continue;
+				const char* symbolName = stringTable + symbolTable[symbolIndex].st_name;
+				if (!reboundSymbols.contains(symbolName)) continue;
+				void* symbolAddress = dlsym(providerHandle, symbolName);
+				if (!symbolAddress) continue;
+				uintptr_t slotAddress = uintptr_t(targetMap->l_addr + relocation.r_offset);
+				uintptr_t pageAddress = slotAddress & ~(pageSize - 1);
+				if (unlockedPages.insert(pageAddress).second) mprotect(reinterpret_cast<void*>(pageAddress), pageSize, PROT_READ | PROT_WRITE);
+				*reinterpret_cast<uintptr_t*>(slotAddress) = uintptr_t(symbolAddress) + (relocationType == R_X86_64_64 ? relocation.r_addend : 0);
+				reboundSlots++;
+			}
+		}
+
+		// Restore Protection of Pages Loader Sealed [Partial Trailing Page Stays Writable]
+		uintptr_t relroStart = relroSegment.segmentStart & ~(pageSize - 1);
+		uintptr_t relroEnd = relroSegment.segmentEnd & ~(pageSize - 1);
+		for (uintptr_t pageAddress : unlockedPages)
+		{
+			if (pageAddress >= relroStart && pageAddress + pageSize <= relroEnd) mprotect(reinterpret_cast<void*>(pageAddress), pageSize, PROT_READ);
+		}
+		return reboundSlots;
+	}
+	static size_t GetLoadedGenerationCount()
+	{
+		std::lock_guard<std::mutex> lock(loaderMutex);
+		return moduleGenerations.size();
+	}
+
+private:
+	static int AcquireDescriptor()
+	{
+		// Reuse Cached Memory-Mapped File
+		if (!descriptorPool.empty())
+		{
+			int fd = descriptorPool.back();
+			descriptorPool.pop_back();
+			return fd;
+		}
+
+		// Generate Memory-Mapped File Name
+		pid_t pid = getpid();
+		char moduleName[64];
+		snprintf((char*)moduleName, sizeof(moduleName), "jenova_module_%d", pid);
+
+		// Create Memory-Mapped File
+		int fd = memfd_create(moduleName, MFD_CLOEXEC);
+		if (fd == -1) perror("[Jenova Loader] memfd_create failed.");
+		return fd;
+	}
+	static void RecycleDescriptor(int fd)
+	{
+		// Drop File Pages And Keep Descriptor for Next Load
+		if (descriptorPool.size() < jenova::GlobalSettings::ModuleImageDescriptorPool && ftruncate(fd, 0) == 0)
+		{
+			descriptorPool.push_back(fd);
+			return;
+		}
+		close(fd);
+	}
+	static void DiscardPendingImage()
+	{
+		munmap(pendingImage.imagePtr, pendingImage.imageSize);
+		RecycleDescriptor(pendingImage.fd);
+		pendingImage = LoaderModuleImage();
+	}
+	static std::vector<jenova::ModuleGenerationRef>::iterator FindGeneration(jenova::ModuleHandle moduleHandle)
+	{
+		return std::find_if(moduleGenerations.begin(), moduleGenerations.end(), [&](const jenova::ModuleGenerationRef& moduleGeneration)
+		{
+			return moduleGeneration->handle == moduleHandle;
+		});
+	}
+	static bool BeginUnloadGeneration(jenova::ModuleGeneration& moduleGeneration)
+	{
+		// Pins Increment Before Checking Unloading Flag, So Recheck Count After Raising It
+		if (moduleGeneration.instanceCount.load() != 0) return false;
+		moduleGeneration.isUnloading.store(true);
+		if (moduleGeneration.instanceCount.load() == 0) return true;
+		moduleGeneration.isUnloading.store(false);
+		return false;
+	}
+	static void UnloadGeneration(const jenova::ModuleGeneration& moduleGeneration)
+	{
+		// Close Shared Object
+		dlclose(moduleGeneration.handle);
+
+		// Loader Matches Loaded Objects by Name (/proc/self/fd/N) Before Inode, Object Kept Resident (NODELETE, GNU_UNIQUE)
+		// Must Keep Its Descriptor Open Until Release, Otherwise Next memfd_create May Get Same Number And dlopen Returns Stale Module
+		char fd_path[64];
+		snprintf(fd_path, sizeof(fd_path), "/proc/self/fd/%d", moduleGeneration.fd);
+		void* residentHandle = dlopen(fd_path, RTLD_NOW | RTLD_NOLOAD);
+		if (residentHandle)
+		{
+			dlclose(residentHandle);
+			residentDescriptors.push_back(moduleGeneration.fd);
+			return;
+		}
+		RecycleDescriptor(moduleGeneration.fd);
+	}
+	static void CollectGenerations()
+	{
+		// Keep Most Recent Retired Generations, Unload Older Ones Without Live Instances
+		size_t retiredGenerations = std::count_if(moduleGenerations.begin(), moduleGenerations.end(), [](const jenova::ModuleGenerationRef& moduleGeneration) 
+		{
+			return moduleGeneration->isRetired.load(); 
+		});
+		for (auto it = moduleGenerations.begin(); it != moduleGenerations.end() && retiredGenerations > jenova::GlobalSettings::ModuleGenerationHistory;)
+		{
+			if ((*it)->isRetired && BeginUnloadGeneration(**it))
+			{
+				UnloadGeneration(**it);
+				it = moduleGenerations.erase(it);
+				retiredGenerations--;
+				continue;
+			}
+			++it;
+		}
+	}
 
 private:
 	static inline bool aggressiveMode = false;
-	static inline std::unordered_map<jenova::ModuleHandle, int> moduleFdMap;
+	static inline LoaderModuleImage pendingImage;
+	static inline std::vector<jenova::ModuleGenerationRef> moduleGenerations;
+	static inline std::vector<int> descriptorPool;
+	static inline std::vector<int> residentDescriptors;
+	static inline std::mutex loaderMutex;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -86,6 +86,9 @@
 #include <sys/wait.h>
 #include <sys/mman.h>
 #include <sys/types.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <signal.h>
 #include <utime.h>
 #include <fcntl.h>
 #include <dlfcn.h>
@@ -112,8 +115,15 @@
 #include <fstream>
 #include <unordered_map>
 #include <unordered_set>
+#include <list>
 #include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <atomic>
+#include <memory>
 #include <filesystem>
+#include <algorithm>
 
 // Godot SDK :: Core
 #include <gdextension_interface.h>
@@ -164,6 +174,7 @@
 #include <classes/texture_rect.hpp>
 #include <classes/display_server.hpp>
 #include <classes/rendering_server.hpp>
+#include <classes/performance.hpp>
 #include <classes/rendering_device.hpp>
 #include <classes/editor_file_system.hpp>
 #include <classes/editor_interface.hpp>
@@ -312,6 +323,7 @@ namespace jenova
 	struct JenovaPackage;
 	struct AddonConfig;
 	struct ToolConfig;
+	struct ModuleGeneration;
 
 	// Type Definitions
 	typedef void* GenericHandle;
@@ -319,6 +331,7 @@ namespace jenova
 	typedef void* WindowHandle;
 	typedef void* FileHandle;
 	typedef intptr_t ModuleAddress;
+	typedef std::shared_ptr<ModuleGeneration> ModuleGenerationRef;
 	typedef intptr_t FunctionAddress;
 	typedef intptr_t PropertyAddress;
 	typedef String ScriptIdentifier;
@@ -340,6 +353,7 @@ namespace jenova
 	typedef std::vector<std::string> FileList;
 	typedef std::vector<std::string> DirecotryList;
 	typedef std::vector<std::string> TokenList;
+	typedef std::vector<std::string> SymbolList;
 	typedef std::vector<void*> PointerList;
 	typedef std::vector<JenovaPackage> PackageList;
 	typedef std::vector<size_t> IndexList;
@@ -388,6 +402,7 @@ namespace jenova
 	enum class ModuleUnloadStage
 	{
 		UnloadModuleToReload,
+		UnloadModuleToMigrate,
 		UnloadModuleToShutdown,
 		UnloadModuleManually
 	};
@@ -524,6 +539,31 @@ namespace jenova
 		Dynamically,
 		Statically
 	};
+	enum class ModuleSymbolBinding
+	{
+		ImmediateGlobal,
+		LazyGlobal,
+		ImmediateLocal,
+		LazyLocal
+	};
+	enum class ModuleLayout
+	{
+		Monolithic,
+		PerScript
+	};
+	enum class TraceRecording
+	{
+		Disabled,
+		Build,
+		BuildAndRuntime
+	};
+	enum class BuildServiceMode
+	{
+		Disabled,
+		WarmPipeline,
+		CompileOnSave,
+		CompileWhileEditing
+	};
 	enum class ModuleCacheType : short
 	{
 		Proprietary						= 0x5250,
@@ -541,6 +581,28 @@ namespace jenova
 		InstallFromPackageFile,
 		InstallFromPackageDirectory
 	};
+	enum class CompressionCodec : uint8_t
+	{
+		/* Zlib Must Stay Zero, Databases Created Before Codec Selection Have Zeroed Reserved Bytes */
+		Zlib							= 0x00,
+		Store							= 0x01,
+		LZ4								= 0x02,
+		Zstd							= 0x03,
+		Unknown							= 0xFF
+	};
+	enum class MemoryTag : uint8_t
+	{
+		ScriptProperties,
+		GlobalMemory,
+		SDKStrings,
+		ModuleImages,
+		JITCode,
+		BuildBuffers,
+		FrameArena,
+		NamedArenas,
+		ObjectPools,
+		TagCount
+	};
 
 	// Flags
 	enum CompilerFeature : CompilerFeatures
@@ -555,6 +617,8 @@ namespace jenova
 	{
 		LoadInDebugMode					= 0x01 << 0,
 		InitializeProtector				= 0x01 << 1,
+		LazySymbolBinding				= 0x01 << 2,
+		LocalSymbolScope				= 0x01 << 3,
 	};
 
 	// Structures
@@ -633,6 +697,46 @@ namespace jenova
 		String compileVerbose = "";
 		int scriptsCount = 0;
 	};
+	struct SatelliteModule
+	{
+		ModuleHandle moduleHandle = nullptr;
+		ModuleAddress moduleBaseAddress = 0;
+		ModuleGenerationRef moduleGeneration;
+		SymbolList reboundSymbols;
+		size_t moduleSize = 0;
+	};
+	struct ModuleBootStatistics
+	{
+		double loaderTime = 0.0;
+		double addonsTime = 0.0;
+		double initializerTime = 0.0;
+		double bootEventTime = 0.0;
+		double totalTime = 0.0;
+	};
+	// Memory Accounting [Implemented by JenovaMemoryTracker]
+	void RecordMemoryAllocation(MemoryTag memoryTag, size_t memorySize);
+	void RecordMemoryRelease(MemoryTag memoryTag, size_t memorySize);
+	template <typename T, MemoryTag Tag> struct TrackedAllocator
+	{
+		typedef T value_type;
+		template <typename U> struct rebind { typedef TrackedAllocator<U, Tag> other; };
+		TrackedAllocator() noexcept = default;
+		template <typename U> TrackedAllocator(const TrackedAllocator<U, Tag>&) noexcept {}
+		T* allocate(size_t elementCount)
+		{
+			T* memoryPtr = std::allocator<T>().allocate(elementCount);
+			RecordMemoryAllocation(Tag, elementCount * sizeof(T));
+			return memoryPtr;
+		}
+		void deallocate(T* memoryPtr, size_t elementCount) noexcept
+		{
+			RecordMemoryRelease(Tag, elementCount * sizeof(T));
+			std::allocator<T>().deallocate(memoryPtr, elementCount);
+		}
+		template <typename U> bool operator==(const TrackedAllocator<U, Tag>&) const noexcept { return true; }
+		template <typename U> bool operator!=(const TrackedAllocator<U, Tag>&) const noexcept { return false; }
+	};
+	typedef std::vector<uint8_t, TrackedAllocator<uint8_t, MemoryTag::BuildBuffers>> BuildBuffer;
 	struct BuildResult
 	{
 		bool hasError = false;
@@ -641,7 +745,7 @@ namespace jenova
 		String buildError = "";
 		String buildVerbose = "";
 		SerializedData moduleMetaData;
-		std::vector<uint8_t> builtModuleData;
+		BuildBuffer builtModuleData;
 		std::string buildPath;
 		CompilerModel compilerModel = CompilerModel::Unspecified;
 		bool hasDebugInformation = false;
@@ -655,7 +759,9 @@ namespace jenova
 		float compressionRatio					= 100.0f;
 		ModuleCacheType databaseType			= ModuleCacheType::Unknown;
 		unsigned char databaseVersion[4]		= { 0 };
-		unsigned char reserved[14]				= { 0 };
+		CompressionCodec compressionCodec		= CompressionCodec::Zlib;
+		unsigned char compressionLevel			= 0;
+		unsigned char reserved[12]				= { 0 };
 	};
 	struct ScriptCaller
 	{
@@ -760,10 +866,58 @@ namespace jenova
 		constexpr bool DisableBuildAndRunWhileDebug				= true;
 
 		constexpr size_t PrintOutputBufferSize					= 8192;
+		constexpr size_t LogRingCapacity						= 1024;
+		constexpr size_t LogRecordMessageSize					= 512;
 		constexpr size_t BuildOutputBufferSize					= PrintOutputBufferSize;
 		constexpr size_t FormatBufferSize						= 4096;
 		constexpr size_t ScriptReloadCooldown					= 200;
 		constexpr size_t ScriptChangeCooldown					= 200;
+		constexpr size_t AssetMonitorCoalesceWindow				= 100;
+		constexpr size_t AssetMonitorReadBufferSize				= 65536;
+		constexpr size_t AssetMonitorWatchBudget				= 8192;
+		constexpr size_t CompressionWorkerThreads				= 0;
+		constexpr size_t ModuleGenerationHistory				= 4;
+		constexpr size_t ModuleImageDescriptorPool				= 2;
+		constexpr double ModuleReloadFrameBudget				= 1000.0 / 60.0;
+		constexpr size_t PartialReloadScriptLimit				= 4;
+		constexpr size_t BuildServiceSpeculativeScriptLimit		= 16;
+		constexpr size_t BuildServiceRacyStampWindow			= 1000;
+		constexpr size_t BuildServiceSpeculativeJobLimit		= 2;
+		constexpr int BuildServiceSpeculativeJobNiceness		= 19;
+		constexpr size_t ScriptProfilerMethodCapacity			= 4096;
+		constexpr size_t ScriptProfilerMaxCallDepth				= 256;
+		constexpr double ScriptProfilerOverheadBudget			= 0.1;
+		constexpr size_t TinyProfilerEventBufferSize			= 8192;
+		constexpr size_t TinyProfilerMaxScopeDepth				= 64;
+		constexpr size_t TraceRecorderMaxEvents					= 4000000;
+		constexpr size_t TraceRecorderRuntimeRingEvents			= 500000;
+		constexpr size_t SamplingProfilerFrequency				= 997;
+		constexpr size_t SamplingProfilerMaxStackDepth			= 64;
+		constexpr size_t SamplingProfilerRingCapacity			= 1024;
+		constexpr size_t SamplingProfilerMaxThreads				= 64;
+		constexpr size_t PerfMapBufferSize						= 65536;
+		constexpr size_t PerfMapThunkHistory					= 65536;
+		constexpr size_t FrameBudgetHistorySize					= 600;
+		constexpr size_t FrameBudgetAlarmHistory				= 16;
+		constexpr size_t FrameBudgetWarningCooldown			= 1000;
+		constexpr size_t GlobalStoreCapacity					= 4096;
+		constexpr size_t GlobalStoreMaxReaders					= 64;
+		constexpr size_t FrameArenaBlockSize					= 1048576;
+		constexpr size_t NamedArenaBlockSize					= 65536;
+		constexpr size_t ArenaDefaultAlignment					= 16;
+		constexpr size_t ObjectPoolBlockSize					= 65536;
+		constexpr size_t ObjectPoolMinObjectSize				= 16;
+		constexpr size_t ObjectPoolClassCount					= 7;
+		constexpr size_t ObjectPoolRefillCount					= 64;
+		constexpr size_t ClektronScriptCacheSize				= 64;
+		constexpr size_t ClektronAPIVersion						= 1;
+		constexpr size_t BenchmarkSampleCount					= 16;
+		constexpr size_t BenchmarkCallIterations				= 2000;
+		constexpr size_t BenchmarkLookupIterations				= 20000;
+		constexpr size_t BenchmarkDeployRepetitions				= 8;
+		constexpr size_t BenchmarkCompressionRepetitions		= 4;
+		constexpr size_t BenchmarkSceneNodeCount				= 100000;
+		constexpr size_t BenchmarkSceneFanout					= 100;
 
 		constexpr char* JenovaRuntimeModuleName					= "Jenova.Runtime";
 		constexpr char* JenovaScriptExtension					= "cpp";
@@ -771,6 +925,7 @@ namespace jenova
 		constexpr char* JenovaScriptType						= "CPPScript";
 		constexpr char* JenovaHeaderType						= "CPPHeader";
 		constexpr char* JenovaCacheDirectory					= "/Jenova_Cache/";
+		constexpr char* ClektronObjectCacheDirectory			= "Clektron/";
 		constexpr char* ScriptToolIdentifier					= "JENOVA_TOOL_SCRIPT";
 		constexpr char* ScriptBlockBeginIdentifier				= "JENOVA_SCRIPT_BEGIN";
 		constexpr char* ScriptBlockEndIdentifier				= "JENOVA_SCRIPT_END";
@@ -786,12 +941,21 @@ namespace jenova
 		constexpr char* JenovaModuleBootEventName				= "JenovaBoot";
 		constexpr char* JenovaModuleShutdownEventName			= "JenovaShutdown";
 		constexpr char* JenovaBuildCacheDatabaseFile			= "Jenova.Build.json";
+		constexpr char* JenovaBenchmarkResultFile				= "Jenova.Benchmark.json";
+		constexpr char* JenovaBuildTraceFile					= "Jenova.Build.Trace.json";
+		constexpr char* JenovaRuntimeTraceFile					= "user://Jenova.Runtime.Trace.json";
+		constexpr char* JenovaNativeProfileFoldedFile			= "Jenova.Native.Profile.folded";
+		constexpr char* JenovaNativeProfileFlameGraphFile		= "Jenova.Native.Profile.svg";
+		constexpr char* JenovaMemoryReportFile					= "Jenova.Memory.Report.txt";
 		constexpr char* JenovaInstalledPackagesFile				= "Jenova.Runtime.Packages.json";
 		constexpr char* JenovaGodotSDKHeaderCacheFile			= "GodotSDK.auto";
 		constexpr char* JenovaConfigurationFile					= "Jenova.config";
 		constexpr char* VisualStudioSolutionFile				= "Jenova.Framework.sln";
 		constexpr char* VisualStudioProjectFile					= "Jenova.Module.vcxproj";
 		constexpr char* VisualStudioWatchdogFile				= "Jenova.VisualStudio.jwd";
+		constexpr char* AssetMonitorProjectFilters				= "*.cpp;*.hpp;*.hh;*.h;Addon-Config.json;Jenova.Runtime.Packages.json";
+		constexpr char* AssetMonitorIgnoreFilters				= ".godot/**;Jenova_Cache/**";
+		constexpr char* AssetMonitorWatchdogFilter				= "*.jwd";
 		constexpr char* JenovaTemporaryBootScriptFile			= "Jenova.Temporary.Boot.ctron";
 		constexpr char* JenovaPackageDatabaseURL				= "https://raw.githubusercontent.com";
 		constexpr char* JenovaReleaseMetadataURL				= "https://raw.githubusercontent.com";
@@ -803,6 +967,11 @@ namespace jenova
 		constexpr char JenovaBuildVersion[4]					= { APP_VERSION_DATA };
 
 		constexpr ModuleLoadStage DefaultModuleLoadStage		= ModuleLoadStage::LoadModuleAtInitialization;
+
+		constexpr CompressionCodec DatabaseCompressionCodec		= CompressionCodec::LZ4;
+		constexpr int DatabaseCompressionLevel					= 1;
+		constexpr CompressionCodec ExportCompressionCodec		= CompressionCodec::Zstd;
+		constexpr int ExportCompressionLevel					= 19;
 	}
 
 	// Global Storage
@@ -814,13 +983,19 @@ namespace jenova
 		extern jenova::ChangesTriggerMode						CurrentChangesTriggerMode;
 		extern jenova::EditorVerboseOutput						CurrentEditorVerboseOutput;
 		extern jenova::SDKLinkingMode							SDKLinkingMode;
+		extern jenova::ModuleSymbolBinding						ModuleSymbolBinding;
+		extern jenova::ModuleLayout								ModuleLayout;
+		extern jenova::TraceRecording							TraceRecording;
+		extern jenova::BuildServiceMode							BuildServiceMode;
 		extern std::string										CurrentJenovaCacheDirectory;
 		extern std::string										CurrentJenovaGeneratedConfiguration;
 		extern std::string										CurrentJenovaRuntimeModulePath;
+		extern std::string										MemoryReportPath;
 		extern bool												DeveloperModeActivated;
 		extern bool												UseHotReloadAtRuntime;
 		extern bool												UseMonospaceFontForTerminal;
 		extern bool												UseManagedSafeExecution;
+		extern bool												UseNativeSamplingProfiler;
 		extern int												TerminalDefaultFontSize;
 	}
 
@@ -865,6 +1040,7 @@ namespace jenova
 	void OutputColored(const char* colorHash, const char* fmt, ...);
 	void Verbose(const char* fmt, ...);
 	void VerboseByID(int id, const char* fmt, ...);
+	void EmitVerbose(const char* colorHash, const char* message);
 	void Error(const char* stageName, const char* fmt, ...);
 	void Warning(const char* stageName, const char* fmt, ...);
 	void ErrorMessage(const char* title, const char* fmt, ...);
@@ -894,6 +1070,8 @@ namespace jenova
 	void ResetCurrentDirectoryToRoot();
 	void DoApplicationEvents();
 	bool QueueProjectBuild(bool deferred = true);
+	bool BuildProjectImmediately();
+	bool QueueEditedScriptCompile(const String& scriptPath, const String& scriptCode);
 	bool UpdateGlobalStorageFromEditorSettings();
 	std::string GetNotificationString(int p_what);
 	String GetJenovaCacheDirectory();
@@ -912,9 +1090,14 @@ namespace jenova
 	ScriptModule CreateScriptModuleFromInternalSource(const std::string& sourceName, const std::string& sourceCode);
 	bool CreateFileFromInternalSource(const std::string& sourceFile, const std::string& sourceCode);
 	bool CreateBuildCacheDatabase(const std::string& cacheFile, const ModuleList& scriptModules, const jenova::HeaderList& scriptHeaders, bool skipHashes = false);
+	ModuleList CollectModifiedScriptModules(const std::string& cacheFile, const ModuleList& scriptModules, const jenova::HeaderList& scriptHeaders, bool& requiresFullBuild);
+	SymbolList CollectObjectFunctionSymbols(const std::string& objectFile);
 	std::string GetLoadedModulePath(jenova::ModuleHandle moduleHandle);
-	MemoryBuffer CompressBuffer(void* bufferPtr, size_t bufferSize);
-	MemoryBuffer DecompressBuffer(void* bufferPtr, size_t bufferSize);
+	MemoryBuffer CompressBuffer(void* bufferPtr, size_t bufferSize, CompressionCodec compressionCodec = CompressionCodec::Zlib, int compressionLevel = -1);
+	MemoryBuffer DecompressBuffer(void* bufferPtr, size_t bufferSize, CompressionCodec compressionCodec = CompressionCodec::Zlib, size_t decompressedSize = 0);
+	bool DecompressBufferTo(void* bufferPtr, size_t bufferSize, CompressionCodec compressionCodec, void* outputPtr, size_t outputSize);
+	size_t GetCompressionBound(size_t bufferSize, CompressionCodec compressionCodec);
+	std::string GetCompressionCodecName(CompressionCodec compressionCodec);
 	float CalculateCompressionRatio(size_t baseSize, size_t compressedSize);
 	Ref<Texture2D> GetEditorIcon(const String& iconName);
 	bool DumpThemeColors(const Ref<Theme> theme);
@@ -1019,10 +1202,19 @@ namespace jenova
 }
 
 // Jenova Tools
+#include "log_system.h"
 #include "tiny_profiler.h"
+#include "sampling_profiler.h"
+#include "memory_tracker.h"
+#include "global_store.h"
+#include "arena_allocator.h"
+#include "scene_index.h"
 #include "task_system.h"
 #include "asset_monitor.h"
 #include "package_manager.h"
+#ifdef JENOVA_BENCHMARK
+#include "benchmark_suite.h"
+#endif
 
 // Jenova C++ Script Engine
 #include "script_object.h"
@@ -1034,6 +1226,7 @@ namespace jenova
 #include "script_instance.h"
 #include "script_manager.h"
 #include "script_compiler.h"
+#include "build_service.h"
 
 // Jenova C Script Engine
 #include "clektron.h"
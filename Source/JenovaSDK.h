@@ -80,6 +80,8 @@
 	#include <string>
 	#include <thread>
 	#include <functional>
+	#include <new>
+	#include <type_traits>
 #endif
 
 // GodotSDK Imports
@@ -87,6 +89,7 @@
 	#include <Godot/variant/variant.hpp>
 	#include <Godot/variant/string.hpp>
 	#include <Godot/variant/string_name.hpp>
+	#include <Godot/variant/typed_array.hpp>
 	#include <Godot/classes/global_constants.hpp>
 	#include <Godot/classes/object.hpp>
 	#include <Godot/classes/node.hpp>
@@ -151,11 +154,18 @@ namespace jenova::sdk
 	typedef const wchar_t*				WideStringPtr;
 	typedef const char*					MemoryID;
 	typedef const char*					VariableID;
+	typedef const char*					ArenaID;
+	typedef unsigned int				GlobalHandle;
 	typedef unsigned short				TaskID;
 	typedef int short					DriverResourceID;
 	typedef std::function<void()>		TaskFunction;
 	typedef void*						JenovaSDKInterface;
 
+	// Constants
+	constexpr GlobalHandle InvalidGlobalHandle = 0xFFFFFFFF;
+	constexpr size_t DefaultArenaAlignment = 16;
+	constexpr size_t TemporaryStringCount = 16;
+
 	// Function Definitions
 	typedef void(*RuntimeCallback)(const RuntimeEvent& runtimeEvent, NativePtr dataPtr, size_t dataSize);
 	typedef void(*FileSystemCallback)(const godot::String& targetPath, const FileSystemEvent& fsEvent);
@@ -237,6 +247,43 @@ namespace jenova::sdk
 		JENOVA_INTERNAL(bool ExecuteScript(const godot::String& ctronScript, bool noEntrypoint = false));
 		JENOVA_INTERNAL(bool ExecuteScriptFromFile(const godot::String& ctronScriptFile, bool noEntrypoint = false));
 
+		// Appended Interfaces [New Functions Go Last, Existing Slots Must Not Move]
+		// Frame Timing Utilities
+		JENOVA_INTERNAL(bool SetFrameBudget(double budgetMilliseconds));
+		JENOVA_INTERNAL(godot::Dictionary GetFrameTimingReport());
+
+		// Memory Tracking Utilities
+		JENOVA_INTERNAL(godot::Dictionary GetMemoryReport());
+		JENOVA_INTERNAL(bool DumpMemoryReport(const godot::String& reportFile));
+
+		// Global Handle Utilities (Anzen)
+		JENOVA_INTERNAL(GlobalHandle RegisterGlobal(const char* globalName));
+		JENOVA_INTERNAL(NativePtr GetGlobalPointerByHandle(GlobalHandle handle));
+		JENOVA_INTERNAL(NativePtr SetGlobalPointerByHandle(GlobalHandle handle, NativePtr ptr));
+		JENOVA_INTERNAL(godot::Variant GetGlobalVariableByHandle(GlobalHandle handle));
+		JENOVA_INTERNAL(void SetGlobalVariableByHandle(GlobalHandle handle, godot::Variant var));
+
+		// Allocator Utilities (Anzen)
+		JENOVA_INTERNAL(NativePtr AllocateFrameMemory(size_t size, size_t alignment));
+		JENOVA_INTERNAL(NativePtr AllocateArenaMemory(ArenaID id, size_t size, size_t alignment));
+		JENOVA_INTERNAL(bool ResetArena(ArenaID id));
+		JENOVA_INTERNAL(bool ReleaseArena(ArenaID id));
+		JENOVA_INTERNAL(NativePtr AllocatePoolObject(size_t size));
+		JENOVA_INTERNAL(void FreePoolObject(NativePtr ptr, size_t size));
+		JENOVA_INTERNAL(godot::Dictionary GetAllocatorReport());
+
+		// Scene Index Utilities
+		JENOVA_INTERNAL(godot::Node* GetNodeByUniqueID(const godot::String& uniqueID));
+		JENOVA_INTERNAL(godot::TypedArray<godot::Node> FindNodesByName(const godot::String& name));
+		JENOVA_INTERNAL(godot::TypedArray<godot::Node> FindNodesByClass(const godot::String& className));
+
+		// Temporary String Utilities
+		JENOVA_INTERNAL(StringPtr GetTempCStr(const godot::String& godotStr));
+		JENOVA_INTERNAL(WideStringPtr GetTempWCStr(const godot::String& godotStr));
+
+		// Borrowed Scene Index Utilities
+		JENOVA_INTERNAL(StringPtr GetBorrowedNodeUniqueID(godot::Node* node));
+
 		// Interface Validator
 		static bool ValidateInterface(void* bridgePtr)
 		{
@@ -283,6 +330,28 @@ namespace jenova::sdk
 		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
 		return bridge->GetNodeUniqueID(node);
 	}
+	// Returned Pointer Is Owned By Runtime And Must Not Be Freed, Invalid Once Node Is Removed Or It Or An Ancestor Is Renamed
+	// Nodes Outside Scene Tree Get A Temporary String, Reused After TemporaryStringCount Further Conversions On The Same Thread
+	JENOVA_WRAPPER StringPtr GetBorrowedNodeUniqueID(godot::Node* node)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
+		return bridge->GetBorrowedNodeUniqueID(node);
+	}
+	JENOVA_WRAPPER godot::Node* GetNodeByUniqueID(const godot::String& uniqueID)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
+		return bridge->GetNodeByUniqueID(uniqueID);
+	}
+	JENOVA_WRAPPER godot::TypedArray<godot::Node> FindNodesByName(const godot::String& name)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return godot::TypedArray<godot::Node>();
+		return bridge->FindNodesByName(name);
+	}
+	JENOVA_WRAPPER godot::TypedArray<godot::Node> FindNodesByClass(const godot::String& className)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return godot::TypedArray<godot::Node>();
+		return bridge->FindNodesByClass(className);
+	}
 	JENOVA_WRAPPER godot::SceneTree* GetTree()
 	{
 		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
@@ -361,6 +430,17 @@ namespace jenova::sdk
 		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
 		return bridge->GetWCStr(godotStr);
 	}
+	// Returned Pointer Is Reused After TemporaryStringCount Further Conversions On The Same Thread, Copy It to Keep It
+	JENOVA_WRAPPER StringPtr GetTempCStr(const godot::String& godotStr)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
+		return bridge->GetTempCStr(godotStr);
+	}
+	JENOVA_WRAPPER WideStringPtr GetTempWCStr(const godot::String& godotStr)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
+		return bridge->GetTempWCStr(godotStr);
+	}
 	JENOVA_WRAPPER bool SetClassIcon(const godot::String& className, const godot::Ref<godot::Texture2D> iconImage)
 	{
 		if (!JenovaSDK::ValidateInterface(bridge)) return false;
@@ -431,6 +511,16 @@ namespace jenova::sdk
 		if (!JenovaSDK::ValidateInterface(bridge)) return false;
 		return bridge->UnregisterRuntimeCallback(callbackPtr);
 	}
+	JENOVA_WRAPPER bool SetFrameBudget(double budgetMilliseconds)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return false;
+		return bridge->SetFrameBudget(budgetMilliseconds);
+	}
+	JENOVA_WRAPPER godot::Dictionary GetFrameTimingReport()
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return godot::Dictionary();
+		return bridge->GetFrameTimingReport();
+	}
 
 	// Graphic Utilities :: Wrappers
 	JENOVA_WRAPPER NativePtr GetGameWindowHandle()
@@ -500,6 +590,51 @@ namespace jenova::sdk
 		if (!JenovaSDK::ValidateInterface(bridge)) return;
 		bridge->FreeGlobalMemory(id);
 	}
+	JENOVA_WRAPPER godot::Dictionary GetMemoryReport()
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return godot::Dictionary();
+		return bridge->GetMemoryReport();
+	}
+	JENOVA_WRAPPER bool DumpMemoryReport(const godot::String& reportFile = "")
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return false;
+		return bridge->DumpMemoryReport(reportFile);
+	}
+	JENOVA_WRAPPER NativePtr AllocateFrameMemory(size_t size, size_t alignment = DefaultArenaAlignment)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
+		return bridge->AllocateFrameMemory(size, alignment);
+	}
+	JENOVA_WRAPPER NativePtr AllocateArenaMemory(ArenaID id, size_t size, size_t alignment = DefaultArenaAlignment)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
+		return bridge->AllocateArenaMemory(id, size, alignment);
+	}
+	JENOVA_WRAPPER bool ResetArena(ArenaID id)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return false;
+		return bridge->ResetArena(id);
+	}
+	JENOVA_WRAPPER bool ReleaseArena(ArenaID id)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return false;
+		return bridge->ReleaseArena(id);
+	}
+	JENOVA_WRAPPER NativePtr AllocatePoolObject(size_t size)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
+		return bridge->AllocatePoolObject(size);
+	}
+	JENOVA_WRAPPER void FreePoolObject(NativePtr ptr, size_t size)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return;
+		bridge->FreePoolObject(ptr, size);
+	}
+	JENOVA_WRAPPER godot::Dictionary GetAllocatorReport()
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return godot::Dictionary();
+		return bridge->GetAllocatorReport();
+	}
 
 	// Global Variable Storage Utilities (Anzen) :: Wrappers
 	JENOVA_WRAPPER godot::Variant GetGlobalVariable(VariableID id)
@@ -517,6 +652,31 @@ namespace jenova::sdk
 		if (!JenovaSDK::ValidateInterface(bridge)) return;
 		bridge->ClearGlobalVariables();
 	}
+	JENOVA_WRAPPER GlobalHandle RegisterGlobal(const char* globalName)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return InvalidGlobalHandle;
+		return bridge->RegisterGlobal(globalName);
+	}
+	JENOVA_WRAPPER NativePtr GetGlobalPointerByHandle(GlobalHandle handle)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
+		return bridge->GetGlobalPointerByHandle(handle);
+	}
+	JENOVA_WRAPPER NativePtr SetGlobalPointerByHandle(GlobalHandle handle, NativePtr ptr)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return nullptr;
+		return bridge->SetGlobalPointerByHandle(handle, ptr);
+	}
+	JENOVA_WRAPPER godot::Variant GetGlobalVariableByHandle(GlobalHandle handle)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return godot::Variant();
+		return bridge->GetGlobalVariableByHandle(handle);
+	}
+	JENOVA_WRAPPER void SetGlobalVariableByHandle(GlobalHandle handle, godot::Variant var)
+	{
+		if (!JenovaSDK::ValidateInterface(bridge)) return;
+		bridge->SetGlobalVariableByHandle(handle, var);
+	}
 
 	// Task System Utilities :: Wrappers
 	JENOVA_WRAPPER TaskID InitiateTask(TaskFunction function)
@@ -590,4 +750,36 @@ namespace jenova::sdk
 	{
 		return T(GetGlobalVariable(id));
 	}
+	template <typename T> T* GlobalPointer(GlobalHandle handle)
+	{
+		return static_cast<T*>(GetGlobalPointerByHandle(handle));
+	}
+	template <typename T> T GlobalVariable(GlobalHandle handle)
+	{
+		return T(GetGlobalVariableByHandle(handle));
+	}
+	template <typename T, typename... Args> T* FrameNew(Args&&... args)
+	{
+		static_assert(std::is_trivially_destructible<T>::value, "Frame Memory Is Never Destructed, Use PoolNew For Types With Destructors.");
+		NativePtr ptr = AllocateFrameMemory(sizeof(T), alignof(T));
+		return ptr ? new (ptr) T(std::forward<Args>(args)...) : nullptr;
+	}
+	template <typename T, typename... Args> T* ArenaNew(ArenaID id, Args&&... args)
+	{
+		static_assert(std::is_trivially_destructible<T>::value, "Arena Memory Is Never Destructed, Use PoolNew For Types With Destructors.");
+		NativePtr ptr = AllocateArenaMemory(id, sizeof(T), alignof(T));
+		return ptr ? new (ptr) T(std::forward<Args>(args)...) : nullptr;
+	}
+	template <typename T, typename... Args> T* PoolNew(Args&&... args)
+	{
+		static_assert(alignof(T) <= DefaultArenaAlignment, "Pool Objects Are Aligned to DefaultArenaAlignment At Most.");
+		NativePtr ptr = AllocatePoolObject(sizeof(T));
+		return ptr ? new (ptr) T(std::forward<Args>(args)...) : nullptr;
+	}
+	template <typename T> void PoolDelete(T* object)
+	{
+		if (!object) return;
+		object->~T();
+		FreePoolObject(object, sizeof(T));
+	}
 }
\ No newline at end of file
@@ -0,0 +1,372 @@
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Arena Allocator Internal Storage
+namespace jenova::arenas
+{
+    // Pool Size Classes [MinObjectSize << ClassIndex]
+    constexpr size_t PoolClassCount = jenova::GlobalSettings::ObjectPoolClassCount;
+    constexpr size_t PoolMinObjectSize = jenova::GlobalSettings::ObjectPoolMinObjectSize;
+    constexpr size_t PoolMaxObjectSize = PoolMinObjectSize << (PoolClassCount - 1);
+    static_assert(PoolMinObjectSize >= sizeof(void*), "Object Pool Minimum Object Size Must Hold A Pointer.");
+
+    // Structures
+    struct alignas(16) ArenaBlock
+    {
+        ArenaBlock* previousBlock;
+        size_t blockCapacity;
+        std::atomic<size_t> blockOffset;
+        uint8_t* GetData() { return reinterpret_cast<uint8_t*>(this + 1); }
+    };
+    struct LinearArena
+    {
+        LinearArena(jenova::MemoryTag tag, size_t size) : memoryTag(tag), blockSize(size) {}
+        jenova::MemoryTag memoryTag;
+        size_t blockSize;
+        std::atomic<ArenaBlock*> currentBlock = nullptr;
+        std::atomic<size_t> activeBumps = 0;
+        std::mutex arenaMutex;
+        bool arenaReleased = false;
+        size_t reservedBytes = 0;
+        size_t peakUsedBytes = 0;
+    };
+    struct FreeObject
+    {
+        FreeObject* nextObject;
+    };
+    struct PoolDepot
+    {
+        std::mutex depotMutex;
+        FreeObject* freeObjects = nullptr;
+        size_t freeCount = 0;
+        std::vector<void*> poolBlocks;
+    };
+    struct ThreadPoolCache
+    {
+        FreeObject* freeObjects[PoolClassCount] = {};
+        size_t freeCounts[PoolClassCount] = {};
+        ~ThreadPoolCache();
+    };
+
+    // Allocator State
+    static LinearArena frameArena(jenova::MemoryTag::FrameArena, jenova::GlobalSettings::FrameArenaBlockSize);
+    static std::mutex namedArenasMutex;
+    static std::unordered_map<std::string, std::shared_ptr<LinearArena>> namedArenas;
+    static PoolDepot poolDepots[PoolClassCount];
+    static thread_local ThreadPoolCache threadPoolCache;
+
+    // Linear Arena Utilities
+    static ArenaBlock* CreateArenaBlock(LinearArena& arena, size_t blockCapacity)
+    {
+        ArenaBlock* arenaBlock = static_cast<ArenaBlock*>(std::malloc(sizeof(ArenaBlock) + blockCapacity));
+        if (!arenaBlock) return nullptr;
+        arenaBlock->previousBlock = nullptr;
+        arenaBlock->blockCapacity = blockCapacity;
+        new (&arenaBlock->blockOffset) std::atomic<size_t>(0);
+        arena.reservedBytes += sizeof(ArenaBlock) + blockCapacity;
+        JenovaMemoryTracker::TrackAllocation(arena.memoryTag, sizeof(ArenaBlock) + blockCapacity);
+        return arenaBlock;
+    }
+    static void DestroyArenaBlock(LinearArena& arena, ArenaBlock* arenaBlock)
+    {
+        arena.reservedBytes -= sizeof(ArenaBlock) + arenaBlock->blockCapacity;
+        JenovaMemoryTracker::TrackRelease(arena.memoryTag, sizeof(ArenaBlock) + arenaBlock->blockCapacity);
+        std::free(arenaBlock);
+    }
+    static void* AllocateFromArena(LinearArena& arena, size_t memorySize, size_t memoryAlignment)
+    {
+        // Validate Request
+        if (memorySize == 0 || memoryAlignment == 0 || (memoryAlignment & (memoryAlignment - 1)) != 0) return nullptr;
+        size_t requestSize = memorySize + memoryAlignment - 1;
+
+        while (true)
+        {
+            // Fast Path, Bump Current Block Without Locking [Announced So Reset Can Wait For It]
+            arena.activeBumps.fetch_add(1, std::memory_order_seq_cst);
+            ArenaBlock* arenaBlock = arena.currentBlock.load(std::memory_order_seq_cst);
+            if (arenaBlock)
+            {
+                size_t blockOffset = arenaBlock->blockOffset.fetch_add(requestSize, std::memory_order_relaxed);
+                if (blockOffset + requestSize <= arenaBlock->blockCapacity)
+                {
+                    uintptr_t memoryAddress = uintptr_t(arenaBlock->GetData() + blockOffset);
+                    arena.activeBumps.fetch_sub(1, std::memory_order_release);
+                    return reinterpret_cast<void*>((memoryAddress + memoryAlignment - 1) & ~uintptr_t(memoryAlignment - 1));
+                }
+            }
+            arena.activeBumps.fetch_sub(1, std::memory_order_release);
+
+            // Slow Path, Chain New Block Unless Another Thread Already Did
+            std::lock_guard<std::mutex> lock(arena.arenaMutex);
+            if (arena.arenaReleased) return nullptr;
+            if (arena.currentBlock.load(std::memory_order_relaxed) != arenaBlock) continue;
+            ArenaBlock* newBlock = CreateArenaBlock(arena, std::max(arena.blockSize, requestSize));
+            if (!newBlock) return nullptr;
+            newBlock->previousBlock = arenaBlock;
+            arena.currentBlock.store(newBlock, std::memory_order_release);
+        }
+    }
+    static JenovaArenaAllocator::ArenaStatistics CollectArenaStatistics(LinearArena& arena)
+    {
+        JenovaArenaAllocator::ArenaStatistics arenaStatistics;
+        for (ArenaBlock* arenaBlock = arena.currentBlock.load(std::memory_order_acquire); arenaBlock; arenaBlock = arenaBlock->previousBlock)
+        {
+            arenaStatistics.usedBytes += std::min(arenaBlock->blockOffset.load(std::memory_order_relaxed), arenaBlock->blockCapacity);
+            arenaStatistics.blockCount++;
+        }
+        arenaStatistics.reservedBytes = arena.reservedBytes;
+        arenaStatistics.peakUsedBytes = std::max(arena.peakUsedBytes, arenaStatistics.usedBytes);
+        return arenaStatistics;
+    }
+    static ArenaBlock* DetachArenaBlocks(LinearArena& arena)
+    {
+        // Unpublish The Chain, Then Wait Out Bumps That Loaded It Before Touching Any Block
+        ArenaBlock* arenaBlock = arena.currentBlock.exchange(nullptr, std::memory_order_seq_cst);
+        while (arena.activeBumps.load(std::memory_order_seq_cst) != 0) std::this_thread::yield();
+        return arenaBlock;
+    }
+    static void ResetLinearArena(LinearArena& arena)
+    {
+        std::lock_guard<std::mutex> lock(arena.arenaMutex);
+        JenovaArenaAllocator::ArenaStatistics arenaStatistics = CollectArenaStatistics(arena);
+        arena.peakUsedBytes = arenaStatistics.peakUsedBytes;
+        ArenaBlock* arenaBlock = DetachArenaBlocks(arena);
+        if (!arenaBlock) return;
+
+        // Single Block, Rewind
+        if (arenaBlock->previousBlock == nullptr)
+        {
+            arenaBlock->blockOffset.store(0, std::memory_order_relaxed);
+            arena.currentBlock.store(arenaBlock, std::memory_order_release);
+            return;
+        }
+
+        // Chained Blocks, Coalesce Into One Block Sized For The Whole Chain
+        size_t coalescedCapacity = 0;
+        while (arenaBlock)
+        {
+            ArenaBlock* previousBlock = arenaBlock->previousBlock;
+            coalescedCapacity += arenaBlock->blockCapacity;
+            DestroyArenaBlock(arena, arenaBlock);
+            arenaBlock = previousBlock;
+        }
+        arena.currentBlock.store(CreateArenaBlock(arena, coalescedCapacity), std::memory_order_release);
+    }
+    static void ReleaseLinearArena(LinearArena& arena)
+    {
+        std::lock_guard<std::mutex> lock(arena.arenaMutex);
+        arena.arenaReleased = true;
+        ArenaBlock* arenaBlock = DetachArenaBlocks(arena);
+        while (arenaBlock)
+        {
+            ArenaBlock* previousBlock = arenaBlock->previousBlock;
+            DestroyArenaBlock(arena, arenaBlock);
+            arenaBlock = previousBlock;
+        }
+    }
+
+    // Object Pool Utilities
+    static size_t GetPoolClassIndex(size_t objectSize)
+    {
+        size_t classIndex = 0;
+        while ((PoolMinObjectSize << classIndex) < objectSize) classIndex++;
+        return classIndex;
+    }
+    static bool RefillPoolCache(size_t classIndex)
+    {
+        PoolDepot& poolDepot = poolDepots[classIndex];
+        std::lock_guard<std::mutex> lock(poolDepot.depotMutex);
+
+        // Take A Batch From Depot
+        if (poolDepot.freeObjects)
+        {
+            for (size_t i = 0; i < jenova::GlobalSettings::ObjectPoolRefillCount && poolDepot.freeObjects; i++)
+            {
+                FreeObject* freeObject = poolDepot.freeObjects;
+                poolDepot.freeObjects = freeObject->nextObject;
+                poolDepot.freeCount--;
+                freeObject->nextObject = threadPoolCache.freeObjects[classIndex];
+                threadPoolCache.freeObjects[classIndex] = freeObject;
+                threadPoolCache.freeCounts[classIndex]++;
+            }
+            return true;
+        }
+
+        // Depot Is Empty, Carve A New Block Into The Thread Cache
+        size_t objectSize = PoolMinObjectSize << classIndex;
+        uint8_t* poolBlock = static_cast<uint8_t*>(std::malloc(jenova::GlobalSettings::ObjectPoolBlockSize));
+        if (!poolBlock) return false;
+        poolDepot.poolBlocks.push_back(poolBlock);
+        JenovaMemoryTracker::TrackAllocation(jenova::MemoryTag::ObjectPools, jenova::GlobalSettings::ObjectPoolBlockSize);
+        for (size_t objectOffset = 0; objectOffset + objectSize <= jenova::GlobalSettings::ObjectPoolBlockSize; objectOffset += objectSize)
+        {
+            FreeObject* freeObject = reinterpret_cast<FreeObject*>(poolBlock + objectOffset);
+            freeObject->nextObject = threadPoolCache.freeObjects[classIndex];
+            threadPoolCache.freeObjects[classIndex] = freeObject;
+            threadPoolCache.freeCounts[classIndex]++;
+        }
+        return true;
+    }
+    static void ReturnToPoolDepot(ThreadPoolCache& poolCache, size_t classIndex, size_t objectCount)
+    {
+        PoolDepot& poolDepot = poolDepots[classIndex];
+        std::lock_guard<std::mutex> lock(poolDepot.depotMutex);
+        for (size_t i = 0; i < objectCount && poolCache.freeObjects[classIndex]; i++)
+        {
+            FreeObject* freeObject = poolCache.freeObjects[classIndex];
+            poolCache.freeObjects[classIndex] = freeObject->nextObject;
+            poolCache.freeCounts[classIndex]--;
+            freeObject->nextObject = poolDepot.freeObjects;
+            poolDepot.freeObjects = freeObject;
+            poolDepot.freeCount++;
+        }
+    }
+    ThreadPoolCache::~ThreadPoolCache()
+    {
+        // Hand Cached Objects Back So Other Threads Can Reuse Them
+        for (size_t classIndex = 0; classIndex < PoolClassCount; classIndex++) ReturnToPoolDepot(*this, classIndex, freeCounts[classIndex]);
+    }
+}
+
+// Jenova Arena Allocator Implementation
+using namespace jenova::arenas;
+void* JenovaArenaAllocator::AllocateFrameMemory(size_t memorySize, size_t memoryAlignment)
+{
+    return AllocateFromArena(frameArena, memorySize, memoryAlignment);
+}
+void JenovaArenaAllocator::ResetFrameArena()
+{
+    ResetLinearArena(frameArena);
+}
+void* JenovaArenaAllocator::AllocateArenaMemory(const char* arenaName, size_t memorySize, size_t memoryAlignment)
+{
+    if (!arenaName) return nullptr;
+    std::shared_ptr<LinearArena> namedArena;
+    {
+        std::lock_guard<std::mutex> lock(namedArenasMutex);
+        auto& arenaEntry = namedArenas[arenaName];
+        if (!arenaEntry) arenaEntry = std::make_shared<LinearArena>(jenova::MemoryTag::NamedArenas, jenova::GlobalSettings::NamedArenaBlockSize);
+        namedArena = arenaEntry;
+    }
+    return AllocateFromArena(*namedArena, memorySize, memoryAlignment);
+}
+bool JenovaArenaAllocator::ResetArena(const char* arenaName)
+{
+    if (!arenaName) return false;
+    std::lock_guard<std::mutex> lock(namedArenasMutex);
+    auto arenaEntry = namedArenas.find(arenaName);
+    if (arenaEntry == namedArenas.end()) return false;
+    ResetLinearArena(*arenaEntry->second);
+    return true;
+}
+bool JenovaArenaAllocator::ReleaseArena(const char* arenaName)
+{
+    if (!arenaName) return false;
+    std::lock_guard<std::mutex> lock(namedArenasMutex);
+    auto arenaEntry = namedArenas.find(arenaName);
+    if (arenaEntry == namedArenas.end()) return false;
+    ReleaseLinearArena(*arenaEntry->second);
+    namedArenas.erase(arenaEntry);
+    return true;
+}
+void JenovaArenaAllocator::ReleaseNamedArenas()
+{
+    std::lock_guard<std::mutex> lock(namedArenasMutex);
+    if (namedArenas.empty()) return;
+    JENOVA_VERBOSE("Releasing %zu Named Arenas.", namedArenas.size());
+    for (auto& namedArena : namedArenas) ReleaseLinearArena(*namedArena.second);
+    namedArenas.clear();
+}
+void* JenovaArenaAllocator::AllocatePoolObject(size_t objectSize)
+{
+    // Oversized Objects Bypass Pools
+    if (objectSize == 0) return nullptr;
+    if (objectSize > PoolMaxObjectSize) return std::malloc(objectSize);
+
+    // Pop From Thread Cache
+    size_t classIndex = GetPoolClassIndex(objectSize);
+    if (!threadPoolCache.freeObjects[classIndex] && !RefillPoolCache(classIndex)) return nullptr;
+    FreeObject* freeObject = threadPoolCache.freeObjects[classIndex];
+    threadPoolCache.freeObjects[classIndex] = freeObject->nextObject;
+    threadPoolCache.freeCounts[classIndex]--;
+    return freeObject;
+}
+void JenovaArenaAllocator::FreePoolObject(void* objectPtr, size_t objectSize)
+{
+    if (!objectPtr || objectSize == 0) return;
+    if (objectSize > PoolMaxObjectSize)
+    {
+        std::free(objectPtr);
+        return;
+    }
+
+    // Push To Thread Cache, Hand Half Back Once It Grows Past Two Batches
+    size_t classIndex = GetPoolClassIndex(objectSize);
+    FreeObject* freeObject = static_cast<FreeObject*>(objectPtr);
+    freeObject->nextObject = threadPoolCache.freeObjects[classIndex];
+    threadPoolCache.freeObjects[classIndex] = freeObject;
+    if (++threadPoolCache.freeCounts[classIndex] > jenova::GlobalSettings::ObjectPoolRefillCount * 2)
+    {
+        ReturnToPoolDepot(threadPoolCache, classIndex, jenova::GlobalSettings::ObjectPoolRefillCount);
+    }
+}
+JenovaArenaAllocator::ArenaStatistics JenovaArenaAllocator::GetFrameArenaStatistics()
+{
+    std::lock_guard<std::mutex> lock(frameArena.arenaMutex);
+    return CollectArenaStatistics(frameArena);
+}
+Dictionary JenovaArenaAllocator::GetAllocatorReport()
+{
+    auto SerializeArenaStatistics = [](const ArenaStatistics& arenaStatistics)
+    {
+        Dictionary arenaReport;
+        arenaReport["Used"] = int64_t(arenaStatistics.usedBytes);
+        arenaReport["Peak"] = int64_t(arenaStatistics.peakUsedBytes);
+        arenaReport["Reserved"] = int64_t(arenaStatistics.reservedBytes);
+        arenaReport["Blocks"] = int64_t(arenaStatistics.blockCount);
+        return arenaReport;
+    };
+
+    // Frame Arena
+    Dictionary allocatorReport;
+    allocatorReport["FrameArena"] = SerializeArenaStatistics(GetFrameArenaStatistics());
+
+    // Named Arenas
+    Dictionary namedArenasReport;
+    {
+        std::lock_guard<std::mutex> lock(namedArenasMutex);
+        for (auto& namedArena : namedArenas)
+        {
+            std::lock_guard<std::mutex> arenaLock(namedArena.second->arenaMutex);
+            namedArenasReport[String(namedArena.first.c_str())] = SerializeArenaStatistics(CollectArenaStatistics(*namedArena.second));
+        }
+    }
+    allocatorReport["NamedArenas"] = namedArenasReport;
+
+    // Object Pools
+    Dictionary objectPoolsReport;
+    for (size_t classIndex = 0; classIndex < PoolClassCount; classIndex++)
+    {
+        std::lock_guard<std::mutex> lock(poolDepots[classIndex].depotMutex);
+        Dictionary poolReport;
+        poolReport["Reserved"] = int64_t(poolDepots[classIndex].poolBlocks.size() * jenova::GlobalSettings::ObjectPoolBlockSize);
+        poolReport["Blocks"] = int64_t(poolDepots[classIndex].poolBlocks.size());
+        poolReport["DepotFreeObjects"] = int64_t(poolDepots[classIndex].freeCount);
+        objectPoolsReport[int64_t(PoolMinObjectSize << classIndex)] = poolReport;
+    }
+    allocatorReport["ObjectPools"] = objectPoolsReport;
+    return allocatorReport;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Arena Allocator Definition
+/*
+    Scratch Memory For Scripts. The Frame Arena Is A Lock-Free Bump Allocator Reset After RuntimeEvent::FrameEnd,
+    Memory Taken From It Must Not Be Held Across Frames. Reset And Release Unpublish The Block Chain And Wait For
+    In-Flight Bumps Before Rewinding Or Freeing It. Named Arenas Use The Same Bump Path, Live Until Reset Or
+    Released By Name And Are All Released In Bulk When The Module Unloads Or Reloads, Allocations Racing A Release
+    Keep The Arena Alive And Return Null. Object Pools Serve Fixed Size
+    Classes From Thread-Local Free Lists Refilled In Batches From A Shared Depot. All Reserved Blocks Are Reported
+    To JenovaMemoryTracker Under FrameArena, NamedArenas And ObjectPools.
+*/
+class JenovaArenaAllocator
+{
+public:
+    // Allocator Structures
+    struct ArenaStatistics
+    {
+        size_t usedBytes = 0;
+        size_t peakUsedBytes = 0;
+        size_t reservedBytes = 0;
+        size_t blockCount = 0;
+    };
+
+public:
+    static void* AllocateFrameMemory(size_t memorySize, size_t memoryAlignment);
+    static void ResetFrameArena();
+    static void* AllocateArenaMemory(const char* arenaName, size_t memorySize, size_t memoryAlignment);
+    static bool ResetArena(const char* arenaName);
+    static bool ReleaseArena(const char* arenaName);
+    static void ReleaseNamedArenas();
+    static void* AllocatePoolObject(size_t objectSize);
+    static void FreePoolObject(void* objectPtr, size_t objectSize);
+    static ArenaStatistics GetFrameArenaStatistics();
+    static Dictionary GetAllocatorReport();
+};
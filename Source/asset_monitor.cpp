@@ -16,7 +16,16 @@
 #include "Jenova.hpp"
 
 // Third-Party SDK
+#ifdef TARGET_PLATFORM_WINDOWS
 #include <FileWatch/FileWatch.hpp>
+#endif
+
+// Linux Watcher SDK
+#ifdef TARGET_PLATFORM_LINUX
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#endif
 
 // Helpers
 static String GetCallbackEventStringName(jenova::AssetMonitor::CallbackEvent callbackEvent)
@@ -37,11 +46,413 @@ static String GetCallbackEventStringName(jenova::AssetMonitor::CallbackEvent cal
 		return "Unknown";
 	}
 }
+#ifdef TARGET_PLATFORM_LINUX
+static std::string CleanTemporaryPath(const std::string& filePath)
+{
+	// Editors Save Through Temporary Siblings Like name-XXXXXX.ext, Same Result As Matching (.*?)(-[A-Za-z0-9]{6})(\.[^.]+)?
+	auto IsHashSuffix = [&](size_t suffixEnd) -> bool
+	{
+		if (suffixEnd < 7 || filePath[suffixEnd - 7] != '-') return false;
+		for (size_t i = suffixEnd - 6; i < suffixEnd; i++) if (!std::isalnum(static_cast<unsigned char>(filePath[i]))) return false;
+		return true;
+	};
+	size_t extensionStart = filePath.find_last_of('.');
+	std::string cleanedPath;
+	if (extensionStart != std::string::npos && extensionStart + 1 < filePath.size() && IsHashSuffix(extensionStart))
+	{
+		cleanedPath = filePath.substr(0, extensionStart - 7) + filePath.substr(extensionStart);
+	}
+	else if (IsHashSuffix(filePath.size())) cleanedPath = filePath.substr(0, filePath.size() - 7);
+	else return filePath;
+
+	// Only A Vanished Temporary With An Existing Sibling Is Redirected [Keeps Real Files Like enemy-player.cpp]
+	std::error_code existsError;
+	if (std::filesystem::exists(filePath, existsError) || !std::filesystem::exists(cleanedPath, existsError)) return filePath;
+	return cleanedPath;
+}
+#endif
+
+static std::vector<std::string> ParseFilterList(const String& filterList)
+{
+	// Filters Are Separated By Semicolons [*.cpp;*.hpp;*.h]
+	std::vector<std::string> filters;
+	for (const String& filter : filterList.split(";", false))
+	{
+		String trimmedFilter = filter.strip_edges().replace("\\", "/");
+		if (!trimmedFilter.is_empty()) filters.push_back(AS_STD_STRING(trimmedFilter));
+	}
+	return filters;
+}
+static bool IsSameCharacter(char characterA, char characterB)
+{
+	#ifdef TARGET_PLATFORM_WINDOWS
+	return std::tolower(static_cast<unsigned char>(characterA)) == std::tolower(static_cast<unsigned char>(characterB));
+	#else
+	return characterA == characterB;
+	#endif
+}
+static bool MatchGlobPattern(const char* globPattern, const char* targetText)
+{
+	// Supports *, ? And ** [Trailing /** Also Matches The Directory Itself]
+	while (*globPattern)
+	{
+		if (globPattern[0] == '*' && globPattern[1] == '*')
+		{
+			globPattern += 2;
+			bool isSegmentStart = *globPattern == '/';
+			if (isSegmentStart) globPattern++;
+			if (!*globPattern) return true;
+			for (const char* textPtr = targetText; ; textPtr++)
+			{
+				if ((!isSegmentStart || textPtr == targetText || textPtr[-1] == '/') && MatchGlobPattern(globPattern, textPtr)) return true;
+				if (!*textPtr) return false;
+			}
+		}
+		if (*globPattern == '*')
+		{
+			globPattern++;
+			for (const char* textPtr = targetText; ; textPtr++)
+			{
+				if (MatchGlobPattern(globPattern, textPtr)) return true;
+				if (!*textPtr || *textPtr == '/') return false;
+			}
+		}
+		if (!*targetText) return strcmp(globPattern, "/**") == 0;
+		if (*globPattern == '?' ? *targetText == '/' : !IsSameCharacter(*globPattern, *targetText)) return false;
+		globPattern++;
+		targetText++;
+	}
+	return !*targetText;
+}
+static bool MatchFilterList(const std::vector<std::string>& filters, const std::string& relativePath)
+{
+	// Filters Without Separator Match File Name, Others Match Path Relative To Watch Root
+	size_t nameStart = relativePath.find_last_of('/');
+	const char* fileName = relativePath.c_str() + (nameStart == std::string::npos ? 0 : nameStart + 1);
+	for (const std::string& filter : filters)
+	{
+		if (MatchGlobPattern(filter.c_str(), filter.find('/') == std::string::npos ? fileName : relativePath.c_str())) return true;
+	}
+	return false;
+}
+
+// Structures
+struct WatchRoot
+{
+	std::string rootPath;
+	std::string watchedFileName;
+	std::vector<std::string> includeFilters;
+	std::vector<std::string> excludeFilters;
+	bool isRecursive = false;
+	bool IsExcluded(const std::string& relativePath) const
+	{
+		return MatchFilterList(excludeFilters, relativePath);
+	}
+	bool IsAccepted(const std::string& targetPath, bool isWatchedDirectory) const
+	{
+		// Resolve Path Relative To Root
+		if (targetPath.size() <= rootPath.size() || targetPath.compare(0, rootPath.size(), rootPath) != 0 || targetPath[rootPath.size()] != '/') return false;
+		std::string relativePath = targetPath.substr(rootPath.size() + 1);
+		if (!watchedFileName.empty()) return relativePath == watchedFileName;
+		if (!isRecursive && relativePath.find('/') != std::string::npos) return false;
+		if (IsExcluded(relativePath)) return false;
+		if (isWatchedDirectory || includeFilters.empty()) return true;
+		return MatchFilterList(includeFilters, relativePath);
+	}
+};
+struct MonitorEvent
+{
+	std::string targetPath;
+	jenova::AssetMonitor::CallbackEvent callbackEvent;
+	std::chrono::steady_clock::time_point eventTime;
+	MonitorEvent* nextEvent = nullptr;
+};
+struct CoalescedEvent
+{
+	jenova::AssetMonitor::CallbackEvent firstEvent;
+	jenova::AssetMonitor::CallbackEvent lastEvent;
+	std::chrono::steady_clock::time_point firstEventTime;
+	std::chrono::steady_clock::time_point lastEventTime;
+	bool hasRemoval = false;
+};
+
+struct MonitorMetrics
+{
+	std::atomic<uint64_t> receivedEvents = 0;
+	std::atomic<uint64_t> filteredEvents = 0;
+	std::atomic<uint64_t> queueOverflows = 0;
+	std::atomic<uint64_t> coalescedEvents = 0;
+	std::atomic<uint64_t> droppedEvents = 0;
+	std::atomic<uint64_t> deliveredEvents = 0;
+	std::atomic<uint64_t> unwatchedDirectories = 0;
+};
 
 // Global Storage
-Vector<filewatch::FileWatch<std::string>*> assetMonitors;
 Vector<jenova::AssetMonitor::AssetMonitorCallback> monitorCallbacks;
-std::unordered_map<std::string, std::chrono::system_clock::time_point> lastRead;
+static MonitorMetrics monitorMetrics;
+static std::vector<std::shared_ptr<WatchRoot>> watchRoots;
+static std::atomic<MonitorEvent*> pendingEvents = nullptr;
+static std::unordered_map<std::string, CoalescedEvent> coalescedEvents;
+static std::mutex watchMutex;
+static std::atomic<size_t> coalesceWindowMilliseconds = jenova::GlobalSettings::AssetMonitorCoalesceWindow;
+#ifdef TARGET_PLATFORM_WINDOWS
+static std::vector<filewatch::FileWatch<std::string>*> assetMonitors;
+#endif
+#ifdef TARGET_PLATFORM_LINUX
+static int inotifyDescriptor = -1;
+static int wakeDescriptor = -1;
+static std::thread watcherThread;
+struct WatchedDirectory
+{
+	std::string directoryPath;
+	std::vector<std::shared_ptr<WatchRoot>> watchRoots;
+};
+static std::unordered_map<int, WatchedDirectory> watchedDirectories;
+#endif
+
+// Event Queue [Multiple Producers, Main Thread Takes Whole List]
+static void PushMonitorEvent(const std::string& targetPath, jenova::AssetMonitor::CallbackEvent callbackEvent)
+{
+	MonitorEvent* monitorEvent = new MonitorEvent{ targetPath, callbackEvent, std::chrono::steady_clock::now() };
+	monitorEvent->nextEvent = pendingEvents.load(std::memory_order_relaxed);
+	while (!pendingEvents.compare_exchange_weak(monitorEvent->nextEvent, monitorEvent, std::memory_order_release, std::memory_order_relaxed));
+}
+static MonitorEvent* TakeMonitorEvents()
+{
+	// Queue Is Newest First, Reverse To Arrival Order
+	MonitorEvent* monitorEvents = pendingEvents.exchange(nullptr, std::memory_order_acquire);
+	MonitorEvent* orderedEvents = nullptr;
+	while (monitorEvents)
+	{
+		MonitorEvent* nextEvent = monitorEvents->nextEvent;
+		monitorEvents->nextEvent = orderedEvents;
+		orderedEvents = monitorEvents;
+		monitorEvents = nextEvent;
+	}
+	return orderedEvents;
+}
+static bool IsRemovalEvent(jenova::AssetMonitor::CallbackEvent callbackEvent)
+{
+	return callbackEvent == jenova::AssetMonitor::CallbackEvent::Removed || callbackEvent == jenova::AssetMonitor::CallbackEvent::RenamedOld;
+}
+static bool ResolveCoalescedEvent(const std::string& targetPath, const CoalescedEvent& coalescedEvent, jenova::AssetMonitor::CallbackEvent& resolvedEvent)
+{
+	// Resolve Burst Against Final File State
+	using CallbackEvent = jenova::AssetMonitor::CallbackEvent;
+	std::error_code existsError;
+	bool isPresent = std::filesystem::exists(targetPath, existsError);
+	bool isCreated = coalescedEvent.firstEvent == CallbackEvent::Added || coalescedEvent.firstEvent == CallbackEvent::RenamedNew;
+	if (!isPresent)
+	{
+		// Created And Gone Within Window [Temporary Files]
+		if (isCreated) return false;
+		resolvedEvent = IsRemovalEvent(coalescedEvent.lastEvent) ? coalescedEvent.lastEvent : CallbackEvent::Removed;
+		return true;
+	}
+
+	// Replaced Or Recreated [Rename-Over-Write, Delete Then Write]
+	if (coalescedEvent.hasRemoval) resolvedEvent = CallbackEvent::Modified;
+	else if (isCreated) resolvedEvent = coalescedEvent.firstEvent;
+	else resolvedEvent = CallbackEvent::Modified;
+	return true;
+}
+
+// Shared Event Filtering [Runs On Watcher Thread]
+static void FilterMonitorEvent(const std::vector<std::shared_ptr<WatchRoot>>& eventRoots, const std::string& targetPath, jenova::AssetMonitor::CallbackEvent callbackEvent)
+{
+	monitorMetrics.receivedEvents.fetch_add(1, std::memory_order_relaxed);
+	#ifdef TARGET_PLATFORM_LINUX
+	std::string solvedPath = CleanTemporaryPath(targetPath);
+	#else
+	const std::string& solvedPath = targetPath;
+	#endif
+	for (const auto& watchRoot : eventRoots)
+	{
+		if (!watchRoot->IsAccepted(solvedPath, false)) continue;
+		PushMonitorEvent(solvedPath, callbackEvent);
+		return;
+	}
+	monitorMetrics.filteredEvents.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Linux Watcher Thread
+#ifdef TARGET_PLATFORM_LINUX
+static void AddDirectoryWatch(const std::shared_ptr<WatchRoot>& watchRoot, const std::string& directoryPath, bool reportExistingFiles)
+{
+	// Watch Descriptor Budget
+	if (watchedDirectories.size() >= jenova::GlobalSettings::AssetMonitorWatchBudget)
+	{
+		if (monitorMetrics.unwatchedDirectories.fetch_add(1, std::memory_order_relaxed) == 0)
+		{
+			jenova::Warning("Jenova Asset Monitor", "Watch Budget (%zu) Exhausted, Skipping %s And Further Directories.", jenova::GlobalSettings::AssetMonitorWatchBudget, directoryPath.c_str());
+		}
+		return;
+	}
+
+	// Add Watch [Same Directory From Another Root Shares Its Descriptor]
+	int watchDescriptor = inotify_add_watch(inotifyDescriptor, directoryPath.c_str(), IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR);
+	if (watchDescriptor == -1)
+	{
+		jenova::Warning("Jenova Asset Monitor", "Failed to Watch %s (%s).", directoryPath.c_str(), strerror(errno));
+		return;
+	}
+	WatchedDirectory& watchedDirectory = watchedDirectories[watchDescriptor];
+	watchedDirectory.directoryPath = directoryPath;
+	if (std::find(watchedDirectory.watchRoots.begin(), watchedDirectory.watchRoots.end(), watchRoot) == watchedDirectory.watchRoots.end())
+	{
+		watchedDirectory.watchRoots.push_back(watchRoot);
+	}
+
+	// Walk Subdirectories Unless Excluded [Symlinks Are Not Followed, Non-Throwing Increment As Entries May Vanish Mid-Walk]
+	if (!watchRoot->isRecursive && !reportExistingFiles) return;
+	std::error_code iteratorError;
+	std::filesystem::directory_iterator directoryIterator(directoryPath, iteratorError);
+	for (; !iteratorError && directoryIterator != std::filesystem::directory_iterator(); directoryIterator.increment(iteratorError))
+	{
+		const std::filesystem::directory_entry& directoryEntry = *directoryIterator;
+		std::string entryPath = directoryEntry.path().generic_string();
+		std::error_code entryError;
+		bool isDirectory = directoryEntry.is_directory(entryError) && !directoryEntry.is_symlink(entryError);
+		if (isDirectory && watchRoot->isRecursive)
+		{
+			if (watchRoot->IsExcluded(entryPath.substr(watchRoot->rootPath.size() + 1))) continue;
+			AddDirectoryWatch(watchRoot, entryPath, reportExistingFiles);
+		}
+		else if (!isDirectory && reportExistingFiles)
+		{
+			// Files Created Before Watch Existed
+			FilterMonitorEvent({ watchRoot }, entryPath, jenova::AssetMonitor::CallbackEvent::Added);
+		}
+	}
+}
+static void RemoveDirectoryWatches(const std::string& directoryPath)
+{
+	for (auto watchedDirectory = watchedDirectories.begin(); watchedDirectory != watchedDirectories.end();)
+	{
+		const std::string& watchedPath = watchedDirectory->second.directoryPath;
+		bool isUnderDirectory = watchedPath.compare(0, directoryPath.size(), directoryPath) == 0 && (watchedPath.size() == directoryPath.size() || watchedPath[directoryPath.size()] == '/');
+		if (!isUnderDirectory) { ++watchedDirectory; continue; }
+		inotify_rm_watch(inotifyDescriptor, watchedDirectory->first);
+		watchedDirectory = watchedDirectories.erase(watchedDirectory);
+	}
+}
+static void RunWatcherThread()
+{
+	alignas(inotify_event) static char eventBuffer[jenova::GlobalSettings::AssetMonitorReadBufferSize];
+	pollfd pollDescriptors[2] = { { inotifyDescriptor, POLLIN, 0 }, { wakeDescriptor, POLLIN, 0 } };
+	while (true)
+	{
+		// Wait For Events Or Shutdown
+		if (poll(pollDescriptors, 2, -1) < 0)
+		{
+			if (errno == EINTR) continue;
+			break;
+		}
+		if (pollDescriptors[1].revents) break;
+
+		// Read All Pending Events
+		ssize_t readSize = 0;
+		while ((readSize = read(inotifyDescriptor, eventBuffer, sizeof(eventBuffer))) > 0)
+		{
+			std::lock_guard<std::mutex> watchLock(watchMutex);
+			for (char* eventPtr = eventBuffer; eventPtr < eventBuffer + readSize;)
+			{
+				const inotify_event* watchEvent = reinterpret_cast<const inotify_event*>(eventPtr);
+				eventPtr += sizeof(inotify_event) + watchEvent->len;
+
+				// Kernel Queue Overflowed, Events Were Lost
+				if (watchEvent->mask & IN_Q_OVERFLOW)
+				{
+					if (monitorMetrics.queueOverflows.fetch_add(1, std::memory_order_relaxed) == 0) jenova::Warning("Jenova Asset Monitor", "inotify Queue Overflowed, Some Changes Were Missed.");
+					continue;
+				}
+
+				// Resolve Watched Directory [Removed Watches Report IN_IGNORED]
+				auto watchedDirectory = watchedDirectories.find(watchEvent->wd);
+				if (watchedDirectory == watchedDirectories.end()) continue;
+				if (watchEvent->mask & IN_IGNORED)
+				{
+					watchedDirectories.erase(watchedDirectory);
+					continue;
+				}
+				if (watchEvent->len == 0) continue;
+				std::string targetPath = watchedDirectory->second.directoryPath + "/" + std::string(watchEvent->name);
+				std::vector<std::shared_ptr<WatchRoot>> eventRoots = watchedDirectory->second.watchRoots;
+
+				// Resolve Event Type
+				jenova::AssetMonitor::CallbackEvent callbackEvent;
+				if (watchEvent->mask & IN_CREATE) callbackEvent = jenova::AssetMonitor::CallbackEvent::Added;
+				else if (watchEvent->mask & IN_DELETE) callbackEvent = jenova::AssetMonitor::CallbackEvent::Removed;
+				else if (watchEvent->mask & IN_MODIFY) callbackEvent = jenova::AssetMonitor::CallbackEvent::Modified;
+				else if (watchEvent->mask & IN_MOVED_FROM) callbackEvent = jenova::AssetMonitor::CallbackEvent::RenamedOld;
+				else if (watchEvent->mask & IN_MOVED_TO) callbackEvent = jenova::AssetMonitor::CallbackEvent::RenamedNew;
+				else continue;
+
+				// Follow Directory Tree Changes In Recursive Roots
+				bool isDirectory = (watchEvent->mask & IN_ISDIR) != 0;
+				if (isDirectory && callbackEvent == jenova::AssetMonitor::CallbackEvent::RenamedOld) RemoveDirectoryWatches(targetPath);
+				if (isDirectory && (callbackEvent == jenova::AssetMonitor::CallbackEvent::Added || callbackEvent == jenova::AssetMonitor::CallbackEvent::RenamedNew))
+				{
+					for (const auto& watchRoot : eventRoots)
+					{
+						if (!watchRoot->isRecursive || !watchRoot->IsAccepted(targetPath, true)) continue;
+						AddDirectoryWatch(watchRoot, targetPath, true);
+					}
+				}
+				FilterMonitorEvent(eventRoots, targetPath, callbackEvent);
+			}
+		}
+	}
+}
+#endif
+
+// Watch Root Registration
+static bool AddWatchRoot(const std::shared_ptr<WatchRoot>& watchRoot)
+{
+	// Windows Implementation [ReadDirectoryChangesW Per Root Is Recursive, Filters Run In Its Callback]
+	#ifdef TARGET_PLATFORM_WINDOWS
+	std::string watchPath = watchRoot->watchedFileName.empty() ? watchRoot->rootPath : watchRoot->rootPath + "/" + watchRoot->watchedFileName;
+	auto assetMonitor = new filewatch::FileWatch<std::string>(watchPath, [watchRoot](const std::string& path, const filewatch::Event change_type)
+	{
+		std::string targetPath = std::filesystem::path(path).is_absolute() ? std::filesystem::path(path).generic_string() : watchRoot->rootPath + "/" + std::filesystem::path(path).generic_string();
+		FilterMonitorEvent({ watchRoot }, targetPath, jenova::AssetMonitor::CallbackEvent(change_type));
+	});
+	std::lock_guard<std::mutex> watchLock(watchMutex);
+	assetMonitors.push_back(assetMonitor);
+	watchRoots.push_back(watchRoot);
+	#endif
+
+	// Linux Implementation [One inotify Instance And Thread For All Roots]
+	#ifdef TARGET_PLATFORM_LINUX
+	std::lock_guard<std::mutex> watchLock(watchMutex);
+	if (inotifyDescriptor == -1)
+	{
+		inotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		wakeDescriptor = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (inotifyDescriptor == -1 || wakeDescriptor == -1)
+		{
+			jenova::Error("Jenova Asset Monitor", "Failed to Initialize inotify Watcher (%s).", strerror(errno));
+			if (inotifyDescriptor != -1) close(inotifyDescriptor);
+			if (wakeDescriptor != -1) close(wakeDescriptor);
+			inotifyDescriptor = wakeDescriptor = -1;
+			return false;
+		}
+		watcherThread = std::thread(RunWatcherThread);
+	}
+	if (!std::filesystem::is_directory(watchRoot->rootPath))
+	{
+		jenova::Error("Jenova Asset Monitor", "Failed to Watch %s, Directory Doesn't Exist.", watchRoot->rootPath.c_str());
+		return false;
+	}
+	size_t watchCount = watchedDirectories.size();
+	AddDirectoryWatch(watchRoot, watchRoot->rootPath, false);
+	watchRoots.push_back(watchRoot);
+	JENOVA_VERBOSE("Jenova Asset Monitor Watching %s With %zu New Descriptors.", watchRoot->rootPath.c_str(), watchedDirectories.size() - watchCount);
+	#endif
+
+	// All Good
+	return true;
+}
 
 // Singleton Instance
 JenovaAssetMonitor* jnvam_singleton = nullptr;
@@ -68,10 +479,13 @@ void JenovaAssetMonitor::deinit()
 void JenovaAssetMonitor::_bind_methods()
 {
 	ClassDB::bind_static_method("JenovaAssetMonitor", D_METHOD("GetInstance"), &JenovaAssetMonitor::get_singleton);
-	ClassDB::bind_method(D_METHOD("AddDirectory"), &JenovaAssetMonitor::AddDirectory);
+	ClassDB::bind_method(D_METHOD("AddDirectory", "directoryPath", "includeFilters", "excludeFilters", "isRecursive"), &JenovaAssetMonitor::AddDirectory, DEFVAL(""), DEFVAL(""), DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("AddDirectories"), &JenovaAssetMonitor::AddDirectories);
 	ClassDB::bind_method(D_METHOD("AddFile"), &JenovaAssetMonitor::AddFile);
 	ClassDB::bind_method(D_METHOD("AddFiles"), &JenovaAssetMonitor::AddFiles);
+	ClassDB::bind_method(D_METHOD("GetMonitorMetrics"), &JenovaAssetMonitor::GetMonitorMetrics);
+	ClassDB::bind_method(D_METHOD("SetCoalesceWindow", "milliseconds"), &JenovaAssetMonitor::SetCoalesceWindow);
+	ClassDB::bind_method(D_METHOD("GetCoalesceWindow"), &JenovaAssetMonitor::GetCoalesceWindow);
 	ADD_SIGNAL(MethodInfo("callback", PropertyInfo(Variant::STRING, "targetPath"), PropertyInfo(Variant::STRING, "callbackEvent")));
 }
 
@@ -82,55 +496,17 @@ JenovaAssetMonitor* JenovaAssetMonitor::get_singleton()
 }
 
 // Jenova Asset Monitor Implementation
-bool JenovaAssetMonitor::AddDirectory(const String& directoryPath) 
+bool JenovaAssetMonitor::AddDirectory(const String& directoryPath, const String& includeFilters, const String& excludeFilters, bool isRecursive)
 {
-	// Create New Asset Monitor
-	#ifdef _MSC_VER
-	auto assetMonitor = new filewatch::FileWatch<std::string>(AS_STD_STRING(directoryPath), [](const std::string& path, const filewatch::Event change_type)
-	{
-		if (change_type == filewatch::Event::modified)
-		{
-			auto lastWriteTime = std::chrono::clock_cast<std::chrono::system_clock>(std::filesystem::last_write_time(path));
-
-			if (lastRead.find(path) == lastRead.end() || std::chrono::duration_cast<std::chrono::milliseconds>(lastWriteTime - lastRead[path]).count() > 100)
-			{
-				lastRead[path] = lastWriteTime;
-				for (const auto& callback : monitorCallbacks) callback(AS_GD_STRING(path), jenova::AssetMonitor::CallbackEvent(change_type));
-				JenovaAssetMonitor::get_singleton()->emit_signal("callback", AS_GD_STRING(path), GetCallbackEventStringName(jenova::AssetMonitor::CallbackEvent(change_type)));
-			}
-		}
-		else
-		{
-			for (const auto& callback : monitorCallbacks) callback(AS_GD_STRING(path), jenova::AssetMonitor::CallbackEvent(change_type));
-			JenovaAssetMonitor::get_singleton()->emit_signal("callback", AS_GD_STRING(path), GetCallbackEventStringName(jenova::AssetMonitor::CallbackEvent(change_type)));
-		}
-	});
-	#else
-	auto assetMonitor = new filewatch::FileWatch<std::string>(AS_STD_STRING(directoryPath), [](const std::string& path, const filewatch::Event change_type)
-	{
-		// Helper Functions
-		auto CleanPath = [&](std::string& filepath) -> std::string
-		{
-			std::regex pattern(R"((.*?)(-[A-Za-z0-9]{6})(\.[^.]+)?)");
-			std::smatch match;
-			if (std::regex_match(filepath, match, pattern)) { return match[1].str() + match[3].str(); }
-			return filepath;
-		};
-
-		// Somehow Paths On Linux Have a Hash At End Sometimes, Need to Be cleaned
-		std::string solvedPath = path;
-		solvedPath = CleanPath(solvedPath);
-
-		// Rise Callback
-		for (const auto& callback : monitorCallbacks) callback(AS_GD_STRING(solvedPath), jenova::AssetMonitor::CallbackEvent(change_type));
-		JenovaAssetMonitor::get_singleton()->emit_signal("callback", AS_GD_STRING(solvedPath), GetCallbackEventStringName(jenova::AssetMonitor::CallbackEvent(change_type)));
-	});
-	#endif
-
-	// Add to Monitors
-	assetMonitors.push_back(assetMonitor);
-
-	// All Good
+	// Create Watch Root
+	auto watchRoot = std::make_shared<WatchRoot>();
+	watchRoot->rootPath = std::filesystem::path(AS_STD_STRING(directoryPath)).generic_string();
+	while (watchRoot->rootPath.size() > 1 && watchRoot->rootPath.back() == '/') watchRoot->rootPath.pop_back();
+	watchRoot->includeFilters = ParseFilterList(includeFilters);
+	watchRoot->excludeFilters = ParseFilterList(excludeFilters);
+	watchRoot->isRecursive = isRecursive;
+	if (!AddWatchRoot(watchRoot)) return false;
+	StartEventDelivery();
 	return true;
 }
 bool JenovaAssetMonitor::AddDirectories(const PackedStringArray& directoryList) 
@@ -143,8 +519,14 @@ bool JenovaAssetMonitor::AddDirectories(const PackedStringArray& directoryList)
 }
 bool JenovaAssetMonitor::AddFile(const String& filePath) 
 {
-	// Current Implementation Doesn't Require Any Different Behaviour Between Directories and Files
-	return AddDirectory(filePath);
+	// Watch Parent Directory For This Name Only [Survives Files Being Replaced By Rename]
+	std::filesystem::path watchedFilePath(AS_STD_STRING(filePath));
+	auto watchRoot = std::make_shared<WatchRoot>();
+	watchRoot->rootPath = watchedFilePath.parent_path().generic_string();
+	watchRoot->watchedFileName = watchedFilePath.filename().generic_string();
+	if (!AddWatchRoot(watchRoot)) return false;
+	StartEventDelivery();
+	return true;
 }
 bool JenovaAssetMonitor::AddFiles(const PackedStringArray& fileList) 
 {
@@ -170,12 +552,130 @@ bool JenovaAssetMonitor::UnregisterCallback(jenova::AssetMonitor::AssetMonitorCa
 	// All Good
 	return true;
 }
+Dictionary JenovaAssetMonitor::GetMonitorMetrics()
+{
+	Dictionary monitorReport;
+	monitorReport["ReceivedEvents"] = monitorMetrics.receivedEvents.load();
+	monitorReport["FilteredEvents"] = monitorMetrics.filteredEvents.load();
+	monitorReport["CoalescedEvents"] = monitorMetrics.coalescedEvents.load();
+	monitorReport["DroppedEvents"] = monitorMetrics.droppedEvents.load();
+	monitorReport["DeliveredEvents"] = monitorMetrics.deliveredEvents.load();
+	monitorReport["QueueOverflows"] = monitorMetrics.queueOverflows.load();
+	monitorReport["UnwatchedDirectories"] = monitorMetrics.unwatchedDirectories.load();
+	std::lock_guard<std::mutex> watchLock(watchMutex);
+	monitorReport["WatchRoots"] = uint64_t(watchRoots.size());
+	#ifdef TARGET_PLATFORM_LINUX
+	monitorReport["WatchDescriptors"] = uint64_t(watchedDirectories.size());
+	monitorReport["WatchBudget"] = uint64_t(jenova::GlobalSettings::AssetMonitorWatchBudget);
+	#endif
+	return monitorReport;
+}
+void JenovaAssetMonitor::SetCoalesceWindow(int64_t milliseconds)
+{
+	// Negative Values Fall Back To Immediate Delivery
+	coalesceWindowMilliseconds.store(size_t(milliseconds < 0 ? 0 : milliseconds), std::memory_order_relaxed);
+}
+int64_t JenovaAssetMonitor::GetCoalesceWindow()
+{
+	return int64_t(coalesceWindowMilliseconds.load(std::memory_order_relaxed));
+}
+void JenovaAssetMonitor::StartEventDelivery()
+{
+	// Deliver Events Once Per Frame
+	if (isMonitorActive) return;
+	jenova::GetSceneTree()->connect("process_frame", callable_mp_static(&JenovaAssetMonitor::OnProcessFrame));
+	isMonitorActive = true;
+}
 bool JenovaAssetMonitor::PrepareForShutdown()
 {
+	// Stop Frame Delivery
+	if (isMonitorActive && jenova::GetSceneTree())
+	{
+		jenova::GetSceneTree()->disconnect("process_frame", callable_mp_static(&JenovaAssetMonitor::OnProcessFrame));
+	}
+	isMonitorActive = false;
+
+	// Stop Watchers
+	#ifdef TARGET_PLATFORM_WINDOWS
+	for (const auto& assetMonitor : assetMonitors) delete assetMonitor;
+	assetMonitors.clear();
+	#endif
+	#ifdef TARGET_PLATFORM_LINUX
+	if (watcherThread.joinable())
+	{
+		uint64_t wakeValue = 1;
+		if (write(wakeDescriptor, &wakeValue, sizeof(wakeValue)) < 0) jenova::Warning("Jenova Asset Monitor", "Failed to Wake Watcher Thread.");
+		watcherThread.join();
+	}
+	if (inotifyDescriptor != -1) close(inotifyDescriptor);
+	if (wakeDescriptor != -1) close(wakeDescriptor);
+	inotifyDescriptor = wakeDescriptor = -1;
+	watchedDirectories.clear();
+	#endif
+	watchRoots.clear();
+
 	// Clear Resources
 	monitorCallbacks.clear();
-	for (const auto& assetMonitor : assetMonitors) delete assetMonitor;
-	
+	for (MonitorEvent* monitorEvent = TakeMonitorEvents(); monitorEvent;)
+	{
+		MonitorEvent* nextEvent = monitorEvent->nextEvent;
+		delete monitorEvent;
+		monitorEvent = nextEvent;
+	}
+	coalescedEvents.clear();
+
 	// All Good
 	return true;
-}
\ No newline at end of file
+}
+void JenovaAssetMonitor::OnProcessFrame()
+{
+	// Merge Queued Events Per Path
+	auto currentTime = std::chrono::steady_clock::now();
+	for (MonitorEvent* monitorEvent = TakeMonitorEvents(); monitorEvent;)
+	{
+		auto [coalescedEntry, isNewBurst] = coalescedEvents.try_emplace(monitorEvent->targetPath);
+		CoalescedEvent& coalescedEvent = coalescedEntry->second;
+		if (isNewBurst)
+		{
+			coalescedEvent.firstEvent = monitorEvent->callbackEvent;
+			coalescedEvent.firstEventTime = monitorEvent->eventTime;
+		}
+		else monitorMetrics.coalescedEvents.fetch_add(1, std::memory_order_relaxed);
+		coalescedEvent.lastEvent = monitorEvent->callbackEvent;
+		coalescedEvent.lastEventTime = monitorEvent->eventTime;
+		coalescedEvent.hasRemoval |= IsRemovalEvent(monitorEvent->callbackEvent);
+		MonitorEvent* nextEvent = monitorEvent->nextEvent;
+		delete monitorEvent;
+		monitorEvent = nextEvent;
+	}
+	if (coalescedEvents.empty()) return;
+
+	// Collect Settled Bursts [Quiet For Coalesce Window] In Arrival Order
+	const auto coalesceWindow = std::chrono::milliseconds(coalesceWindowMilliseconds.load(std::memory_order_relaxed));
+	std::vector<std::pair<std::string, CoalescedEvent>> settledEvents;
+	for (auto coalescedEntry = coalescedEvents.begin(); coalescedEntry != coalescedEvents.end();)
+	{
+		if (currentTime - coalescedEntry->second.lastEventTime < coalesceWindow) { ++coalescedEntry; continue; }
+		settledEvents.emplace_back(coalescedEntry->first, coalescedEntry->second);
+		coalescedEntry = coalescedEvents.erase(coalescedEntry);
+	}
+	std::sort(settledEvents.begin(), settledEvents.end(), [](const auto& eventA, const auto& eventB)
+	{
+		if (eventA.second.firstEventTime != eventB.second.firstEventTime) return eventA.second.firstEventTime < eventB.second.firstEventTime;
+		return eventA.first < eventB.first;
+	});
+
+	// Deliver Batch On Main Thread
+	for (const auto& [targetPath, coalescedEvent] : settledEvents)
+	{
+		jenova::AssetMonitor::CallbackEvent resolvedEvent;
+		if (!ResolveCoalescedEvent(targetPath, coalescedEvent, resolvedEvent))
+		{
+			monitorMetrics.droppedEvents.fetch_add(1, std::memory_order_relaxed);
+			continue;
+		}
+		monitorMetrics.deliveredEvents.fetch_add(1, std::memory_order_relaxed);
+		for (const auto& callback : monitorCallbacks) callback(AS_GD_STRING(targetPath), resolvedEvent);
+		JenovaAssetMonitor::get_singleton()->emit_signal("callback", AS_GD_STRING(targetPath), GetCallbackEventStringName(resolvedEvent));
+	}
+}
@@ -34,6 +34,16 @@ namespace jenova::AssetMonitor
 }
 
 // Jenova Asset Monitor Difinition
+/*
+	One Watcher Thread (inotify On Linux) Pushes Raw Events Into A Lock-Free Queue. Once Per Frame The Main Thread
+	Merges Them Per Path And Delivers Each Burst After It Stays Quiet For The Coalesce Window (Editor Setting
+	jenova/asset_monitor_coalesce_window, Defaults To AssetMonitorCoalesceWindow), So Callbacks And The callback
+	Signal Always Run On Main Thread With Writes Already Finished. On Linux, Events For A Vanished name-XXXXXX.ext
+	Temporary Are Reported Against Its Existing name.ext Sibling.
+	Directories Are Watched Recursively Unless Asked Otherwise. Include/Exclude Filters Are ';' Separated Globs
+	(*, ?, **) Matched Against The File Name, Or Against The Path Relative To The Root When They Contain '/'.
+	Excluded Directories Are Never Watched And Filtering Happens On The Watcher Thread Before Queueing.
+*/
 class JenovaAssetMonitor : public RefCounted
 {
 	GDCLASS(JenovaAssetMonitor, RefCounted);
@@ -52,11 +62,18 @@ public:
 	static void deinit();
 
 public:
-	bool AddDirectory(const String& directoryPath);
+	bool AddDirectory(const String& directoryPath, const String& includeFilters = "", const String& excludeFilters = "", bool isRecursive = true);
 	bool AddDirectories(const PackedStringArray& directoryList);
 	bool AddFile(const String& filePath);
 	bool AddFiles(const PackedStringArray& fileList);
 	bool RegisterCallback(jenova::AssetMonitor::AssetMonitorCallback callback);
 	bool UnregisterCallback(jenova::AssetMonitor::AssetMonitorCallback callback);
+	Dictionary GetMonitorMetrics();
+	void SetCoalesceWindow(int64_t milliseconds);
+	int64_t GetCoalesceWindow();
 	bool PrepareForShutdown();
+
+private:
+	void StartEventDelivery();
+	static void OnProcessFrame();
 };
\ No newline at end of file
@@ -0,0 +1,664 @@
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Benchmark Builds Only
+#ifdef JENOVA_BENCHMARK
+
+// Generated Script Layout [Must Match Jenova.Benchmark.py]
+struct BenchmarkMethod
+{
+    const char* methodName;
+    const char* argumentMix;
+    int argumentCount;
+};
+static constexpr BenchmarkMethod BenchmarkMethods[] =
+{
+    { "BenchVoid",      "void",         0 },
+    { "BenchCaller",    "caller",       0 },
+    { "BenchVariant1",  "variant_x1",   1 },
+    { "BenchVariant4",  "variant_x4",   4 },
+    { "BenchVariant8",  "variant_x8",   8 },
+    { "BenchReturn",    "return",       1 },
+};
+static constexpr char* BenchmarkTouchedScriptMarker = "// Jenova Benchmark Incremental Build Marker";
+static constexpr size_t BenchmarkReaderCounts[] = { 1, 2, 4, 8 };
+
+// Helpers
+static double ElapsedMilliseconds(int64_t beginTime)
+{
+    return double(JenovaTinyProfiler::ReadClock() - beginTime) / 1000000.0;
+}
+static Node* FindNodeByNameRecursive(Node* parentNode, const String& nodeName)
+{
+    if (parentNode->get_name() == nodeName) return parentNode;
+    for (int i = 0; i < parentNode->get_child_count(); i++)
+    {
+        Node* foundNode = FindNodeByNameRecursive(parentNode->get_child(i), nodeName);
+        if (foundNode) return foundNode;
+    }
+    return nullptr;
+}
+static void CollectNodesByClassRecursive(Node* parentNode, const String& className, TypedArray<Node>& classNodes)
+{
+    if (parentNode->is_class(className)) classNodes.append(parentNode);
+    for (int i = 0; i < parentNode->get_child_count(); i++) CollectNodesByClassRecursive(parentNode->get_child(i), className, classNodes);
+}
+static std::vector<Ref<CPPScript>> CollectBenchmarkScripts()
+{
+    std::vector<Ref<CPPScript>> benchmarkScripts;
+    jenova::ResourceCollection cppResources;
+    if (!jenova::CollectScriptsFromFileSystemAndScenes("res://", "cpp", cppResources)) return benchmarkScripts;
+    for (const auto& cppResource : cppResources)
+    {
+        if (!cppResource->is_class(jenova::GlobalSettings::JenovaScriptType)) continue;
+        benchmarkScripts.push_back(Object::cast_to<CPPScript>(cppResource.ptr()));
+    }
+    std::sort(benchmarkScripts.begin(), benchmarkScripts.end(), [](const Ref<CPPScript>& a, const Ref<CPPScript>& b) { return a->get_path() < b->get_path(); });
+    return benchmarkScripts;
+}
+static bool CleanJenovaCache()
+{
+    std::string jenovaCacheDirectory = AS_STD_STRING(jenova::GetJenovaCacheDirectory());
+    if (!std::filesystem::exists(jenovaCacheDirectory)) return true;
+    try
+    {
+        for (const auto& cacheEntry : std::filesystem::directory_iterator(jenovaCacheDirectory)) std::filesystem::remove_all(cacheEntry.path());
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
+// Jenova Benchmark Suite Implementation
+void JenovaBenchmarkSuite::RequestRun(const std::string& requestedOutputFile)
+{
+    isRunRequested = true;
+    outputFile = requestedOutputFile.empty() ? std::string(jenova::GlobalSettings::JenovaBenchmarkResultFile) : requestedOutputFile;
+}
+bool JenovaBenchmarkSuite::IsRunRequested()
+{
+    return isRunRequested;
+}
+bool JenovaBenchmarkSuite::ScheduleRun()
+{
+    // Validate Request
+    if (!isRunRequested || isScheduled) return false;
+
+    // Suite Only Runs Inside Editor [Builder Is Part of Editor Plugin]
+    if (!QUERY_ENGINE_MODE(Editor))
+    {
+        jenova::Error("Jenova Benchmark", "Benchmark Suite Must Run Inside Headless Editor (--headless --editor).");
+        return false;
+    }
+
+    // Wait for First Frame, File System Scan Is Checked Per Frame
+    godot::SceneTree* sceneTree = jenova::GetSceneTree();
+    if (!sceneTree) return false;
+    sceneTree->connect("process_frame", callable_mp_static(&JenovaBenchmarkSuite::OnProcessFrame));
+    isScheduled = true;
+
+    // Verbose
+    jenova::Output("Jenova Benchmark Suite Scheduled, Results Will Be Written To : [color=#70a9d4]%s[/color]", outputFile.c_str());
+    return true;
+}
+void JenovaBenchmarkSuite::OnProcessFrame()
+{
+    // Wait Until Editor File System Is Ready
+    EditorFileSystem* editorFileSystem = EditorInterface::get_singleton()->get_resource_filesystem();
+    if (!editorFileSystem || editorFileSystem->is_scanning()) return;
+
+    // Run Once
+    godot::SceneTree* sceneTree = jenova::GetSceneTree();
+    sceneTree->disconnect("process_frame", callable_mp_static(&JenovaBenchmarkSuite::OnProcessFrame));
+
+    // Run Suite
+    jenova::json_t results;
+    results["Version"] = APP_VERSION;
+    results["Platform"] = QUERY_PLATFORM(Windows) ? "Windows" : QUERY_PLATFORM(Linux) ? "Linux" : "Unknown";
+    results["Timestamp"] = AS_STD_STRING(Time::get_singleton()->get_datetime_string_from_system(true));
+    bool suiteResult = RunSuite(results);
+    results["Succeeded"] = suiteResult;
+
+    // Write Results
+    if (!jenova::WriteStringToFile(String(outputFile.c_str()), String(results.dump(2).c_str())))
+    {
+        jenova::Error("Jenova Benchmark", "Failed to Write Benchmark Results to %s", outputFile.c_str());
+        suiteResult = false;
+    }
+    else jenova::Output("Jenova Benchmark Results Written To : [color=#70a9d4]%s[/color]", outputFile.c_str());
+
+    // Quit Editor
+    sceneTree->quit(suiteResult ? 0 : 1);
+}
+bool JenovaBenchmarkSuite::RunSuite(jenova::json_t& results)
+{
+    // Build Benchmarks Also Produce The Module Used By The Rest
+    if (!BenchmarkBuild(results)) return false;
+
+    // Module Must Be Loaded And Executable
+    if (JenovaInterpreter::GetModuleBaseAddress() == 0)
+    {
+        jenova::Error("Jenova Benchmark", "No Module Loaded After Build, Benchmarks Aborted.");
+        return false;
+    }
+    JenovaInterpreter::SetExecutionState(true);
+
+    // Runtime Benchmarks
+    bool suiteResult = true;
+    suiteResult &= BenchmarkCallFunction(results);
+    suiteResult &= BenchmarkPropertySync(results);
+    suiteResult &= BenchmarkMetadataLookup(results);
+    suiteResult &= BenchmarkProfilerOverhead(results);
+    suiteResult &= BenchmarkGlobalStore(results);
+    suiteResult &= BenchmarkAllocators(results);
+    suiteResult &= BenchmarkSceneIndex(results);
+    suiteResult &= BenchmarkClektron(results);
+    suiteResult &= BenchmarkCompression(results);
+
+    // Deploy Benchmark Reloads Module, Run Last
+    suiteResult &= BenchmarkDatabaseDeploy(results);
+    return suiteResult;
+}
+bool JenovaBenchmarkSuite::BenchmarkBuild(jenova::json_t& results)
+{
+    // Collect Generated Scripts
+    std::vector<Ref<CPPScript>> benchmarkScripts = CollectBenchmarkScripts();
+    if (benchmarkScripts.empty())
+    {
+        jenova::Error("Jenova Benchmark", "No C++ Script Found In Benchmark Project.");
+        return false;
+    }
+    results["Build"]["ScriptCount"] = benchmarkScripts.size();
+
+    // Full Build [Clean Cache]
+    if (!CleanJenovaCache())
+    {
+        jenova::Error("Jenova Benchmark", "Failed to Clean Jenova Cache Before Full Build.");
+        return false;
+    }
+    int64_t beginTime = JenovaTinyProfiler::ReadClock();
+    if (!jenova::BuildProjectImmediately())
+    {
+        jenova::Error("Jenova Benchmark", "Full Build Failed.");
+        return false;
+    }
+    results["Build"]["FullBuildTime"] = ElapsedMilliseconds(beginTime);
+
+    // Incremental Build [Single Script Modified]
+    Ref<CPPScript> touchedScript = benchmarkScripts.front();
+    String originalSource = touchedScript->get_source_code();
+    String touchedSource = originalSource + "\n" + BenchmarkTouchedScriptMarker + "\n";
+    if (!jenova::WriteStringToFile(touchedScript->get_path(), touchedSource))
+    {
+        jenova::Error("Jenova Benchmark", "Failed to Modify Script %s", AS_C_STRING(touchedScript->get_path()));
+        return false;
+    }
+    touchedScript->set_source_code(touchedSource);
+    beginTime = JenovaTinyProfiler::ReadClock();
+    if (!jenova::BuildProjectImmediately())
+    {
+        jenova::Error("Jenova Benchmark", "Incremental Build Failed.");
+        return false;
+    }
+    results["Build"]["IncrementalBuildTime"] = ElapsedMilliseconds(beginTime);
+
+    // Speculative Build [Edit Compiled While Editing, Build Only Links]
+    String editedSource = touchedSource + BenchmarkTouchedScriptMarker + "\n";
+    jenova::BuildServiceMode buildServiceMode = jenova::GlobalStorage::BuildServiceMode;
+    jenova::GlobalStorage::BuildServiceMode = jenova::BuildServiceMode::CompileWhileEditing;
+    jenova::QueueEditedScriptCompile(touchedScript->get_path(), editedSource);
+    JenovaBuildService::WaitForSpeculativeCompiles();
+    jenova::GlobalStorage::BuildServiceMode = buildServiceMode;
+    jenova::WriteStringToFile(touchedScript->get_path(), editedSource);
+    touchedScript->set_source_code(editedSource);
+    beginTime = JenovaTinyProfiler::ReadClock();
+    if (!jenova::BuildProjectImmediately())
+    {
+        jenova::Error("Jenova Benchmark", "Speculative Build Failed.");
+        return false;
+    }
+    results["Build"]["SpeculativeBuildTime"] = ElapsedMilliseconds(beginTime);
+
+    // Restore Modified Script
+    jenova::WriteStringToFile(touchedScript->get_path(), originalSource);
+    touchedScript->set_source_code(originalSource);
+
+    // Unit
+    results["Build"]["Unit"] = "ms";
+    return true;
+}
+bool JenovaBenchmarkSuite::BenchmarkCallFunction(jenova::json_t& results)
+{
+    // Collect Scripts
+    std::vector<Ref<CPPScript>> benchmarkScripts = CollectBenchmarkScripts();
+    if (benchmarkScripts.empty()) return false;
+    std::string scriptUID = AS_STD_STRING(benchmarkScripts.front()->GetScriptIdentity());
+
+    // Create Caller Owner And Arguments [Mixed Variant Payloads]
+    Node* ownerObject = memnew(Node);
+    std::vector<Variant> arguments = { Variant(int64_t(42)), Variant(3.14), Variant(String("Jenova")), Variant(Vector3(1, 2, 3)),
+        Variant(int64_t(7)), Variant(0.5), Variant(String("Benchmark")), Variant(true) };
+    std::vector<const Variant*> argumentPointers;
+    for (const auto& argument : arguments) argumentPointers.push_back(&argument);
+
+    // Measure Per Backend
+    bool benchmarkResult = true;
+    jenova::InterpreterBackend originalBackend = JenovaInterpreter::GetInterpreterBackend();
+    std::vector<std::pair<jenova::InterpreterBackend, const char*>> backends = { { jenova::InterpreterBackend::AsmJIT, "AsmJIT" }, { jenova::InterpreterBackend::TinyCC, "TinyCC" } };
+    for (const auto& backend : backends)
+    {
+        JenovaInterpreter::SetInterpreterBackend(backend.first);
+        for (const auto& benchmarkMethod : BenchmarkMethods)
+        {
+            // Validate Call Once Before Measuring
+            Variant probeResult = JenovaInterpreter::CallFunction(ownerObject, benchmarkMethod.methodName, scriptUID, argumentPointers.data(), benchmarkMethod.argumentCount);
+            if (probeResult.get_type() == Variant::STRING && String(probeResult).begins_with("ERROR::"))
+            {
+                jenova::Warning("Jenova Benchmark", "Call Benchmark [%s:%s] Failed : %s", backend.second, benchmarkMethod.methodName, AS_C_STRING(String(probeResult)));
+                results["CallFunction"][backend.second][benchmarkMethod.argumentMix]["Error"] = AS_STD_STRING(String(probeResult));
+                benchmarkResult = false;
+                continue;
+            }
+
+            // Measure
+            jenova::json_t& sampleResult = results["CallFunction"][backend.second][benchmarkMethod.argumentMix];
+            sampleResult = MeasureLoop(jenova::GlobalSettings::BenchmarkCallIterations, [&]()
+            {
+                JenovaInterpreter::CallFunction(ownerObject, benchmarkMethod.methodName, scriptUID, argumentPointers.data(), benchmarkMethod.argumentCount);
+            });
+            sampleResult["CallsPerSecond"] = sampleResult["MedianTime"].get<double>() > 0.0 ? 1000000000.0 / sampleResult["MedianTime"].get<double>() : 0.0;
+        }
+    }
+    JenovaInterpreter::SetInterpreterBackend(originalBackend);
+
+    // Release Owner
+    memdelete(ownerObject);
+    results["CallFunction"]["Unit"] = "ns";
+    return benchmarkResult;
+}
+bool JenovaBenchmarkSuite::BenchmarkPropertySync(jenova::json_t& results)
+{
+    // Group Scripts By Property Count
+    std::map<size_t, std::string> scriptsByPropertyCount;
+    for (const auto& benchmarkScript : CollectBenchmarkScripts())
+    {
+        std::string scriptUID = AS_STD_STRING(benchmarkScript->GetScriptIdentity());
+        size_t propertyCount = JenovaInterpreter::GetPropertiesList(scriptUID).size();
+        if (!scriptsByPropertyCount.contains(propertyCount)) scriptsByPropertyCount[propertyCount] = scriptUID;
+    }
+
+    // Measure Full Instance Property Sync Per Property Count
+    for (const auto& [propertyCount, scriptUID] : scriptsByPropertyCount)
+    {
+        std::string measuredUID = scriptUID;
+        jenova::PropertyList propertyNames = JenovaInterpreter::GetPropertiesList(measuredUID);
+        std::vector<String> propertyKeys;
+        for (const auto& propertyName : propertyNames) propertyKeys.push_back(String(propertyName.c_str()));
+        String instanceUID(scriptUID.c_str());
+        Variant propertyValue(int64_t(1337));
+
+        results["PropertySync"][std::to_string(propertyCount)] = MeasureLoop(jenova::GlobalSettings::BenchmarkCallIterations, [&]()
+        {
+            for (const auto& propertyKey : propertyKeys) JenovaInterpreter::SetPropertyValueFromVariant(propertyKey, propertyValue, instanceUID);
+        });
+    }
+    results["PropertySync"]["Unit"] = "ns";
+    return true;
+}
+bool JenovaBenchmarkSuite::BenchmarkMetadataLookup(jenova::json_t& results)
+{
+    // Collect Scripts
+    std::vector<Ref<CPPScript>> benchmarkScripts = CollectBenchmarkScripts();
+    if (benchmarkScripts.empty()) return false;
+    std::string scriptUID = AS_STD_STRING(benchmarkScripts.back()->GetScriptIdentity());
+    jenova::PropertyList propertyNames = JenovaInterpreter::GetPropertiesList(scriptUID);
+    std::string propertyName = propertyNames.empty() ? "" : propertyNames.front();
+    std::string methodName = BenchmarkMethods[3].methodName;
+
+    // Lookup Measurement
+    auto MeasureLookup = [&](const char* lookupName, auto&& lookupFunction)
+    {
+        results["MetadataLookup"][lookupName] = MeasureLoop(jenova::GlobalSettings::BenchmarkLookupIterations, lookupFunction);
+    };
+
+    // Measure Lookups [Results Kept Volatile to Avoid Elimination]
+    volatile uintptr_t lookupSink = 0;
+    MeasureLookup("GetFunctionAddress", [&]() { lookupSink = uintptr_t(JenovaInterpreter::GetFunctionAddress(methodName, scriptUID)); });
+    MeasureLookup("GetFunctionParameters", [&]() { lookupSink = JenovaInterpreter::GetFunctionParameters(methodName, scriptUID).size(); });
+    MeasureLookup("GetFunctionReturn", [&]() { lookupSink = JenovaInterpreter::GetFunctionReturn(methodName, scriptUID).size(); });
+    MeasureLookup("GetFunctionMethodID", [&]() { lookupSink = JenovaInterpreter::GetFunctionMethodID(methodName, scriptUID); });
+    if (!propertyName.empty())
+    {
+        MeasureLookup("GetPropertyAddress", [&]() { lookupSink = uintptr_t(JenovaInterpreter::GetPropertyAddress(propertyName, scriptUID)); });
+        MeasureLookup("GetPropertyType", [&]() { lookupSink = JenovaInterpreter::GetPropertyType(propertyName, scriptUID).size(); });
+    }
+    results["MetadataLookup"]["ScriptCount"] = benchmarkScripts.size();
+    results["MetadataLookup"]["Unit"] = "ns";
+    return true;
+}
+bool JenovaBenchmarkSuite::BenchmarkDatabaseDeploy(jenova::json_t& results)
+{
+    // Validate Database
+    if (!JenovaInterpreter::IsDatabaseAvailable(jenova::GlobalSettings::DefaultModuleDatabaseFile))
+    {
+        jenova::Error("Jenova Benchmark", "Module Database Not Found, Deploy Benchmark Skipped.");
+        return false;
+    }
+
+    // Measure Cold Start [Unload Then Deploy]
+    std::vector<double> samples;
+    jenova::json_t bootStatistics = jenova::json_t::array();
+    for (size_t repetition = 0; repetition < jenova::GlobalSettings::BenchmarkDeployRepetitions; repetition++)
+    {
+        if (!JenovaInterpreter::UnloadModule(jenova::ModuleUnloadStage::UnloadModuleManually))
+        {
+            jenova::Error("Jenova Benchmark", "Failed to Unload Module Before Deploy.");
+            return false;
+        }
+        int64_t beginTime = JenovaTinyProfiler::ReadClock();
+        if (!JenovaInterpreter::DeployFromDatabase(jenova::GlobalSettings::DefaultModuleDatabaseFile))
+        {
+            jenova::Error("Jenova Benchmark", "Failed to Deploy Module From Database.");
+            return false;
+        }
+        samples.push_back(ElapsedMilliseconds(beginTime));
+
+        // Collect Boot Breakdown
+        jenova::ModuleBootStatistics moduleBootStatistics = JenovaInterpreter::GetModuleBootStatistics();
+        bootStatistics.push_back({ { "LoaderTime", moduleBootStatistics.loaderTime }, { "AddonsTime", moduleBootStatistics.addonsTime },
+            { "InitializerTime", moduleBootStatistics.initializerTime }, { "BootEventTime", moduleBootStatistics.bootEventTime }, { "TotalTime", moduleBootStatistics.totalTime } });
+    }
+    results["DatabaseDeploy"] = SerializeSample(MeasureSamples(samples, 1));
+    results["DatabaseDeploy"]["BootStatistics"] = bootStatistics;
+    results["DatabaseDeploy"]["Unit"] = "ms";
+    return true;
+}
+bool JenovaBenchmarkSuite::BenchmarkCompression(jenova::json_t& results)
+{
+    // Decode Module Database Payload As Real-World Input
+    std::string databasePath = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::DefaultModuleDatabaseFile;
+    jenova::MemoryBuffer databaseData = jenova::ReadMemoryBufferFromFile(databasePath);
+    if (databaseData.size() < sizeof(jenova::ModuleDatabaseHeader))
+    {
+        jenova::Error("Jenova Benchmark", "Failed to Read Module Database for Compression Benchmark.");
+        return false;
+    }
+    jenova::ModuleDatabaseHeader databaseHeader;
+    memcpy(&databaseHeader, databaseData.data(), sizeof(jenova::ModuleDatabaseHeader));
+    jenova::MemoryBuffer inputBuffer = jenova::DecompressBuffer(&databaseData[sizeof(jenova::ModuleDatabaseHeader)], databaseHeader.encodedDataSize,
+        databaseHeader.compressionCodec, databaseHeader.moduleSize + databaseHeader.metaDataSize);
+    if (inputBuffer.empty())
+    {
+        jenova::Error("Jenova Benchmark", "Failed to Decode Module Database for Compression Benchmark.");
+        return false;
+    }
+    results["Compression"]["InputSize"] = inputBuffer.size();
+
+    // Measure Codec/Level Matrix
+    struct CompressionCase { jenova::CompressionCodec codec; int level; const char* name; };
+    std::vector<CompressionCase> compressionCases =
+    {
+        { jenova::CompressionCodec::Store, 0, "Store" },
+        { jenova::CompressionCodec::Zlib, 1, "Zlib-1" }, { jenova::CompressionCodec::Zlib, 6, "Zlib-6" }, { jenova::CompressionCodec::Zlib, 9, "Zlib-9" },
+        { jenova::CompressionCodec::LZ4, 1, "LZ4-1" }, { jenova::CompressionCodec::LZ4, 9, "LZ4-9" },
+        { jenova::CompressionCodec::Zstd, 1, "Zstd-1" }, { jenova::CompressionCodec::Zstd, 3, "Zstd-3" }, { jenova::CompressionCodec::Zstd, 19, "Zstd-19" },
+    };
+    double inputMegabytes = double(inputBuffer.size()) / (1024.0 * 1024.0);
+    for (const auto& compressionCase : compressionCases)
+    {
+        std::vector<double> compressSamples, decompressSamples;
+        size_t compressedSize = 0;
+        for (size_t repetition = 0; repetition < jenova::GlobalSettings::BenchmarkCompressionRepetitions; repetition++)
+        {
+            int64_t beginTime = JenovaTinyProfiler::ReadClock();
+            jenova::MemoryBuffer compressedData = jenova::CompressBuffer(inputBuffer.data(), inputBuffer.size(), compressionCase.codec, compressionCase.level);
+            compressSamples.push_back(ElapsedMilliseconds(beginTime));
+            if (compressedData.empty())
+            {
+                jenova::Error("Jenova Benchmark", "Compression Failed for %s.", compressionCase.name);
+                return false;
+            }
+            compressedSize = compressedData.size();
+
+            beginTime = JenovaTinyProfiler::ReadClock();
+            jenova::MemoryBuffer decompressedData = jenova::DecompressBuffer(compressedData.data(), compressedData.size(), compressionCase.codec, inputBuffer.size());
+            decompressSamples.push_back(ElapsedMilliseconds(beginTime));
+            if (decompressedData.size() != inputBuffer.size())
+            {
+                jenova::Error("Jenova Benchmark", "Decompression Failed for %s.", compressionCase.name);
+                return false;
+            }
+        }
+        BenchmarkSample compressSample = MeasureSamples(compressSamples, 1);
+        BenchmarkSample decompressSample = MeasureSamples(decompressSamples, 1);
+        jenova::json_t& caseResult = results["Compression"][compressionCase.name];
+        caseResult["Compress"] = SerializeSample(compressSample);
+        caseResult["Decompress"] = SerializeSample(decompressSample);
+        caseResult["CompressThroughput"] = compressSample.medianTime > 0.0 ? inputMegabytes / (compressSample.medianTime / 1000.0) : 0.0;
+        caseResult["DecompressThroughput"] = decompressSample.medianTime > 0.0 ? inputMegabytes / (decompressSample.medianTime / 1000.0) : 0.0;
+        caseResult["CompressedSize"] = compressedSize;
+        caseResult["CompressionRatio"] = jenova::CalculateCompressionRatio(inputBuffer.size(), compressedSize);
+    }
+    results["Compression"]["Unit"] = "ms";
+    results["Compression"]["ThroughputUnit"] = "MB/s";
+    return true;
+}
+bool JenovaBenchmarkSuite::BenchmarkProfilerOverhead(jenova::json_t& results)
+{
+    // Scope Recording Self-Cost [Disabled/Enabled]
+    auto MeasureScope = [&](const char* caseName)
+    {
+        results["ProfilerOverhead"][caseName] = MeasureLoop(jenova::GlobalSettings::BenchmarkLookupIterations, [&]() { JENOVA_PROFILE_SCOPE("BenchmarkScope"); },
+            []() { JenovaTinyProfiler::CollectFrame(); });
+    };
+    bool wasScopeRecording = JenovaTinyProfiler::IsScopeRecording();
+    JenovaTinyProfiler::SetScopeRecording(false);
+    MeasureScope("ScopeDisabled");
+    JenovaTinyProfiler::SetScopeRecording(true);
+    MeasureScope("ScopeEnabled");
+    JenovaTinyProfiler::SetScopeRecording(wasScopeRecording);
+
+    // Script Profiler Call Self-Cost
+    bool wasProfiling = JenovaScriptProfiler::IsProfiling();
+    if (!wasProfiling) JenovaScriptProfiler::StartProfiling();
+    JenovaScriptProfiler::MethodID methodID = JenovaScriptProfiler::RegisterMethod("JenovaBenchmark::ScopedCall");
+    results["ProfilerOverhead"]["ScriptProfilerCall"] = MeasureLoop(jenova::GlobalSettings::BenchmarkLookupIterations, [&]() { JenovaScriptProfiler::ScopedCall profiledCall(methodID); });
+    if (!wasProfiling) JenovaScriptProfiler::StopProfiling();
+    results["ProfilerOverhead"]["Unit"] = "ns";
+    return true;
+}
+bool JenovaBenchmarkSuite::BenchmarkGlobalStore(jenova::json_t& results)
+{
+    // Prepare Globals
+    JenovaGlobalStore::GlobalHandle globalHandle = JenovaGlobalStore::RegisterGlobal("JenovaBenchmark::GlobalVariable");
+    if (globalHandle == JenovaGlobalStore::InvalidHandle) return false;
+    JenovaGlobalStore::SetVariable(globalHandle, Variant(String("Benchmark")));
+
+    // Uncontended Access Paths
+    auto MeasureAccess = [&](const char* caseName, auto&& accessFunction)
+    {
+        results["GlobalStore"][caseName] = MeasureLoop(jenova::GlobalSettings::BenchmarkLookupIterations, accessFunction);
+    };
+    MeasureAccess("HandleRead", [&]() { Variant value = JenovaGlobalStore::GetVariable(globalHandle); });
+    MeasureAccess("NameRead", [&]() { Variant value = JenovaGlobalStore::GetVariable(JenovaGlobalStore::FindGlobal("JenovaBenchmark::GlobalVariable")); });
+    MeasureAccess("HandleWrite", [&]() { JenovaGlobalStore::SetVariable(globalHandle, Variant(int64_t(7))); });
+    MeasureAccess("PointerRead", [&]() { void* volatile value = JenovaGlobalStore::GetPointer(globalHandle); });
+
+    // Contended Reads [Readers Per Thread Time While One Writer Replaces The Value]
+    for (size_t readerCount : BenchmarkReaderCounts)
+    {
+        std::atomic<bool> isWriting = true;
+        std::thread writerThread([&]()
+        {
+            int64_t writeIndex = 0;
+            while (isWriting.load(std::memory_order_relaxed)) JenovaGlobalStore::SetVariable(globalHandle, Variant(writeIndex++));
+        });
+        std::vector<double> samples(readerCount * jenova::GlobalSettings::BenchmarkSampleCount);
+        std::vector<std::thread> readerThreads;
+        for (size_t readerIndex = 0; readerIndex < readerCount; readerIndex++)
+        {
+            readerThreads.emplace_back([&, readerIndex]()
+            {
+                std::vector<double> readerSamples = CollectSamples(jenova::GlobalSettings::BenchmarkLookupIterations, [&]() { Variant value = JenovaGlobalStore::GetVariable(globalHandle); });
+                std::copy(readerSamples.begin(), readerSamples.end(), samples.begin() + readerIndex * jenova::GlobalSettings::BenchmarkSampleCount);
+            });
+        }
+        for (auto& readerThread : readerThreads) readerThread.join();
+        isWriting.store(false, std::memory_order_relaxed);
+        writerThread.join();
+        results["GlobalStore"][jenova::Format("ContendedRead_x%zu", readerCount)] = SerializeSample(MeasureSamples(samples, jenova::GlobalSettings::BenchmarkLookupIterations));
+    }
+    JenovaGlobalStore::SetVariable(globalHandle, Variant());
+    results["GlobalStore"]["Unit"] = "ns";
+    return true;
+}
+bool JenovaBenchmarkSuite::BenchmarkAllocators(jenova::json_t& results)
+{
+    // Batches Mimic Per-Frame Scratch Use [Allocate Many, Release All]
+    constexpr size_t objectSize = 64;
+    const size_t batchSize = jenova::GlobalSettings::BenchmarkLookupIterations;
+    std::vector<void*> batchObjects(batchSize);
+    auto MeasureBatch = [&](const char* caseName, auto&& allocateFunction, auto&& releaseFunction)
+    {
+        results["Allocators"][caseName] = MeasureLoop(batchSize, [&](size_t objectIndex)
+        {
+            batchObjects[objectIndex] = allocateFunction();
+            if (objectIndex + 1 == batchSize) releaseFunction();
+        });
+    };
+    MeasureBatch("Malloc", [&]() { return std::malloc(objectSize); }, [&]() { for (void* object : batchObjects) std::free(object); });
+    MeasureBatch("FrameArena", [&]() { return JenovaArenaAllocator::AllocateFrameMemory(objectSize, jenova::GlobalSettings::ArenaDefaultAlignment); },
+        [&]() { JenovaArenaAllocator::ResetFrameArena(); });
+    MeasureBatch("NamedArena", [&]() { return JenovaArenaAllocator::AllocateArenaMemory("JenovaBenchmark::Arena", objectSize, jenova::GlobalSettings::ArenaDefaultAlignment); },
+        [&]() { JenovaArenaAllocator::ResetArena("JenovaBenchmark::Arena"); });
+    MeasureBatch("ObjectPool", [&]() { return JenovaArenaAllocator::AllocatePoolObject(objectSize); },
+        [&]() { for (void* object : batchObjects) JenovaArenaAllocator::FreePoolObject(object, objectSize); });
+    JenovaArenaAllocator::ReleaseArena("JenovaBenchmark::Arena");
+    results["Allocators"]["ObjectSize"] = objectSize;
+    results["Allocators"]["Unit"] = "ns";
+    return true;
+}
+bool JenovaBenchmarkSuite::BenchmarkSceneIndex(jenova::json_t& results)
+{
+    // Build Detached Synthetic Scene [Every Fourth Node Is A Timer For Class Queries]
+    godot::SceneTree* sceneTree = jenova::GetSceneTree();
+    if (!sceneTree || !JenovaSceneIndex::Activate()) return false;
+    const size_t nodeCount = jenova::GlobalSettings::BenchmarkSceneNodeCount;
+    const size_t fanout = jenova::GlobalSettings::BenchmarkSceneFanout;
+    Node* sceneRoot = memnew(Node);
+    sceneRoot->set_name("JenovaBenchmarkScene");
+    std::vector<Node*> sceneNodes(nodeCount);
+    for (size_t i = 0; i < nodeCount; i++)
+    {
+        sceneNodes[i] = (i % 4 == 0) ? memnew(Timer) : memnew(Node);
+        sceneNodes[i]->set_name(String("BenchNode_") + String::num_int64(i));
+        (i < fanout ? sceneRoot : sceneNodes[i / fanout - 1])->add_child(sceneNodes[i]);
+    }
+
+    // Attach Scene [Index Follows node_added]
+    int64_t beginTime = JenovaTinyProfiler::ReadClock();
+    sceneTree->get_root()->add_child(sceneRoot);
+    results["SceneIndex"]["AttachTime"] = ElapsedMilliseconds(beginTime);
+    results["SceneIndex"]["IndexedNodes"] = JenovaSceneIndex::GetIndexedNodeCount();
+
+    // Lookup Measurement [Last Node Is The Worst Case For Depth-First Search]
+    auto MeasureLookup = [&](const char* caseName, size_t iterations, auto&& lookupFunction)
+    {
+        results["SceneIndex"][caseName] = MeasureLoop(iterations, lookupFunction);
+    };
+    Node* targetNode = sceneNodes.back();
+    String targetName = targetNode->get_name();
+    String targetUniqueID = String(targetNode->get_path()).md5_text();
+    MeasureLookup("RecursiveFindByName", 1, [&]() { Node* volatile foundNode = FindNodeByNameRecursive(sceneRoot, targetName); });
+    MeasureLookup("IndexedFindByName", jenova::GlobalSettings::BenchmarkLookupIterations, [&]() { Node* volatile foundNode = JenovaSceneIndex::FindNodeByName(sceneRoot, targetName); });
+    MeasureLookup("HashedUniqueID", jenova::GlobalSettings::BenchmarkLookupIterations, [&]() { String uniqueID = String(targetNode->get_path()).md5_text(); });
+    MeasureLookup("IndexedUniqueID", jenova::GlobalSettings::BenchmarkLookupIterations, [&]() { const std::string* volatile uniqueID = JenovaSceneIndex::GetNodeUniqueID(targetNode); });
+    MeasureLookup("IndexedNodeByUniqueID", jenova::GlobalSettings::BenchmarkLookupIterations, [&]() { Node* volatile foundNode = JenovaSceneIndex::GetNodeByUniqueID(targetUniqueID); });
+    MeasureLookup("RecursiveFindByClass", 1, [&]() { TypedArray<Node> classNodes; CollectNodesByClassRecursive(sceneRoot, "Timer", classNodes); });
+    MeasureLookup("IndexedFindByClass", 1, [&]() { TypedArray<Node> classNodes = JenovaSceneIndex::FindNodesByClass("Timer"); });
+
+    // Detach And Free Scene [Index Follows node_removed]
+    beginTime = JenovaTinyProfiler::ReadClock();
+    sceneTree->get_root()->remove_child(sceneRoot);
+    results["SceneIndex"]["DetachTime"] = ElapsedMilliseconds(beginTime);
+    memdelete(sceneRoot);
+    results["SceneIndex"]["SceneNodes"] = nodeCount;
+    results["SceneIndex"]["Unit"] = "ns";
+    return true;
+}
+bool JenovaBenchmarkSuite::BenchmarkClektron(jenova::json_t& results)
+{
+    // Launch Script Shaped Workload [Uses API Symbols, Returns True]
+    Clektron* clektron = Clektron::get_singleton();
+    if (!clektron) return false;
+    const std::string benchmarkScript = "bool ClektronMain() { int accumulator = 0; for (int i = 0; i < 64; i++) accumulator += i; "
+        "return GetOperatingSystem() != OS_Unsupported && accumulator > 0; }";
+    auto MeasureExecution = [&](const char* caseName, size_t iterations, auto&& executeFunction)
+    {
+        bool executionResult = true;
+        results["Clektron"][caseName] = MeasureLoop(iterations, [&]() { executionResult &= executeFunction(); });
+        return executionResult;
+    };
+
+    // Cold Executions Compile Every Time, Cached Executions Only Link The Cached Object
+    bool suiteResult = MeasureExecution("ColdExecute", 1, [&]() { clektron->ClearScriptCache(); return clektron->ExecuteScript(benchmarkScript); });
+    size_t compilationCount = clektron->GetCompilationCount();
+    suiteResult &= MeasureExecution("CachedExecute", 1, [&]() { return clektron->ExecuteScript(benchmarkScript); });
+    results["Clektron"]["CachedExecute"]["Compilations"] = clektron->GetCompilationCount() - compilationCount;
+    if (clektron->GetCompilationCount() != compilationCount)
+    {
+        jenova::Error("Jenova Benchmark", "Cached Clektron Execution Compiled Script Again.");
+        suiteResult = false;
+    }
+
+    // Contexts Link Once
+    Ref<ClektronContext> clektronContext;
+    clektronContext.instantiate();
+    suiteResult &= clektronContext->LoadScript(benchmarkScript);
+    suiteResult &= MeasureExecution("ContextExecute", jenova::GlobalSettings::BenchmarkCallIterations, [&]() { return clektronContext->Execute(); });
+    clektronContext->Unload();
+    results["Clektron"]["Unit"] = "ns";
+    return suiteResult;
+}
+JenovaBenchmarkSuite::BenchmarkSample JenovaBenchmarkSuite::MeasureSamples(const std::vector<double>& samples, uint64_t iterationsPerSample)
+{
+    BenchmarkSample benchmarkSample;
+    if (samples.empty()) return benchmarkSample;
+    std::vector<double> sortedSamples = samples;
+    std::sort(sortedSamples.begin(), sortedSamples.end());
+    benchmarkSample.iterations = iterationsPerSample * samples.size();
+    for (const auto& sample : samples) benchmarkSample.totalTime += sample;
+    benchmarkSample.minTime = sortedSamples.front();
+    benchmarkSample.maxTime = sortedSamples.back();
+    benchmarkSample.meanTime = benchmarkSample.totalTime / double(samples.size());
+    size_t middleIndex = sortedSamples.size() / 2;
+    benchmarkSample.medianTime = sortedSamples.size() % 2 ? sortedSamples[middleIndex] : (sortedSamples[middleIndex - 1] + sortedSamples[middleIndex]) / 2.0;
+    return benchmarkSample;
+}
+jenova::json_t JenovaBenchmarkSuite::SerializeSample(const BenchmarkSample& sample)
+{
+    jenova::json_t serializedSample;
+    serializedSample["Iterations"] = sample.iterations;
+    serializedSample["MinTime"] = sample.minTime;
+    serializedSample["MaxTime"] = sample.maxTime;
+    serializedSample["MeanTime"] = sample.meanTime;
+    serializedSample["MedianTime"] = sample.medianTime;
+    return serializedSample;
+}
+
+#endif // JENOVA_BENCHMARK
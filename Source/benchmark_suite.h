@@ -0,0 +1,87 @@
+#pragma once
+
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Benchmark Suite Definition
+/*
+    Only Compiled Into Benchmark Builds (JENOVA_BENCHMARK), See Jenova.Builder.py --benchmark.
+    Runs Inside A Headless Editor Against A Generated Project Once File System Scan Is Done,
+    Measures Build Pipeline, Interpreter And Database Paths Then Writes Results As JSON And Quits.
+    Generated Projects And Result Merging Are Handled By Jenova.Benchmark.py
+*/
+class JenovaBenchmarkSuite
+{
+public:
+    // Benchmark Structures
+    struct BenchmarkSample
+    {
+        uint64_t iterations = 0;
+        double totalTime = 0.0;
+        double minTime = 0.0;
+        double maxTime = 0.0;
+        double meanTime = 0.0;
+        double medianTime = 0.0;
+    };
+
+public:
+    static void RequestRun(const std::string& outputFile);
+    static bool IsRunRequested();
+    static bool ScheduleRun();
+
+private:
+    static void OnProcessFrame();
+    static bool RunSuite(jenova::json_t& results);
+    static bool BenchmarkBuild(jenova::json_t& results);
+    static bool BenchmarkCallFunction(jenova::json_t& results);
+    static bool BenchmarkPropertySync(jenova::json_t& results);
+    static bool BenchmarkMetadataLookup(jenova::json_t& results);
+    static bool BenchmarkDatabaseDeploy(jenova::json_t& results);
+    static bool BenchmarkCompression(jenova::json_t& results);
+    static bool BenchmarkProfilerOverhead(jenova::json_t& results);
+    static bool BenchmarkGlobalStore(jenova::json_t& results);
+    static bool BenchmarkAllocators(jenova::json_t& results);
+    static bool BenchmarkSceneIndex(jenova::json_t& results);
+    static bool BenchmarkClektron(jenova::json_t& results);
+    static BenchmarkSample MeasureSamples(const std::vector<double>& samples, uint64_t iterationsPerSample);
+    template <typename LoopFunction> static std::vector<double> CollectSamples(size_t iterations, LoopFunction&& loopFunction, const std::function<void()>& sampleCompleted = nullptr)
+    {
+        // Loop Body Is Inlined Into Timed Region, Bodies Taking An Index Receive Iteration Index
+        std::vector<double> samples;
+        for (size_t sampleIndex = 0; sampleIndex < jenova::GlobalSettings::BenchmarkSampleCount; sampleIndex++)
+        {
+            int64_t beginTime = JenovaTinyProfiler::ReadClock();
+            for (size_t i = 0; i < iterations; i++)
+            {
+                if constexpr (std::is_invocable_v<LoopFunction&, size_t>) loopFunction(i);
+                else loopFunction();
+            }
+            samples.push_back(double(JenovaTinyProfiler::ReadClock() - beginTime) / double(iterations));
+            if (sampleCompleted) sampleCompleted();
+        }
+        return samples;
+    }
+    template <typename LoopFunction> static jenova::json_t MeasureLoop(size_t iterations, LoopFunction&& loopFunction, const std::function<void()>& sampleCompleted = nullptr)
+    {
+        return SerializeSample(MeasureSamples(CollectSamples(iterations, loopFunction, sampleCompleted), iterations));
+    }
+    static jenova::json_t SerializeSample(const BenchmarkSample& sample);
+
+private:
+    static inline bool          isRunRequested  = false;
+    static inline bool          isScheduled     = false;
+    static inline std::string   outputFile      = "";
+};
@@ -0,0 +1,675 @@
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Build Service Internal Storage
+namespace jenova::buildservice
+{
+    // Structures
+    typedef JenovaBuildService::FileStamp FileStamp;
+    struct HashedFile
+    {
+        FileStamp fileStamp;
+        String fileHash;
+    };
+    struct IncludeDirective
+    {
+        std::string includeName;
+        bool isQuoted = false;
+    };
+    struct ParsedIncludes
+    {
+        std::vector<IncludeDirective> includeDirectives;
+        bool hasComputedInclude = false;
+    };
+    struct IncludeNode
+    {
+        FileStamp fileStamp;
+        ParsedIncludes parsedIncludes;
+    };
+    struct TrackedScript
+    {
+        std::string resourcePath;
+        std::string scriptDirectory;
+        String scriptHash;
+        ParsedIncludes parsedIncludes;
+    };
+    struct ObjectRecord
+    {
+        std::string scriptHash;
+        std::string compileCommand;
+        std::string includeSignature;
+        FileStamp objectStamp;
+        bool isCompiled = false;
+    };
+    struct CachedDatabase
+    {
+        FileStamp fileStamp;
+        jenova::json_t buildCacheDatabase;
+    };
+    struct SpeculativeJob
+    {
+        std::string scriptUID;
+        std::string scriptSource;
+        std::string scriptCacheFile;
+        std::string scriptObjectFile;
+        std::string referenceFile;
+        std::string compileCommand;
+        std::string scriptHash;
+        std::string includeSignature;
+    };
+    struct RunningJob
+    {
+        std::string scriptUID;
+        std::string scriptHash;
+        std::string compileCommand;
+        int processID = -1;
+        bool isCancelled = false;
+    };
+
+    // Build Service State [Main Thread]
+    static bool isInitialized = false;
+    static std::unordered_map<std::string, HashedFile> hashedFiles;
+    static std::unordered_map<std::string, IncludeNode> includeNodes;
+    static std::unordered_map<std::string, TrackedScript> trackedScripts;
+    static std::unordered_map<std::string, CachedDatabase> cachedDatabases;
+    static std::vector<std::string> searchDirectories;
+    static std::string cacheDirectory;
+    static jenova::InstalledAddons cachedAddons;
+    static FileStamp cachedAddonsPackageStamp;
+    static bool hasCachedAddons = false;
+
+    // Build Service State [Shared With Worker]
+    static std::mutex serviceMutex;
+    static std::condition_variable jobCondition;
+    static std::unordered_map<std::string, ObjectRecord> objectRecords;
+    static std::vector<SpeculativeJob> jobQueue;
+    static std::list<RunningJob> runningJobs;
+    static std::vector<std::thread> jobWorkers;
+    static bool isWorkerStopping = false;
+
+    // Utilities
+    static std::string NormalizePath(const std::string& filePath)
+    {
+        std::error_code errorCode;
+        std::filesystem::path absolutePath = std::filesystem::absolute(std::filesystem::path(filePath), errorCode);
+        if (errorCode) return std::filesystem::path(filePath).lexically_normal().generic_string();
+        return absolutePath.lexically_normal().generic_string();
+    }
+    static std::string GetPackageDatabaseFile()
+    {
+        return AS_STD_STRING(jenova::GetJenovaProjectDirectory() + "Jenova/" + jenova::GlobalSettings::JenovaInstalledPackagesFile);
+    }
+    static bool IsRacyStamp(const FileStamp& fileStamp)
+    {
+        // Writes Landing Within The Same Timestamp Tick Are Invisible, Don't Trust Freshly Written Files
+        int64_t currentTime = std::filesystem::file_time_type::clock::now().time_since_epoch().count();
+        int64_t racyWindow = std::chrono::duration_cast<std::filesystem::file_time_type::duration>(std::chrono::milliseconds(jenova::GlobalSettings::BuildServiceRacyStampWindow)).count();
+        return currentTime - fileStamp.writeTime < racyWindow;
+    }
+    static ParsedIncludes ParseIncludeDirectives(const std::string& sourceCode)
+    {
+        // Only Directive Lines Are Scanned, Inactive Branches Over-Approximate Which Is Safe
+        ParsedIncludes parsedIncludes;
+        size_t lineStart = 0;
+        while (lineStart < sourceCode.size())
+        {
+            size_t lineEnd = sourceCode.find('\n', lineStart);
+            if (lineEnd == std::string::npos) lineEnd = sourceCode.size();
+            size_t cursor = lineStart;
+            auto SkipSpaces = [&]() { while (cursor < lineEnd && (sourceCode[cursor] == ' ' || sourceCode[cursor] == '\t')) cursor++; };
+            SkipSpaces();
+            if (cursor < lineEnd && sourceCode[cursor] == '#')
+            {
+                cursor++;
+                SkipSpaces();
+                if (sourceCode.compare(cursor, 7, "include") == 0)
+                {
+                    cursor += 7;
+                    SkipSpaces();
+                    char closingCharacter = cursor < lineEnd && sourceCode[cursor] == '"' ? '"' : (cursor < lineEnd && sourceCode[cursor] == '<' ? '>' : 0);
+                    size_t nameEnd = closingCharacter ? sourceCode.find(closingCharacter, cursor + 1) : std::string::npos;
+                    if (nameEnd != std::string::npos && nameEnd < lineEnd)
+                    {
+                        parsedIncludes.includeDirectives.push_back({ sourceCode.substr(cursor + 1, nameEnd - cursor - 1), closingCharacter == '"' });
+                    }
+                    else
+                    {
+                        // Macro Expanded Or Malformed Include [include_next Lands Here Too]
+                        parsedIncludes.hasComputedInclude = true;
+                    }
+                }
+            }
+            lineStart = lineEnd + 1;
+        }
+        return parsedIncludes;
+    }
+    static void ResolveInclude(const IncludeDirective& includeDirective, const std::string& includingDirectory, const std::string& scriptDirectory, std::vector<std::string>& resolvedFiles)
+    {
+        // Every Candidate Counts Instead Of First Match, Extra Matches Only Cause Extra Recompiles
+        auto TryDirectory = [&](const std::string& searchDirectory)
+        {
+            if (searchDirectory.empty()) return;
+            std::error_code errorCode;
+            std::filesystem::path candidatePath = std::filesystem::path(searchDirectory) / includeDirective.includeName;
+            if (std::filesystem::is_regular_file(candidatePath, errorCode)) resolvedFiles.push_back(candidatePath.lexically_normal().generic_string());
+        };
+        if (includeDirective.isQuoted)
+        {
+            TryDirectory(includingDirectory);
+            TryDirectory(scriptDirectory);
+        }
+        for (const auto& searchDirectory : searchDirectories) TryDirectory(searchDirectory);
+
+        // Nothing Found Means System Or Toolchain Header
+    }
+    static const IncludeNode& GetIncludeNode(const std::string& headerFile)
+    {
+        FileStamp fileStamp = JenovaBuildService::GetFileStamp(headerFile);
+        IncludeNode& includeNode = includeNodes[headerFile];
+        if (includeNode.fileStamp != fileStamp || !fileStamp.fileExists || IsRacyStamp(fileStamp))
+        {
+            includeNode.fileStamp = fileStamp;
+            includeNode.parsedIncludes = ParseIncludeDirectives(jenova::ReadStdStringFromFile(headerFile));
+        }
+        return includeNode;
+    }
+    static TrackedScript& TrackScript(const jenova::ScriptModule& scriptModule)
+    {
+        TrackedScript& trackedScript = trackedScripts[AS_STD_STRING(scriptModule.scriptUID)];
+        if (trackedScript.scriptHash != scriptModule.scriptHash || trackedScript.resourcePath.empty())
+        {
+            trackedScript.resourcePath = AS_STD_STRING(scriptModule.scriptFilename);
+            trackedScript.scriptDirectory = NormalizePath(AS_STD_STRING(ProjectSettings::get_singleton()->globalize_path(scriptModule.scriptFilename.get_base_dir())));
+            trackedScript.scriptHash = scriptModule.scriptHash;
+            trackedScript.parsedIncludes = ParseIncludeDirectives(AS_STD_STRING(scriptModule.scriptSource));
+        }
+        return trackedScript;
+    }
+    static bool CollectIncludeClosure(const TrackedScript& trackedScript, std::vector<std::string>& headerFiles)
+    {
+        // Depth First Over Resolved Project Headers
+        std::unordered_set<std::string> visitedHeaders;
+        std::vector<std::pair<std::string, const ParsedIncludes*>> pendingIncludes;
+        std::vector<std::string> resolvedFiles;
+        pendingIncludes.push_back({ cacheDirectory, &trackedScript.parsedIncludes });
+        while (!pendingIncludes.empty())
+        {
+            auto [includingDirectory, parsedIncludes] = pendingIncludes.back();
+            pendingIncludes.pop_back();
+            if (parsedIncludes->hasComputedInclude) return false;
+            for (const auto& includeDirective : parsedIncludes->includeDirectives)
+            {
+                resolvedFiles.clear();
+                ResolveInclude(includeDirective, includingDirectory, trackedScript.scriptDirectory, resolvedFiles);
+                for (const auto& headerFile : resolvedFiles)
+                {
+                    if (!visitedHeaders.insert(headerFile).second) continue;
+                    headerFiles.push_back(headerFile);
+                    pendingIncludes.push_back({ std::filesystem::path(headerFile).parent_path().generic_string(), &GetIncludeNode(headerFile).parsedIncludes });
+                }
+            }
+        }
+        return true;
+    }
+    static std::string ComputeIncludeSignature(const TrackedScript& trackedScript)
+    {
+        // Empty Signature Means Untrackable [Computed Includes], Such Objects Are Never Reused
+        std::vector<std::string> headerFiles;
+        if (!CollectIncludeClosure(trackedScript, headerFiles)) return std::string();
+        std::sort(headerFiles.begin(), headerFiles.end());
+        String signatureSource = "Headers;";
+        for (const auto& headerFile : headerFiles) signatureSource += String(headerFile.c_str()) + "=" + JenovaBuildService::GetFileHash(String(headerFile.c_str())) + ";";
+        return AS_STD_STRING(signatureSource.md5_text());
+    }
+    static RunningJob* FindRunningJob(const std::string& scriptUID)
+    {
+        for (auto& runningJob : runningJobs) if (runningJob.scriptUID == scriptUID) return &runningJob;
+        return nullptr;
+    }
+    static void CancelRunningJob(RunningJob& runningJob)
+    {
+        // Whole Process Group Goes, Shell And Compiler Driver Alike [Caller Holds Service Lock]
+        runningJob.isCancelled = true;
+        #ifdef TARGET_PLATFORM_LINUX
+        if (runningJob.processID > 0) kill(-runningJob.processID, SIGKILL);
+        #endif
+    }
+    static size_t GetSpeculativeWorkerCount()
+    {
+        // Quarter Of Cores At Most, Editor Keeps The Rest
+        size_t coreCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        return std::clamp<size_t>(coreCount / 4, 1, jenova::GlobalSettings::BuildServiceSpeculativeJobLimit);
+    }
+    static bool RunSpeculativeJob(const SpeculativeJob& speculativeJob, RunningJob& runningJob)
+    {
+        #ifdef TARGET_PLATFORM_LINUX
+        // Write Preprocessed Source [Worker Owns The Cache File Until Job Ends]
+        if (!jenova::WriteStdStringToFile(speculativeJob.scriptCacheFile, speculativeJob.scriptSource)) return false;
+        if (jenova::GlobalSettings::RespectSourceFilesEncoding) jenova::ApplyFileEncodingFromReferenceFile(speculativeJob.referenceFile, speculativeJob.scriptCacheFile);
+
+        // Prepare Child Environment Before Fork, Only Async-Signal-Safe Calls May Follow It
+        std::vector<std::string> childEnvironment;
+        for (char** environmentEntry = environ; *environmentEntry; environmentEntry++)
+        {
+            std::string_view environmentVariable(*environmentEntry);
+            if (environmentVariable.starts_with("LANG=") || environmentVariable.starts_with("LC_ALL=")) continue;
+            childEnvironment.emplace_back(environmentVariable);
+        }
+        childEnvironment.emplace_back("LANG=C.UTF-8");
+        childEnvironment.emplace_back("LC_ALL=C.UTF-8");
+        std::vector<char*> childEnvironmentBlock;
+        for (auto& environmentVariable : childEnvironment) childEnvironmentBlock.push_back(environmentVariable.data());
+        childEnvironmentBlock.push_back(nullptr);
+        const char* compileCommand = speculativeJob.compileCommand.c_str();
+        int speculativeNiceness = jenova::GlobalSettings::BuildServiceSpeculativeJobNiceness;
+
+        // Run Compiler [Output Is Discarded, Errors Are Reported By The Real Build]
+        pid_t pid = fork();
+        if (pid == -1) return false;
+        if (pid == 0)
+        {
+            // Own Process Group For Cancellation, Idle CPU And I/O Priority [Raw System Calls Only]
+            setpgid(0, 0);
+            setpriority(PRIO_PROCESS, 0, speculativeNiceness);
+            #ifdef SYS_ioprio_set
+            syscall(SYS_ioprio_set, 1 /* IOPRIO_WHO_PROCESS */, 0, 3 << 13 /* IOPRIO_CLASS_IDLE */);
+            #endif
+            int nullDevice = open("/dev/null", O_WRONLY);
+            if (nullDevice != -1)
+            {
+                dup2(nullDevice, STDOUT_FILENO);
+                dup2(nullDevice, STDERR_FILENO);
+                close(nullDevice);
+            }
+            execle("/bin/sh", "sh", "-c", compileCommand, nullptr, childEnvironmentBlock.data());
+            _exit(127);
+        }
+        setpgid(pid, pid);
+
+        // Publish Process, Cancellation May Have Arrived During Fork
+        {
+            std::lock_guard<std::mutex> serviceLock(serviceMutex);
+            runningJob.processID = pid;
+            if (runningJob.isCancelled) kill(-pid, SIGKILL);
+        }
+
+        // Wait Without Reaping, Process ID Must Not Be Reused While Still Published
+        siginfo_t processInfo = {};
+        int waitResult = waitid(P_PID, pid, &processInfo, WEXITED | WNOWAIT);
+        {
+            std::lock_guard<std::mutex> serviceLock(serviceMutex);
+            runningJob.processID = -1;
+        }
+        int status = 0;
+        if (waitpid(pid, &status, 0) == -1 || waitResult == -1) return false;
+        return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        #else
+        return false;
+        #endif
+    }
+}
+
+// Jenova Build Service Implementation
+using namespace jenova::buildservice;
+bool JenovaBuildService::Initialize()
+{
+    if (isInitialized) return true;
+    if (!JenovaAssetMonitor::get_singleton()->RegisterCallback(&JenovaBuildService::OnAssetChanged)) return false;
+    SetIncludeDirectories("");
+    isWorkerStopping = false;
+    isInitialized = true;
+    JENOVA_VERBOSE("Jenova Build Service Initialized.");
+    return true;
+}
+void JenovaBuildService::Shutdown()
+{
+    if (!isInitialized) return;
+
+    // Stop Workers [Running Jobs Are Killed]
+    {
+        std::lock_guard<std::mutex> serviceLock(serviceMutex);
+        isWorkerStopping = true;
+        jobQueue.clear();
+        for (auto& runningJob : runningJobs) CancelRunningJob(runningJob);
+    }
+    jobCondition.notify_all();
+    for (auto& jobWorker : jobWorkers) if (jobWorker.joinable()) jobWorker.join();
+    jobWorkers.clear();
+
+    // Release Caches
+    JenovaAssetMonitor::get_singleton()->UnregisterCallback(&JenovaBuildService::OnAssetChanged);
+    hashedFiles.clear();
+    includeNodes.clear();
+    trackedScripts.clear();
+    cachedDatabases.clear();
+    searchDirectories.clear();
+    InvalidateInstalledAddons();
+    objectRecords.clear();
+    isInitialized = false;
+}
+bool JenovaBuildService::IsActive()
+{
+    return isInitialized && jenova::GlobalStorage::BuildServiceMode != jenova::BuildServiceMode::Disabled;
+}
+JenovaBuildService::FileStamp JenovaBuildService::GetFileStamp(const std::string& filePath)
+{
+    FileStamp fileStamp;
+    std::error_code errorCode;
+    fileStamp.fileSize = std::filesystem::file_size(filePath, errorCode);
+    if (errorCode) return FileStamp();
+    fileStamp.writeTime = std::filesystem::last_write_time(filePath, errorCode).time_since_epoch().count();
+    if (errorCode) return FileStamp();
+    fileStamp.fileExists = true;
+    return fileStamp;
+}
+bool JenovaBuildService::IsSettledStamp(const FileStamp& fileStamp)
+{
+    return fileStamp.fileExists && !IsRacyStamp(fileStamp);
+}
+String JenovaBuildService::GetFileHash(const String& filePath)
+{
+    if (!IsActive()) return jenova::GenerateMD5HashFromFile(filePath);
+
+    // Rehash Only When Size Or Write Time Moved
+    std::string hashedPath = NormalizePath(AS_STD_STRING(filePath));
+    FileStamp fileStamp = GetFileStamp(hashedPath);
+    auto hashedEntry = hashedFiles.find(hashedPath);
+    if (hashedEntry != hashedFiles.end() && hashedEntry->second.fileStamp == fileStamp) return hashedEntry->second.fileHash;
+    String fileHash = jenova::GenerateMD5HashFromFile(filePath);
+    if (IsSettledStamp(fileStamp)) hashedFiles[hashedPath] = { fileStamp, fileHash };
+    return fileHash;
+}
+bool JenovaBuildService::LoadBuildCacheDatabase(const std::string& cacheFile, jenova::json_t& buildCacheDatabase)
+{
+    // Returns False When Missing Or Empty, Parse Errors Throw Like A Direct Parse
+    FileStamp fileStamp = GetFileStamp(cacheFile);
+    if (IsActive())
+    {
+        auto cachedEntry = cachedDatabases.find(cacheFile);
+        if (cachedEntry != cachedDatabases.end() && cachedEntry->second.fileStamp == fileStamp)
+        {
+            buildCacheDatabase = cachedEntry->second.buildCacheDatabase;
+            return true;
+        }
+    }
+    std::string buildCacheDatabaseContent = fileStamp.fileExists ? jenova::ReadStdStringFromFile(cacheFile) : std::string();
+    if (buildCacheDatabaseContent.empty()) return false;
+    buildCacheDatabase = jenova::json_t::parse(buildCacheDatabaseContent);
+    if (IsActive() && !IsRacyStamp(fileStamp)) cachedDatabases[cacheFile] = { fileStamp, buildCacheDatabase };
+    return true;
+}
+void JenovaBuildService::StoreBuildCacheDatabase(const std::string& cacheFile, const jenova::json_t& buildCacheDatabase)
+{
+    // Database Was Just Written By Us, Content Is Known Even Within Racy Window
+    if (!IsActive()) return;
+    FileStamp fileStamp = GetFileStamp(cacheFile);
+    if (!fileStamp.fileExists) return;
+    cachedDatabases[cacheFile] = { fileStamp, buildCacheDatabase };
+}
+bool JenovaBuildService::GetInstalledAddons(jenova::InstalledAddons& installedAddons)
+{
+    if (!IsActive() || !hasCachedAddons) return false;
+    if (GetFileStamp(GetPackageDatabaseFile()) != cachedAddonsPackageStamp)
+    {
+        InvalidateInstalledAddons();
+        return false;
+    }
+    installedAddons = cachedAddons;
+    return true;
+}
+void JenovaBuildService::CacheInstalledAddons(const jenova::InstalledAddons& installedAddons)
+{
+    if (!IsActive()) return;
+    FileStamp packageStamp = GetFileStamp(GetPackageDatabaseFile());
+    if (IsRacyStamp(packageStamp)) return;
+    cachedAddons = installedAddons;
+    cachedAddonsPackageStamp = packageStamp;
+    hasCachedAddons = true;
+}
+void JenovaBuildService::InvalidateInstalledAddons()
+{
+    cachedAddons.clear();
+    cachedAddonsPackageStamp = FileStamp();
+    hasCachedAddons = false;
+}
+void JenovaBuildService::SetIncludeDirectories(const String& includeDirectories)
+{
+    // Project Root Then Same Semicolon List The Compilers Receive, Relative Entries Resolve Against Project
+    searchDirectories.clear();
+    searchDirectories.push_back(NormalizePath(AS_STD_STRING(jenova::GetJenovaProjectDirectory())));
+    for (const auto& includeDirectory : includeDirectories.split(";", false))
+    {
+        String globalizedDirectory = ProjectSettings::get_singleton()->globalize_path(includeDirectory.strip_edges());
+        if (globalizedDirectory.is_relative_path()) globalizedDirectory = jenova::GetJenovaProjectDirectory() + globalizedDirectory;
+        searchDirectories.push_back(NormalizePath(AS_STD_STRING(globalizedDirectory)));
+    }
+    cacheDirectory = NormalizePath(AS_STD_STRING(jenova::GetJenovaCacheDirectory()));
+}
+JenovaBuildService::ObjectState JenovaBuildService::QueryObjectState(const jenova::ScriptModule& scriptModule, const std::string& compileCommand, std::string& includeSignature)
+{
+    // Signature Is Taken Before Compiling, Headers Saved Mid Build Mismatch On Next Query
+    if (!IsActive()) return ObjectState::Unknown;
+    includeSignature = ComputeIncludeSignature(TrackScript(scriptModule));
+    FileStamp objectStamp = GetFileStamp(AS_STD_STRING(scriptModule.scriptObjectFile));
+
+    // Compare Against Last Compile Of This Session
+    std::lock_guard<std::mutex> serviceLock(serviceMutex);
+    auto recordEntry = objectRecords.find(AS_STD_STRING(scriptModule.scriptUID));
+    if (recordEntry == objectRecords.end()) return ObjectState::Unknown;
+    const ObjectRecord& objectRecord = recordEntry->second;
+    if (!objectRecord.isCompiled || includeSignature.empty() || !objectStamp.fileExists) return ObjectState::Outdated;
+    if (objectRecord.scriptHash != AS_STD_STRING(scriptModule.scriptHash)) return ObjectState::Outdated;
+    if (objectRecord.compileCommand != compileCommand) return ObjectState::Outdated;
+    if (objectRecord.includeSignature != includeSignature) return ObjectState::Outdated;
+    if (objectRecord.objectStamp != objectStamp) return ObjectState::Outdated;
+    return ObjectState::Current;
+}
+void JenovaBuildService::RecordObjectState(const jenova::ScriptModule& scriptModule, const std::string& compileCommand, const std::string& includeSignature, bool isCompiled)
+{
+    if (!IsActive()) return;
+    ObjectRecord objectRecord;
+    objectRecord.scriptHash = AS_STD_STRING(scriptModule.scriptHash);
+    objectRecord.compileCommand = compileCommand;
+    objectRecord.includeSignature = includeSignature;
+    objectRecord.objectStamp = GetFileStamp(AS_STD_STRING(scriptModule.scriptObjectFile));
+    objectRecord.isCompiled = isCompiled && objectRecord.objectStamp.fileExists;
+    std::lock_guard<std::mutex> serviceLock(serviceMutex);
+    objectRecords[AS_STD_STRING(scriptModule.scriptUID)] = objectRecord;
+}
+PackedStringArray JenovaBuildService::GetDependentScripts(const String& headerFile)
+{
+    PackedStringArray dependentScripts;
+    if (!IsActive()) return dependentScripts;
+    std::string normalizedHeader = NormalizePath(AS_STD_STRING(headerFile));
+    for (const auto& trackedEntry : trackedScripts)
+    {
+        std::vector<std::string> headerFiles;
+        bool isTrackable = CollectIncludeClosure(trackedEntry.second, headerFiles);
+        if (isTrackable && std::find(headerFiles.begin(), headerFiles.end(), normalizedHeader) == headerFiles.end()) continue;
+        dependentScripts.push_back(String(trackedEntry.second.resourcePath.c_str()));
+    }
+    return dependentScripts;
+}
+bool JenovaBuildService::QueueSpeculativeCompile(const jenova::ScriptModule& scriptModule, const std::string& compileCommand)
+{
+    #ifdef TARGET_PLATFORM_LINUX
+    if (!IsActive() || compileCommand.empty()) return false;
+
+    // Object State Before Taking Lock [Hashes Headers]
+    std::string includeSignature;
+    ObjectState objectState = QueryObjectState(scriptModule, compileCommand, includeSignature);
+
+    // Create Job [Source Travels With It, Cache File Is Written By Worker]
+    SpeculativeJob speculativeJob;
+    speculativeJob.scriptUID = AS_STD_STRING(scriptModule.scriptUID);
+    speculativeJob.scriptSource = AS_STD_STRING(scriptModule.scriptSource);
+    speculativeJob.scriptCacheFile = AS_STD_STRING(scriptModule.scriptCacheFile);
+    speculativeJob.scriptObjectFile = AS_STD_STRING(scriptModule.scriptObjectFile);
+    speculativeJob.referenceFile = AS_STD_STRING(ProjectSettings::get_singleton()->globalize_path(scriptModule.scriptFilename));
+    speculativeJob.compileCommand = compileCommand;
+    speculativeJob.scriptHash = AS_STD_STRING(scriptModule.scriptHash);
+    speculativeJob.includeSignature = includeSignature;
+
+    {
+        std::lock_guard<std::mutex> serviceLock(serviceMutex);
+        if (isWorkerStopping) return false;
+        auto queuedJob = std::find_if(jobQueue.begin(), jobQueue.end(), [&](const SpeculativeJob& job) { return job.scriptUID == speculativeJob.scriptUID; });
+        RunningJob* runningJob = FindRunningJob(speculativeJob.scriptUID);
+
+        // Skip If Object Already Matches Or Same Source Is Compiling
+        bool isSameJobRunning = runningJob && !runningJob->isCancelled && runningJob->scriptHash == speculativeJob.scriptHash && runningJob->compileCommand == speculativeJob.compileCommand;
+        if ((objectState == ObjectState::Current && !runningJob) || isSameJobRunning)
+        {
+            if (queuedJob != jobQueue.end()) jobQueue.erase(queuedJob);
+            return true;
+        }
+
+        // Newer Edit Outdates Running And Queued Compiles Of Same Script
+        if (runningJob) CancelRunningJob(*runningJob);
+        if (queuedJob != jobQueue.end()) *queuedJob = std::move(speculativeJob);
+        else jobQueue.push_back(std::move(speculativeJob));
+        while (jobWorkers.size() < GetSpeculativeWorkerCount()) jobWorkers.emplace_back(&JenovaBuildService::RunSpeculativeWorker);
+    }
+    jobCondition.notify_all();
+    return true;
+    #else
+    return false;
+    #endif
+}
+void JenovaBuildService::FinishSpeculativeCompiles(const jenova::ModuleList& scriptModules)
+{
+    // Build Compiles Queued Scripts Itself, Only Running Jobs Of Exactly The Sources Being Built Are Worth Waiting For
+    std::unique_lock<std::mutex> serviceLock(serviceMutex);
+    jobQueue.clear();
+    for (auto& runningJob : runningJobs)
+    {
+        auto builtModule = std::find_if(scriptModules.begin(), scriptModules.end(), [&](const jenova::ScriptModule& scriptModule) { return AS_STD_STRING(scriptModule.scriptUID) == runningJob.scriptUID; });
+        if (builtModule == scriptModules.end() || AS_STD_STRING(builtModule->scriptHash) != runningJob.scriptHash) CancelRunningJob(runningJob);
+    }
+    jobCondition.wait(serviceLock, []() { return runningJobs.empty(); });
+}
+void JenovaBuildService::WaitForSpeculativeCompiles()
+{
+    std::unique_lock<std::mutex> serviceLock(serviceMutex);
+    jobCondition.wait(serviceLock, []() { return jobQueue.empty() && runningJobs.empty(); });
+}
+bool JenovaBuildService::IsSourceStable(const String& sourceCode)
+{
+    // Brackets Balanced Outside Comments And Literals, Cheap Enough To Run On Every Editor Validation
+    std::string stableSource = AS_STD_STRING(sourceCode);
+    std::vector<char> openBrackets;
+    size_t sourceSize = stableSource.size();
+    for (size_t i = 0; i < sourceSize; i++)
+    {
+        char currentChar = stableSource[i];
+        char nextChar = i + 1 < sourceSize ? stableSource[i + 1] : '\0';
+        if (currentChar == '/' && nextChar == '/')
+        {
+            i = stableSource.find('\n', i);
+            if (i == std::string::npos) break;
+        }
+        else if (currentChar == '/' && nextChar == '*')
+        {
+            i = stableSource.find("*/", i + 2);
+            if (i == std::string::npos) return false;
+            i++;
+        }
+        else if (currentChar == 'R' && nextChar == '"' && (i == 0 || !(std::isalnum(uint8_t(stableSource[i - 1])) || stableSource[i - 1] == '_')))
+        {
+            size_t delimiterEnd = stableSource.find('(', i + 2);
+            if (delimiterEnd == std::string::npos) return false;
+            std::string rawTerminator = ")" + stableSource.substr(i + 2, delimiterEnd - i - 2) + "\"";
+            i = stableSource.find(rawTerminator, delimiterEnd);
+            if (i == std::string::npos) return false;
+            i += rawTerminator.size() - 1;
+        }
+        else if (currentChar == '"' || (currentChar == '\'' && !(i > 0 && std::isxdigit(uint8_t(stableSource[i - 1])) && std::isxdigit(uint8_t(nextChar)))))
+        {
+            // Literals End On Same Line [Digit Separators Aren't Char Literals]
+            for (i++; i < sourceSize && stableSource[i] != currentChar; i++)
+            {
+                if (stableSource[i] == '\n') return false;
+                if (stableSource[i] == '\\') i++;
+            }
+            if (i >= sourceSize) return false;
+        }
+        else if (currentChar == '(' || currentChar == '[' || currentChar == '{') openBrackets.push_back(currentChar);
+        else if (currentChar == ')' || currentChar == ']' || currentChar == '}')
+        {
+            char expectedBracket = currentChar == ')' ? '(' : currentChar == ']' ? '[' : '{';
+            if (openBrackets.empty() || openBrackets.back() != expectedBracket) return false;
+            openBrackets.pop_back();
+        }
+    }
+    return openBrackets.empty();
+}
+void JenovaBuildService::OnAssetChanged(const String& targetPath, const jenova::AssetMonitor::CallbackEvent& callbackEvent)
+{
+    // Package Or Addon Config Changes Invalidate Addons
+    String targetFile = targetPath.get_file();
+    if (targetFile == "Addon-Config.json" || targetFile == jenova::GlobalSettings::JenovaInstalledPackagesFile) InvalidateInstalledAddons();
+
+    // Forget Removed Files [Stamps Catch Everything Else]
+    if (callbackEvent == jenova::AssetMonitor::CallbackEvent::Removed || callbackEvent == jenova::AssetMonitor::CallbackEvent::RenamedOld)
+    {
+        std::string removedPath = NormalizePath(AS_STD_STRING(targetPath));
+        hashedFiles.erase(removedPath);
+        includeNodes.erase(removedPath);
+    }
+}
+void JenovaBuildService::RunSpeculativeWorker()
+{
+    std::unique_lock<std::mutex> serviceLock(serviceMutex);
+    while (true)
+    {
+        // Take Oldest Job Whose Script Isn't Compiling [Jobs Of Same Script Share Object File]
+        auto pendingJob = jobQueue.end();
+        jobCondition.wait(serviceLock, [&]()
+        {
+            if (isWorkerStopping) return true;
+            pendingJob = std::find_if(jobQueue.begin(), jobQueue.end(), [](const SpeculativeJob& job) { return FindRunningJob(job.scriptUID) == nullptr; });
+            return pendingJob != jobQueue.end();
+        });
+        if (isWorkerStopping) break;
+        SpeculativeJob speculativeJob = std::move(*pendingJob);
+        jobQueue.erase(pendingJob);
+        auto runningJob = runningJobs.insert(runningJobs.end(), RunningJob());
+        runningJob->scriptUID = speculativeJob.scriptUID;
+        runningJob->scriptHash = speculativeJob.scriptHash;
+        runningJob->compileCommand = speculativeJob.compileCommand;
+        serviceLock.unlock();
+
+        // Compile Outside Lock, Killed Or Failed Compiles May Leave Partial Objects
+        bool isCompiled = RunSpeculativeJob(speculativeJob, *runningJob);
+        if (!isCompiled)
+        {
+            std::error_code errorCode;
+            std::filesystem::remove(speculativeJob.scriptObjectFile, errorCode);
+        }
+        FileStamp objectStamp = GetFileStamp(speculativeJob.scriptObjectFile);
+
+        // Record Result [Failed Jobs Leave An Outdated Record]
+        serviceLock.lock();
+        ObjectRecord& objectRecord = objectRecords[speculativeJob.scriptUID];
+        objectRecord.scriptHash = speculativeJob.scriptHash;
+        objectRecord.compileCommand = speculativeJob.compileCommand;
+        objectRecord.includeSignature = speculativeJob.includeSignature;
+        objectRecord.objectStamp = objectStamp;
+        objectRecord.isCompiled = isCompiled && !runningJob->isCancelled && objectStamp.fileExists;
+        runningJobs.erase(runningJob);
+        jobCondition.notify_all();
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Build Service Definition
+/*
+    Keeps Build Inputs Warm For The Whole Editor Session. File Hashes And Parsed Include Directives Are Cached And
+    Revalidated By File Size And Write Time, The Build Cache Database And Addon Configs Stay Parsed Until Their Files
+    Change, Asset Monitor Events Drop Entries Of Removed Files. Compiled Objects Are Recorded With Source Hash, Compile
+    Command And Include Signature (Hash Over The Project Headers A Script Reaches), So Header Edits Only Recompile
+    Scripts Including Them And Objects Compiled Speculatively On Save Or While Editing Are Linked As-Is. Caches Are
+    Main Thread Only, Speculative Jobs Run On A Few Worker Threads At Idle CPU And I/O Priority And Newer Edits Kill
+    Outdated Jobs Of The Same Script. Disabled Mode Bypasses Everything.
+*/
+class JenovaBuildService
+{
+public:
+    // Service Structures
+    enum class ObjectState
+    {
+        Unknown,
+        Current,
+        Outdated
+    };
+    struct FileStamp
+    {
+        bool fileExists = false;
+        uintmax_t fileSize = 0;
+        int64_t writeTime = 0;
+        bool operator==(const FileStamp& other) const { return fileExists == other.fileExists && fileSize == other.fileSize && writeTime == other.writeTime; }
+        bool operator!=(const FileStamp& other) const { return !(*this == other); }
+    };
+
+public:
+    static bool Initialize();
+    static void Shutdown();
+    static bool IsActive();
+    static FileStamp GetFileStamp(const std::string& filePath);
+    static bool IsSettledStamp(const FileStamp& fileStamp);
+    static String GetFileHash(const String& filePath);
+    static bool LoadBuildCacheDatabase(const std::string& cacheFile, jenova::json_t& buildCacheDatabase);
+    static void StoreBuildCacheDatabase(const std::string& cacheFile, const jenova::json_t& buildCacheDatabase);
+    static bool GetInstalledAddons(jenova::InstalledAddons& installedAddons);
+    static void CacheInstalledAddons(const jenova::InstalledAddons& installedAddons);
+    static void InvalidateInstalledAddons();
+    static void SetIncludeDirectories(const String& includeDirectories);
+    static ObjectState QueryObjectState(const jenova::ScriptModule& scriptModule, const std::string& compileCommand, std::string& includeSignature);
+    static void RecordObjectState(const jenova::ScriptModule& scriptModule, const std::string& compileCommand, const std::string& includeSignature, bool isCompiled);
+    static PackedStringArray GetDependentScripts(const String& headerFile);
+    static bool QueueSpeculativeCompile(const jenova::ScriptModule& scriptModule, const std::string& compileCommand);
+    static void FinishSpeculativeCompiles(const jenova::ModuleList& scriptModules);
+    static void WaitForSpeculativeCompiles();
+    static bool IsSourceStable(const String& sourceCode);
+
+private:
+    static void OnAssetChanged(const String& targetPath, const jenova::AssetMonitor::CallbackEvent& callbackEvent);
+    static void RunSpeculativeWorker();
+};
@@ -32,7 +32,48 @@
 #define AddSymbol(symbol) tcc_add_symbol(tcc, #symbol, reinterpret_cast<const void*>(&ClektronSystem::API_##symbol))
 
 // Stroage Units
-std::map<const char*, std::shared_ptr<std::fstream>> fileInstances;
+std::map<void*, std::shared_ptr<std::fstream>> fileInstances;
+std::mutex fileInstancesMutex;
+
+// Jenova Clektron Compiled Script Storage
+namespace jenova::clektron
+{
+    // Type Definitions
+    using ClektronMainFunction = bool*(*)();
+
+    // Structures
+    struct CompiledScript
+    {
+        TCCState* tcc = nullptr;
+        ClektronMainFunction entrypoint = nullptr;
+        size_t imageSize = 0;
+        ~CompiledScript()
+        {
+            if (tcc) tcc_delete(tcc);
+            JenovaMemoryTracker::TrackRelease(jenova::MemoryTag::JITCode, imageSize);
+        }
+    };
+    struct ScriptExecution
+    {
+        std::atomic<bool> isCancelled = false;
+        std::atomic<bool> isComplete = false;
+        std::atomic<bool> result = false;
+        std::atomic<double> progress = 0.0;
+        std::mutex stateMutex;
+        std::condition_variable completionCondition;
+        std::string status;
+        ProgressCallback progressCallback;
+        std::shared_ptr<CompiledScript> compiledScript;
+    };
+
+    // Compiler State [TinyCC Compiles One Script At A Time]
+    static std::mutex compilerMutex;
+    static std::atomic<size_t> compilationCount = 0;
+
+    // Asynchronous Executions [Completed Tasks Are Cleared On Next Launch]
+    static std::mutex asyncExecutionMutex;
+    static std::vector<std::pair<jenova::TaskID, std::shared_ptr<ScriptExecution>>> asyncExecutions;
+}
 
 // Clektron Script Interface
 extern "C" namespace ClektronSystem
@@ -43,6 +84,7 @@ extern "C" namespace ClektronSystem
     typedef void* FunctionPtr;
     typedef const char* CString;
     typedef int Size;
+    typedef size_t(*DownloadWriteFunction)(void*, size_t, size_t, void*);
 
     // Enums
     enum AlertType
@@ -66,6 +108,23 @@ extern "C" namespace ClektronSystem
         double downloadSpeed = 0;
     };
 
+    // Execution State [Only Set On Threads Running ExecuteScriptAsync]
+    thread_local jenova::clektron::ScriptExecution* currentExecution = nullptr;
+    bool IsExecutionCancelled()
+    {
+        return currentExecution && currentExecution->isCancelled.load(std::memory_order_relaxed);
+    }
+    void UpdateExecutionProgress(double progress, const char* status)
+    {
+        if (!currentExecution) return;
+        currentExecution->progress.store(progress, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> stateLock(currentExecution->stateMutex);
+            currentExecution->status = status ? status : "";
+        }
+        if (currentExecution->progressCallback) currentExecution->progressCallback(progress, status ? status : "");
+    }
+
     // Utilities
     const char* InternalFormat(const char* fmt, ...)
     {
@@ -130,6 +189,13 @@ extern "C" namespace ClektronSystem
         return false;
     }
 
+    void InitializeDownloader()
+    {
+        // Curl Global State Is Not Thread-Safe, Initialize Once And Keep It For Process Lifetime
+        static std::once_flag curlInitializeFlag;
+        std::call_once(curlInitializeFlag, []() { curl_global_init(CURL_GLOBAL_ALL); });
+    }
+
     // Callbacks
     size_t OnDownloadBufferWrite(void* bufferPtr, size_t bufferSize, size_t newBufferSize, void* outBufferPtr)
     {
@@ -138,12 +204,22 @@ extern "C" namespace ClektronSystem
         outBuffer->insert(outBuffer->end(), static_cast<uint8_t*>(bufferPtr), static_cast<uint8_t*>(bufferPtr) + totalSize);
         return totalSize;
     }
+    size_t OnDownloadFileWrite(void* bufferPtr, size_t bufferSize, size_t newBufferSize, void* outFilePtr)
+    {
+        size_t totalSize = bufferSize * newBufferSize;
+        std::ofstream* outFile = static_cast<std::ofstream*>(outFilePtr);
+        outFile->write(static_cast<const char*>(bufferPtr), totalSize);
+        return outFile->good() ? totalSize : 0;
+    }
     size_t OnDownloadProgress(void* metaDataPtr, size_t downloadTotal, size_t downloadNow, size_t uploadTotal, size_t uploadNow)
     {
         // Unreference Unused Parameters
         UnreferenceParameter(uploadTotal);
         UnreferenceParameter(uploadNow);
 
+        // Abort Transfer If Execution Cancelled
+        if (IsExecutionCancelled()) return 1;
+
         // Update Download Progress
         if (downloadTotal > 0)
         {
@@ -192,10 +268,17 @@ extern "C" namespace ClektronSystem
     }
     void API_Wait(int msec)
     {
-        OS::get_singleton()->delay_msec(msec);
+        // Wake Up Early If Execution Cancelled
+        constexpr int waitSlice = 10;
+        for (int waited = 0; waited < msec && !IsExecutionCancelled(); waited += waitSlice)
+        {
+            OS::get_singleton()->delay_msec(std::min(waitSlice, msec - waited));
+        }
     }
     void API_Refresh()
     {
+        // Application Events Belong To Main Thread
+        if (currentExecution) return;
         jenova::DoApplicationEvents();
     }
     void API_Exit(int exitCode)
@@ -359,7 +442,8 @@ extern "C" namespace ClektronSystem
         auto file = std::make_shared<std::fstream>(filePath, std::ios::out | std::ios::binary);
         if (file->is_open())
         {
-            fileInstances[filePath] = file;
+            std::lock_guard<std::mutex> fileLock(fileInstancesMutex);
+            fileInstances[file.get()] = file;
             return static_cast<Instance>(file.get());
         }
         return nullptr;
@@ -369,7 +453,8 @@ extern "C" namespace ClektronSystem
         auto file = std::make_shared<std::fstream>(filePath, std::ios::in | std::ios::out | std::ios::binary);
         if (file->is_open())
         {
-            fileInstances[filePath] = file;
+            std::lock_guard<std::mutex> fileLock(fileInstancesMutex);
+            fileInstances[file.get()] = file;
             return static_cast<Instance>(file.get());
         }
         return nullptr;
@@ -395,20 +480,24 @@ extern "C" namespace ClektronSystem
         }
         return false;
     }
+    Size API_ReadFileChunk(Instance fileInstance, Buffer bufferPtr, Size chunkSize)
+    {
+        // Sequential Read, Returns Bytes Read, Zero At End Of File And -1 On Failure
+        auto file = static_cast<std::fstream*>(fileInstance);
+        if (!file || !file->is_open() || chunkSize < 0) return -1;
+        if (file->eof()) return 0;
+        file->read(static_cast<char*>(bufferPtr), chunkSize);
+        if (file->bad()) return -1;
+        return Size(file->gcount());
+    }
     bool API_CloseFile(Instance fileInstance)
     {
         auto file = static_cast<std::fstream*>(fileInstance);
         if (file && file->is_open())
         {
             file->close();
-            for (auto it = fileInstances.begin(); it != fileInstances.end(); ++it)
-            {
-                if (it->second.get() == file)
-                {
-                    fileInstances.erase(it);
-                    break;
-                }
-            }
+            std::lock_guard<std::mutex> fileLock(fileInstancesMutex);
+            fileInstances.erase(file);
             return true;
         }
         return false;
@@ -443,11 +532,10 @@ extern "C" namespace ClektronSystem
     }
 
     // Downloader API
-    bool API_DownloadToBuffer(CString fileURL, Buffer* outBuffer, Size* bufferSize, FunctionPtr downloadCallback)
+    bool PerformDownload(CString fileURL, DownloadWriteFunction writeFunction, void* writeData, FunctionPtr downloadCallback)
     {
         // Initialize CURL
-        CURLcode res;
-        curl_global_init(CURL_GLOBAL_ALL);
+        InitializeDownloader();
         CURL* curlHandle = curl_easy_init();
         if (!curlHandle)
         {
@@ -455,9 +543,6 @@ extern "C" namespace ClektronSystem
             return false;
         }
 
-        // Create Buffer
-        std::vector<uint8_t> buffer;
-
         // Create Downloader Metadata
         DownloaderMetadata metaData;
         metaData.downloaderInstance = curlHandle;
@@ -472,42 +557,50 @@ extern "C" namespace ClektronSystem
         curl_easy_setopt(curlHandle, CURLOPT_SSL_VERIFYHOST, 2L);
 
         // Set Write Function
-        curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, OnDownloadBufferWrite);
-        curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, &buffer);
+        curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, writeFunction);
+        curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, writeData);
 
         // Configuring Curl
         curl_easy_setopt(curlHandle, CURLOPT_FOLLOWLOCATION, 1L);
         curl_easy_setopt(curlHandle, CURLOPT_HTTPPROXYTUNNEL, 1L);
         curl_easy_setopt(curlHandle, CURLOPT_USERAGENT, "Jenova Clektron Downloader/1.0 (Microsoft Windows) (x64) English");
         curl_easy_setopt(curlHandle, CURLOPT_VERBOSE, 0L);
+        curl_easy_setopt(curlHandle, CURLOPT_FAILONERROR, 1L);
+        curl_easy_setopt(curlHandle, CURLOPT_NOSIGNAL, 1L);
         curl_easy_setopt(curlHandle, CURLOPT_REDIR_PROTOCOLS, CURLPROTO_HTTP | CURLPROTO_HTTPS);
 
-        // Set Progress Function
+        // Set Progress Function [Also Polls Cancellation]
         curl_easy_setopt(curlHandle, CURLOPT_XFERINFOFUNCTION, OnDownloadProgress);
         curl_easy_setopt(curlHandle, CURLOPT_XFERINFODATA, &metaData);
         curl_easy_setopt(curlHandle, CURLOPT_NOPROGRESS, 0L);
 
         // Perform Download
-        res = curl_easy_perform(curlHandle);
+        CURLcode res = curl_easy_perform(curlHandle);
+        curl_easy_cleanup(curlHandle);
 
         // Check For Errors During Download
         if (res != CURLE_OK)
         {
-            std::vector<uint8_t>().swap(buffer);
-            curl_easy_cleanup(curlHandle);
-            curlHandle = nullptr;
-            jenova::Error("Clektron Script System",curl_easy_strerror(res));
+            if (res == CURLE_ABORTED_BY_CALLBACK && IsExecutionCancelled()) jenova::Warning("Clektron Script System", "Download Cancelled.");
+            else jenova::Error("Clektron Script System",curl_easy_strerror(res));
             return false;
         }
 
+        // All Good
+        return true;
+    }
+
+    bool API_DownloadToBuffer(CString fileURL, Buffer* outBuffer, Size* bufferSize, FunctionPtr downloadCallback)
+    {
+        // Download Into Temporary Buffer
+        std::vector<uint8_t> buffer;
+        if (!PerformDownload(fileURL, &OnDownloadBufferWrite, &buffer, downloadCallback)) return false;
+
         // Allocate Output Buffer
         *bufferSize = Size(buffer.size());
         *outBuffer = new(std::nothrow) uint8_t[*bufferSize];
         if (!*outBuffer)
         {
-            std::vector<uint8_t>().swap(buffer);
-            curl_easy_cleanup(curlHandle);
-            curlHandle = nullptr;
             jenova::Error("Clektron Script System","Failed to allocate memory for download buffer.");
             return false;
         }
@@ -515,15 +608,28 @@ extern "C" namespace ClektronSystem
         // Copy Data from Temp Buffer into Raw Buffer
         std::memcpy(*outBuffer, buffer.data(), buffer.size());
 
-        // Clean Up CURL
-        std::vector<uint8_t>().swap(buffer);
-        curl_easy_cleanup(curlHandle);
-        curl_global_cleanup();
-        curlHandle = nullptr;
-
         // All Good
         return true;
     }
+    bool API_DownloadToFile(CString fileURL, CString filePath, FunctionPtr downloadCallback)
+    {
+        // Stream Directly To Disk [Partial Files Are Removed On Failure]
+        std::ofstream outFile(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!outFile.is_open())
+        {
+            jenova::Error("Clektron Script System", InternalFormat("Failed to create download file %s", filePath));
+            return false;
+        }
+        bool downloadResult = PerformDownload(fileURL, &OnDownloadFileWrite, &outFile, downloadCallback);
+        outFile.close();
+        if (!downloadResult || outFile.fail())
+        {
+            std::error_code removeError;
+            std::filesystem::remove(filePath, removeError);
+            return false;
+        }
+        return true;
+    }
     void API_FreeDownloadBuffer(Buffer* dataBuffer)
     {
         if (dataBuffer && *dataBuffer)
@@ -586,6 +692,7 @@ extern "C" namespace ClektronSystem
                 la_int64_t offset;
                 for (;;)
                 {
+                    if (IsExecutionCancelled()) return (ARCHIVE_FATAL);
                     r = archive_read_data_block(ar, &buff, &size, &offset);
                     if (r == ARCHIVE_EOF) return (ARCHIVE_OK);
                     if (r < ARCHIVE_OK) return (r);
@@ -607,21 +714,44 @@ extern "C" namespace ClektronSystem
         // Count Total Files
         totalEntityCount = countEntities(archivePath);
 
-        // Extract Package
+        // Extract Package [Entries Stream From Archive To Disk Block By Block]
         a = archive_read_new();
         archive_read_support_format_all(a);
         archive_read_support_filter_all(a);
         ext = archive_write_disk_new();
         archive_write_disk_set_options(ext, flags);
         archive_write_disk_set_standard_lookup(ext);
-        if ((r = archive_read_open_filename(a, archivePath, 10240))) return false;
+        auto releaseArchives = [&]()
+            {
+                archive_read_close(a);
+                archive_read_free(a);
+                archive_write_close(ext);
+                archive_write_free(ext);
+            };
+        if ((r = archive_read_open_filename(a, archivePath, 10240)))
+        {
+            releaseArchives();
+            return false;
+        }
         for (;;)
         {
+            // Stop If Execution Cancelled
+            if (IsExecutionCancelled())
+            {
+                jenova::Warning("Clektron Script System", "Archive Extraction Cancelled.");
+                releaseArchives();
+                return false;
+            }
+
             // Read Next Header
             r = archive_read_next_header(a, &entry);
             if (r == ARCHIVE_EOF) break;
             if (r < ARCHIVE_OK) jenova::Error("Clektron Script System",InternalFormat("Failed to extract archive, Reason [%d] : %s", __LINE__, archive_error_string(a)));
-            if (r < ARCHIVE_WARN) return false;
+            if (r < ARCHIVE_WARN)
+            {
+                releaseArchives();
+                return false;
+            }
 
             // Set Output Path
             std::string newFilePath = destinationPath + std::string("/") + std::string(archive_entry_pathname(entry));
@@ -633,24 +763,32 @@ extern "C" namespace ClektronSystem
             else if (archive_entry_size(entry) > 0)
             {
                 r = copyData(a, ext);
-                if (r < ARCHIVE_OK) jenova::Error("Clektron Script System",InternalFormat("Failed to extract archive, Reason [%d] : %s", __LINE__, archive_error_string(a)));
-                if (r < ARCHIVE_WARN) return false;
+                if (r < ARCHIVE_OK && !IsExecutionCancelled()) jenova::Error("Clektron Script System",InternalFormat("Failed to extract archive, Reason [%d] : %s", __LINE__, archive_error_string(a)));
+                if (r < ARCHIVE_WARN)
+                {
+                    if (IsExecutionCancelled()) jenova::Warning("Clektron Script System", "Archive Extraction Cancelled.");
+                    releaseArchives();
+                    return false;
+                }
             }
             r = archive_write_finish_entry(ext);
             if (r < ARCHIVE_OK) jenova::Error("Clektron Script System",InternalFormat("Failed to extract archive, Reason [%d] : %s", __LINE__, archive_error_string(a)));
-            if (r < ARCHIVE_WARN) return false;
+            if (r < ARCHIVE_WARN)
+            {
+                releaseArchives();
+                return false;
+            }
 
             // Count Extracted Files
             if (archive_entry_filetype(entry) == AE_IFREG)
             {
-                if (ExtractionCallback) ExtractionCallback("Extracted", std::filesystem::path(archive_entry_pathname(entry)).filename().string().c_str(), entityIndex, totalEntityCount);
+                std::string extractedFileName = std::filesystem::path(archive_entry_pathname(entry)).filename().string();
+                if (ExtractionCallback) ExtractionCallback("Extracted", extractedFileName.c_str(), entityIndex, totalEntityCount);
                 entityIndex++;
+                if (totalEntityCount > 0) UpdateExecutionProgress(double(entityIndex) / double(totalEntityCount), extractedFileName.c_str());
             }
         }
-        archive_read_close(a);
-        archive_read_free(a);
-        archive_write_close(ext);
-        archive_write_free(ext);
+        releaseArchives();
 
         // All Good
         return true;
@@ -734,6 +872,88 @@ extern "C" namespace ClektronSystem
         std::string stringB(strB);
         return stringA == stringB;
     }
+
+    // Execution API
+    bool API_IsCancelled()
+    {
+        return IsExecutionCancelled();
+    }
+    void API_ReportProgress(double progress, CString status)
+    {
+        UpdateExecutionProgress(std::clamp(progress, 0.0, 1.0), status);
+    }
+}
+
+// Jenova Clektron Object Cache
+namespace jenova::clektron
+{
+    std::string GetObjectCacheDirectory()
+    {
+        return AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::ClektronObjectCacheDirectory;
+    }
+    std::string GetCachedObjectPath(const std::string& ctronFinalScript)
+    {
+        // Runtime And API Versions Are Part Of Name, Objects From Other Builds Are Never Linked
+        String sourceHash = godot::String::utf8(ctronFinalScript.c_str()).md5_text();
+        return GetObjectCacheDirectory() + jenova::Format("%s-%s-%zu.o", AS_C_STRING(sourceHash), APP_VERSION, jenova::GlobalSettings::ClektronAPIVersion);
+    }
+    TCCState* CreateCompilerState(int outputType)
+    {
+        // Initialize TCC Compiler
+        TCCState* tcc = tcc_new();
+        if (!tcc) return nullptr;
+
+        // Create Error Handler
+        auto tcc_error_handler = [](void* opaque, const char* msg) -> void
+        {
+            std::string errorMessage(msg);
+            jenova::ReplaceAllMatchesWithString(errorMessage, "<string>:", "At Line ");
+            jenova::Error("Clektron Script Engine", ClektronSystem::InternalFormat("Clektron Compiler Encountered Error :\n%s", errorMessage.c_str()));
+        };
+        tcc_set_error_func(tcc, nullptr, tcc_error_handler);
+
+        // Configure TCC Compiler
+        tcc_set_output_type(tcc, outputType);
+        tcc_set_options(tcc, "-nostdlib");
+        return tcc;
+    }
+    void PruneObjectCache()
+    {
+        // Evict Least Recently Used Objects [Cache Hits Refresh Write Time]
+        std::error_code cacheError;
+        std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> cachedObjects;
+        std::filesystem::directory_iterator cacheIterator(GetObjectCacheDirectory(), cacheError);
+        for (; !cacheError && cacheIterator != std::filesystem::directory_iterator(); cacheIterator.increment(cacheError))
+        {
+            if (cacheIterator->path().extension() != ".o") continue;
+            cachedObjects.emplace_back(cacheIterator->last_write_time(cacheError), cacheIterator->path());
+        }
+        if (cachedObjects.size() <= jenova::GlobalSettings::ClektronScriptCacheSize) return;
+        std::sort(cachedObjects.begin(), cachedObjects.end());
+        for (size_t i = 0; i < cachedObjects.size() - jenova::GlobalSettings::ClektronScriptCacheSize; i++) std::filesystem::remove(cachedObjects[i].second, cacheError);
+    }
+    bool CompileScriptObject(const std::string& ctronFinalScript, const std::string& objectCachePath)
+    {
+        // Caller Must Hold Compiler Mutex
+        TCCState* tcc = CreateCompilerState(TCC_OUTPUT_OBJ);
+        if (!tcc) return false;
+        std::error_code cacheError;
+        std::filesystem::create_directories(GetObjectCacheDirectory(), cacheError);
+
+        // Write Through Temporary File, Other Processes Never Link A Partial Object
+        std::string temporaryObjectPath = objectCachePath + "." + jenova::GenerateRandomHashString();
+        bool isCompiled = tcc_compile_string(tcc, ctronFinalScript.c_str()) != -1 && tcc_output_file(tcc, temporaryObjectPath.c_str()) != -1;
+        tcc_delete(tcc);
+        if (isCompiled) std::filesystem::rename(temporaryObjectPath, objectCachePath, cacheError);
+        if (!isCompiled || cacheError)
+        {
+            std::filesystem::remove(temporaryObjectPath, cacheError);
+            return false;
+        }
+        compilationCount.fetch_add(1, std::memory_order_relaxed);
+        PruneObjectCache();
+        return true;
+    }
 }
 
 // Jenova Clektron Syntax Highlighter
@@ -823,6 +1043,10 @@ void Clektron::init()
     // Register Syntax Highlighter
     ClassDB::register_class<ClektronHighlighter>();
 
+    // Register Script Context And Task
+    ClassDB::register_class<ClektronContext>();
+    ClassDB::register_class<ClektronTask>();
+
     // Initialize Singleton
     singleton = memnew(Clektron);
 
@@ -831,6 +1055,9 @@ void Clektron::init()
 }
 void Clektron::deinit()
 {
+    // Stop Running Scripts Before Their Code Is Released
+    if (singleton) singleton->CancelAsyncExecutions();
+
     // Release Singleton
     if (singleton) memdelete(singleton);
 }
@@ -841,6 +1068,27 @@ void Clektron::_bind_methods()
     ClassDB::bind_static_method("Clektron", D_METHOD("GetInstance"), &Clektron::get_singleton);
     ClassDB::bind_method(D_METHOD("ExecuteScript"), static_cast<bool (Clektron::*)(const godot::String&, bool)>(&Clektron::ExecuteScript));
     ClassDB::bind_method(D_METHOD("ExecuteScriptFromFile"), static_cast<bool (Clektron::*)(const godot::String&, bool)>(&Clektron::ExecuteScriptFromFile));
+    ClassDB::bind_method(D_METHOD("ExecuteScriptAsync"), static_cast<Ref<ClektronTask> (Clektron::*)(const godot::String&, bool)>(&Clektron::ExecuteScriptAsync));
+    ClassDB::bind_method(D_METHOD("ExecuteScriptFromFileAsync"), static_cast<Ref<ClektronTask> (Clektron::*)(const godot::String&, bool)>(&Clektron::ExecuteScriptFromFileAsync));
+    ClassDB::bind_method(D_METHOD("ClearScriptCache"), &Clektron::ClearScriptCache);
+}
+void ClektronTask::_bind_methods()
+{
+    ClassDB::bind_method(D_METHOD("IsComplete"), &ClektronTask::IsComplete);
+    ClassDB::bind_method(D_METHOD("GetResult"), &ClektronTask::GetResult);
+    ClassDB::bind_method(D_METHOD("GetProgress"), &ClektronTask::GetProgress);
+    ClassDB::bind_method(D_METHOD("GetStatus"), &ClektronTask::GetStatus);
+    ClassDB::bind_method(D_METHOD("Cancel"), &ClektronTask::Cancel);
+    ClassDB::bind_method(D_METHOD("IsCancelled"), &ClektronTask::IsCancelled);
+    ClassDB::bind_method(D_METHOD("Wait"), &ClektronTask::Wait);
+}
+void ClektronContext::_bind_methods()
+{
+    ClassDB::bind_method(D_METHOD("LoadScript"), static_cast<bool (ClektronContext::*)(const godot::String&, bool)>(&ClektronContext::LoadScript));
+    ClassDB::bind_method(D_METHOD("LoadScriptFromFile"), static_cast<bool (ClektronContext::*)(const godot::String&, bool)>(&ClektronContext::LoadScriptFromFile));
+    ClassDB::bind_method(D_METHOD("IsLoaded"), &ClektronContext::IsLoaded);
+    ClassDB::bind_method(D_METHOD("Execute"), &ClektronContext::Execute);
+    ClassDB::bind_method(D_METHOD("Unload"), &ClektronContext::Unload);
 }
 
 // Singleton Handling
@@ -860,89 +1108,34 @@ Clektron::~Clektron()
 }
 bool Clektron::ExecuteScript(const std::string& ctronScriptContent, bool noEntrypoint)
 {
-    // Validate Script Content
-    if (ctronScriptContent.empty())
-    {
-        jenova::Error("Clektron Script Engine", "Invalid Script Content.");
-        return false;
-    }
+    // Link Fresh Image From Cached Object, Globals Start From Their Initializers On Every Execution
+    std::shared_ptr<jenova::clektron::CompiledScript> compiledScript = this->CompileScript(ctronScriptContent, noEntrypoint);
+    if (!compiledScript) return false;
 
-    // Initialize TCC Compiler
-    TCCState* tcc = tcc_new();
-    if (!tcc)
+    // Get Compiled Caller Function
+    if (!compiledScript->entrypoint)
     {
-        jenova::Error("Clektron Script Engine", "Failed to Create Clektron Compiler.");
+        jenova::Error("Clektron Script Engine", "Failed to Execute Clektron Script.");
         return false;
     }
 
-    // Create Error Handler
-    auto tcc_error_handler = [](void* opaque, const char* msg) -> void
-    {
-        std::string errorMessage(msg);
-        jenova::ReplaceAllMatchesWithString(errorMessage, "<string>:", "At Line ");
-        jenova::Error("Clektron Script Engine", ClektronSystem::InternalFormat("Clektron Compiler Encountered Error :\n%s", errorMessage.c_str()));
-    };
-    tcc_set_error_func(tcc, this, tcc_error_handler);
-
-    // Configure TCC Compiler
-    tcc_set_output_type(tcc, TCC_OUTPUT_MEMORY);
-    tcc_set_options(tcc, "-nostdlib");
-
-    // Register User Interface API Symbols
-    AddSymbol(Alert);
-    AddSymbol(Wait);
-    AddSymbol(Refresh);
-    AddSymbol(Exit);
-
-    // Register File Manager API Symbols
-    AddSymbol(DoesFileExist);
-    AddSymbol(DoesDirectoryExist);
-    AddSymbol(WriteStringToFile);
-    AddSymbol(ReadStringFromFile);
-    AddSymbol(MakeDirectory);
-    AddSymbol(GetFileSize);
-    AddSymbol(RenameFile);
-    AddSymbol(RenameDirectory);
-    AddSymbol(MoveFile);
-    AddSymbol(MoveDirectory);
-    AddSymbol(RemoveFile);
-    AddSymbol(RemoveDirectory);
-    AddSymbol(CreateFile);
-    AddSymbol(OpenFile);
-    AddSymbol(WriteFile);
-    AddSymbol(ReadFile);
-    AddSymbol(CloseFile);
-
-    // Register Memory Manager API Symbols
-    AddSymbol(Allocate);
-    AddSymbol(Free);
-    AddSymbol(Delete);
-    AddSymbol(CopyMemory);
-    AddSymbol(ZeroMemory);
-    AddSymbol(CompareMemory);
-
-    // Register Downloader API Symbols
-    AddSymbol(DownloadToBuffer);
-    AddSymbol(FreeDownloadBuffer);
+    // Execute Caller
+    bool result = compiledScript->entrypoint();
 
-    // Register Archive API Symbols
-    AddSymbol(ExtractArchive);
+    // Verbose If Failed
+    if (!result) jenova::Warning("Clektron Script Engine", "Script Entrypoint Returned False.");
 
-    // Register Utility API Symbols
-    AddSymbol(Print);
-    AddSymbol(PrintError);
-    AddSymbol(PrintWarning);
-    AddSymbol(Format);
-    AddSymbol(System);
-    AddSymbol(GetFileMD5Hash);
-    AddSymbol(GetOperatingSystem);
-    AddSymbol(GetOperatingSystemName);
-    AddSymbol(HasAdministratorAccess);
-    AddSymbol(LoadModule);
-    AddSymbol(GetModuleFunction);
-    AddSymbol(FreeModule);
-    AddSymbol(CombineStrings);
-    AddSymbol(CompareStrings);
+    // Return Result
+    return result;
+}
+std::shared_ptr<jenova::clektron::CompiledScript> Clektron::CompileScript(const std::string& ctronScriptContent, bool noEntrypoint)
+{
+    // Validate Script Content
+    if (ctronScriptContent.empty())
+    {
+        jenova::Error("Clektron Script Engine", "Invalid Script Content.");
+        return nullptr;
+    }
 
     // Generate Final Script Code
     std::string ctronFinalScript = 
@@ -987,6 +1180,7 @@ bool Clektron::ExecuteScript(const std::string& ctronScriptContent, bool noEntry
     Instance OpenFile(String filePath);
     bool WriteFile(Instance fileInstance, Buffer bufferPtr, Size bufferSize);
     bool ReadFile(Instance fileInstance, Buffer bufferPtr, Size readPosition, Size readSize);
+    Size ReadFileChunk(Instance fileInstance, Buffer bufferPtr, Size chunkSize);
     bool CloseFile(Instance fileInstance);
 
     // Memory Manager API Symbols
@@ -999,6 +1193,7 @@ bool Clektron::ExecuteScript(const std::string& ctronScriptContent, bool noEntry
 
     // Downloader API Symbols
     bool DownloadToBuffer(String fileURL, Buffer* outBuffer, Size* bufferSize, FunctionPtr downloadCallback);
+    bool DownloadToFile(String fileURL, String filePath, FunctionPtr downloadCallback);
     void FreeDownloadBuffer(Buffer* dataBuffer);
 
     // Archive API Symbols
@@ -1020,6 +1215,10 @@ bool Clektron::ExecuteScript(const std::string& ctronScriptContent, bool noEntry
     String CombineStrings(String strA, String strB);
     bool CompareStrings(String strA, String strB);
 
+    // Execution API Symbols
+    bool IsCancelled();
+    void ReportProgress(double progress, String status);
+
     // Reset Line Number
     #line 1
     )";
@@ -1041,42 +1240,206 @@ bool Clektron::ExecuteScript(const std::string& ctronScriptContent, bool noEntry
         ctronFinalScript += "}";
     }
 
-    // Compile Clektron Code
-    if (tcc_compile_string(tcc, ctronFinalScript.c_str()) == -1)
+    // Cached Object Is Keyed By Final Source Content, Runtime Version And Clektron API Version
+    std::string objectCachePath = jenova::clektron::GetCachedObjectPath(ctronFinalScript);
+
+    // TinyCC Is Not Reentrant, Compiling And Linking Share One Lock
+    std::lock_guard<std::mutex> compilerLock(jenova::clektron::compilerMutex);
+    JenovaTinyProfiler::CreateCheckpoint("ClektronCompileScript");
+
+    // Compile Into Object Cache Once, Same Script Skips TinyCC Front-End On Later Runs
+    std::error_code cacheError;
+    bool isCachedObject = std::filesystem::exists(objectCachePath, cacheError);
+    if (isCachedObject)
+    {
+        // Refresh Last Use For Eviction
+        std::filesystem::last_write_time(objectCachePath, std::filesystem::file_time_type::clock::now(), cacheError);
+    }
+    else if (!jenova::clektron::CompileScriptObject(ctronFinalScript, objectCachePath))
     {
         jenova::Error("Clektron Script Engine", "Failed to Compile Clektron Script.");
+        return nullptr;
+    }
+
+    // Create Fresh Image For Every Call, Globals Start From Their Initializers [Contexts Are The Way To Reuse One]
+    TCCState* tcc = jenova::clektron::CreateCompilerState(TCC_OUTPUT_MEMORY);
+    if (!tcc)
+    {
+        jenova::Error("Clektron Script Engine", "Failed to Create Clektron Compiler.");
+        return nullptr;
+    }
+
+    // Register User Interface API Symbols
+    AddSymbol(Alert);
+    AddSymbol(Wait);
+    AddSymbol(Refresh);
+    AddSymbol(Exit);
+
+    // Register File Manager API Symbols
+    AddSymbol(DoesFileExist);
+    AddSymbol(DoesDirectoryExist);
+    AddSymbol(WriteStringToFile);
+    AddSymbol(ReadStringFromFile);
+    AddSymbol(MakeDirectory);
+    AddSymbol(GetFileSize);
+    AddSymbol(RenameFile);
+    AddSymbol(RenameDirectory);
+    AddSymbol(MoveFile);
+    AddSymbol(MoveDirectory);
+    AddSymbol(RemoveFile);
+    AddSymbol(RemoveDirectory);
+    AddSymbol(CreateFile);
+    AddSymbol(OpenFile);
+    AddSymbol(WriteFile);
+    AddSymbol(ReadFile);
+    AddSymbol(ReadFileChunk);
+    AddSymbol(CloseFile);
+
+    // Register Memory Manager API Symbols
+    AddSymbol(Allocate);
+    AddSymbol(Free);
+    AddSymbol(Delete);
+    AddSymbol(CopyMemory);
+    AddSymbol(ZeroMemory);
+    AddSymbol(CompareMemory);
+
+    // Register Downloader API Symbols
+    AddSymbol(DownloadToBuffer);
+    AddSymbol(DownloadToFile);
+    AddSymbol(FreeDownloadBuffer);
+
+    // Register Archive API Symbols
+    AddSymbol(ExtractArchive);
+
+    // Register Utility API Symbols
+    AddSymbol(Print);
+    AddSymbol(PrintError);
+    AddSymbol(PrintWarning);
+    AddSymbol(Format);
+    AddSymbol(System);
+    AddSymbol(GetFileMD5Hash);
+    AddSymbol(GetOperatingSystem);
+    AddSymbol(GetOperatingSystemName);
+    AddSymbol(HasAdministratorAccess);
+    AddSymbol(LoadModule);
+    AddSymbol(GetModuleFunction);
+    AddSymbol(FreeModule);
+    AddSymbol(CombineStrings);
+    AddSymbol(CompareStrings);
+
+    // Register Execution API Symbols
+    AddSymbol(IsCancelled);
+    AddSymbol(ReportProgress);
+
+    // Link Cached Object
+    if (tcc_add_file(tcc, objectCachePath.c_str()) == -1)
+    {
+        // Drop Unreadable Object So Next Call Compiles Again
+        jenova::Error("Clektron Script Engine", "Failed to Load Compiled Clektron Script.");
+        std::filesystem::remove(objectCachePath, cacheError);
         tcc_delete(tcc);
-        return false;
+        return nullptr;
     }
 
+    // Measure Relocated Image For Memory Tracker [Context Images Are Long Lived]
+    int relocatedImageSize = tcc_relocate(tcc, nullptr);
+
     // Prepare For Execution
-    if (tcc_relocate(tcc, TCC_RELOCATE_AUTO) < 0) {
+    if (relocatedImageSize < 0 || tcc_relocate(tcc, TCC_RELOCATE_AUTO) < 0) {
         jenova::Error("Clektron Script Engine", "Failed to Resolve Clektron Script.");
         tcc_delete(tcc);
-        return false;
+        return nullptr;
     }
 
-    // Get Compiled Caller Function
-    using ClektronMainFunction = bool*(*)();
-    ClektronMainFunction ctronEntrypoint = (ClektronMainFunction)tcc_get_symbol(tcc, "ClektronMain");
-    if (!ctronEntrypoint)
+    // Create Compiled Script [Entrypoint Is Optional For Contexts]
+    auto compiledScript = std::make_shared<jenova::clektron::CompiledScript>();
+    compiledScript->tcc = tcc;
+    compiledScript->entrypoint = (jenova::clektron::ClektronMainFunction)tcc_get_symbol(tcc, "ClektronMain");
+    compiledScript->imageSize = size_t(relocatedImageSize);
+    JenovaMemoryTracker::TrackAllocation(jenova::MemoryTag::JITCode, compiledScript->imageSize);
+    JENOVA_VERBOSE("Clektron Script %s (%d Bytes) In %.3f ms", isCachedObject ? "Linked From Cache" : "Compiled", relocatedImageSize, JenovaTinyProfiler::GetCheckpointTimeAndDispose("ClektronCompileScript"));
+
+    // Return Compiled Script
+    return compiledScript;
+}
+size_t Clektron::GetCompilationCount() const
+{
+    return jenova::clektron::compilationCount.load(std::memory_order_relaxed);
+}
+void Clektron::ClearScriptCache()
+{
+    std::lock_guard<std::mutex> compilerLock(jenova::clektron::compilerMutex);
+    std::error_code cacheError;
+    std::filesystem::remove_all(jenova::clektron::GetObjectCacheDirectory(), cacheError);
+}
+Ref<ClektronTask> Clektron::ExecuteScriptAsync(const std::string& ctronScriptContent, bool noEntrypoint, jenova::clektron::ProgressCallback progressCallback)
+{
+    // Link On Calling Thread, Each Execution Owns Its Image So Concurrent Runs Never Share Globals
+    std::shared_ptr<jenova::clektron::CompiledScript> compiledScript = this->CompileScript(ctronScriptContent, noEntrypoint);
+    if (!compiledScript) return Ref<ClektronTask>();
+    if (!compiledScript->entrypoint)
     {
         jenova::Error("Clektron Script Engine", "Failed to Execute Clektron Script.");
-        tcc_delete(tcc);
-        return false;
+        return Ref<ClektronTask>();
     }
 
-    // Execute Caller
-    bool result = ctronEntrypoint();
-
-    // Verbose If Failed
-    if (!result) jenova::Warning("Clektron Script Engine", "Script Entrypoint Returned False.");
-
-    // Clean up TCC
-    tcc_delete(tcc);
+    // Create Execution
+    auto scriptExecution = std::make_shared<jenova::clektron::ScriptExecution>();
+    scriptExecution->compiledScript = compiledScript;
+    scriptExecution->progressCallback = progressCallback;
 
-    // Return Result
-    return result;
+    // Run Entrypoint On Task System
+    std::lock_guard<std::mutex> executionLock(jenova::clektron::asyncExecutionMutex);
+    for (auto execution = jenova::clektron::asyncExecutions.begin(); execution != jenova::clektron::asyncExecutions.end();)
+    {
+        if (!JenovaTaskSystem::IsTaskComplete(execution->first)) { ++execution; continue; }
+        JenovaTaskSystem::ClearTask(execution->first);
+        execution = jenova::clektron::asyncExecutions.erase(execution);
+    }
+    jenova::TaskID taskID = JenovaTaskSystem::InitiateTask([scriptExecution]()
+    {
+        ClektronSystem::currentExecution = scriptExecution.get();
+        bool result = scriptExecution->compiledScript->entrypoint();
+        ClektronSystem::currentExecution = nullptr;
+        if (!result && !scriptExecution->isCancelled.load()) jenova::Warning("Clektron Script Engine", "Script Entrypoint Returned False.");
+        scriptExecution->result.store(result);
+        {
+            std::lock_guard<std::mutex> stateLock(scriptExecution->stateMutex);
+            scriptExecution->isComplete.store(true);
+        }
+        scriptExecution->completionCondition.notify_all();
+    });
+    jenova::clektron::asyncExecutions.emplace_back(taskID, scriptExecution);
+
+    // Return Task Handle
+    Ref<ClektronTask> clektronTask;
+    clektronTask.instantiate();
+    clektronTask->scriptExecution = scriptExecution;
+    return clektronTask;
+}
+Ref<ClektronTask> Clektron::ExecuteScriptAsync(const godot::String& ctronScriptContent, bool noEntrypoint)
+{
+    return this->ExecuteScriptAsync(AS_STD_STRING(ctronScriptContent), noEntrypoint);
+}
+Ref<ClektronTask> Clektron::ExecuteScriptFromFileAsync(const std::string& ctronScriptFilePath, bool noEntrypoint, jenova::clektron::ProgressCallback progressCallback)
+{
+    return this->ExecuteScriptAsync(jenova::ReadStdStringFromFile(ctronScriptFilePath), noEntrypoint, progressCallback);
+}
+Ref<ClektronTask> Clektron::ExecuteScriptFromFileAsync(const godot::String& ctronScriptFilePath, bool noEntrypoint)
+{
+    return this->ExecuteScriptFromFileAsync(AS_STD_STRING(ctronScriptFilePath), noEntrypoint);
+}
+void Clektron::CancelAsyncExecutions()
+{
+    // Cancel All Then Wait, Scripts Ignoring Cancellation Still Have To Finish
+    std::lock_guard<std::mutex> executionLock(jenova::clektron::asyncExecutionMutex);
+    for (auto& execution : jenova::clektron::asyncExecutions) execution.second->isCancelled.store(true);
+    for (auto& execution : jenova::clektron::asyncExecutions)
+    {
+        while (!JenovaTaskSystem::IsTaskComplete(execution.first)) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        JenovaTaskSystem::ClearTask(execution.first);
+    }
+    jenova::clektron::asyncExecutions.clear();
 }
 bool Clektron::ExecuteScript(const godot::String& ctronScriptContent, bool noEntrypoint)
 {
@@ -1089,4 +1452,91 @@ bool Clektron::ExecuteScriptFromFile(const std::string& ctronScriptFilePath, boo
 bool Clektron::ExecuteScriptFromFile(const godot::String& ctronScriptFilePath, bool noEntrypoint)
 {
     return this->ExecuteScriptFromFile(AS_STD_STRING(ctronScriptFilePath), noEntrypoint);
-}
\ No newline at end of file
+}
+
+// Jenova Clektron Context Implementation
+ClektronContext::ClektronContext()
+{
+
+}
+ClektronContext::~ClektronContext()
+{
+    this->Unload();
+}
+bool ClektronContext::LoadScript(const std::string& ctronScriptContent, bool noEntrypoint)
+{
+    std::shared_ptr<jenova::clektron::CompiledScript> loadedScript = Clektron::get_singleton()->CompileScript(ctronScriptContent, noEntrypoint);
+    if (!loadedScript) return false;
+    compiledScript = loadedScript;
+    return true;
+}
+bool ClektronContext::LoadScript(const godot::String& ctronScriptContent, bool noEntrypoint)
+{
+    return this->LoadScript(AS_STD_STRING(ctronScriptContent), noEntrypoint);
+}
+bool ClektronContext::LoadScriptFromFile(const std::string& ctronScriptFilePath, bool noEntrypoint)
+{
+    return this->LoadScript(jenova::ReadStdStringFromFile(ctronScriptFilePath), noEntrypoint);
+}
+bool ClektronContext::LoadScriptFromFile(const godot::String& ctronScriptFilePath, bool noEntrypoint)
+{
+    return this->LoadScriptFromFile(AS_STD_STRING(ctronScriptFilePath), noEntrypoint);
+}
+bool ClektronContext::IsLoaded() const
+{
+    return compiledScript != nullptr;
+}
+bool ClektronContext::Execute()
+{
+    if (!compiledScript || !compiledScript->entrypoint)
+    {
+        jenova::Error("Clektron Script Engine", "Clektron Context Has No Loaded Entrypoint.");
+        return false;
+    }
+    std::lock_guard<std::mutex> executionLock(executionMutex);
+    return compiledScript->entrypoint();
+}
+void* ClektronContext::GetFunction(const std::string& functionName) const
+{
+    if (!compiledScript) return nullptr;
+    return tcc_get_symbol(compiledScript->tcc, functionName.c_str());
+}
+void ClektronContext::Unload()
+{
+    compiledScript.reset();
+}
+
+// Jenova Clektron Task Implementation
+bool ClektronTask::IsComplete() const
+{
+    return !scriptExecution || scriptExecution->isComplete.load();
+}
+bool ClektronTask::GetResult() const
+{
+    return scriptExecution && scriptExecution->isComplete.load() && scriptExecution->result.load();
+}
+double ClektronTask::GetProgress() const
+{
+    return scriptExecution ? scriptExecution->progress.load(std::memory_order_relaxed) : 0.0;
+}
+String ClektronTask::GetStatus() const
+{
+    if (!scriptExecution) return String();
+    std::lock_guard<std::mutex> stateLock(scriptExecution->stateMutex);
+    return String(scriptExecution->status.c_str());
+}
+void ClektronTask::Cancel()
+{
+    if (scriptExecution) scriptExecution->isCancelled.store(true);
+}
+bool ClektronTask::IsCancelled() const
+{
+    return scriptExecution && scriptExecution->isCancelled.load();
+}
+bool ClektronTask::Wait()
+{
+    if (!scriptExecution) return false;
+    std::unique_lock<std::mutex> stateLock(scriptExecution->stateMutex);
+    scriptExecution->completionCondition.wait(stateLock, [this]() { return scriptExecution->isComplete.load(); });
+    return scriptExecution->result.load();
+}
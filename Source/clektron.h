@@ -16,7 +16,46 @@
 // Jenova SDK
 #include "Jenova.hpp"
 
+// Jenova Clektron Compiled Script
+namespace jenova::clektron
+{
+	struct CompiledScript;
+	struct ScriptExecution;
+	typedef std::function<void(double progress, const std::string& status)> ProgressCallback;
+}
+
+// Jenova Clektron Task Definition
+/*
+	Handle To A Script Started With ExecuteScriptAsync. Cancellation Is Cooperative, Wait, Downloads And Archive
+	Extraction Stop On Their Own While Long Running Scripts Should Poll IsCancelled Between Their Steps.
+*/
+class ClektronTask : public RefCounted
+{
+	GDCLASS(ClektronTask, RefCounted);
+	friend class Clektron;
+
+protected:
+	static void _bind_methods();
+
+public:
+	bool IsComplete() const;
+	bool GetResult() const;
+	double GetProgress() const;
+	String GetStatus() const;
+	void Cancel();
+	bool IsCancelled() const;
+	bool Wait();
+
+private:
+	std::shared_ptr<jenova::clektron::ScriptExecution> scriptExecution;
+};
+
 // Jenova Clektron Script Engine Definition
+/*
+	Scripts Are Compiled Once Into An Object Cached On Disk By Content Hash, Runtime And API Version.
+	Every Execution Links That Object Into Its Own Image, Globals Start Fresh And Concurrent Runs Never Share State.
+	Use ClektronContext To Link Once And Execute Many Times.
+*/
 class Clektron : public RefCounted
 {
 	GDCLASS(Clektron, RefCounted);
@@ -38,4 +77,43 @@ public:
 	bool ExecuteScript(const godot::String& ctronScriptContent, bool noEntrypoint = false);
 	bool ExecuteScriptFromFile(const std::string& ctronScriptFilePath, bool noEntrypoint = false);
 	bool ExecuteScriptFromFile(const godot::String& ctronScriptFilePath, bool noEntrypoint = false);
+	Ref<ClektronTask> ExecuteScriptAsync(const std::string& ctronScriptContent, bool noEntrypoint = false, jenova::clektron::ProgressCallback progressCallback = nullptr);
+	Ref<ClektronTask> ExecuteScriptAsync(const godot::String& ctronScriptContent, bool noEntrypoint = false);
+	Ref<ClektronTask> ExecuteScriptFromFileAsync(const std::string& ctronScriptFilePath, bool noEntrypoint = false, jenova::clektron::ProgressCallback progressCallback = nullptr);
+	Ref<ClektronTask> ExecuteScriptFromFileAsync(const godot::String& ctronScriptFilePath, bool noEntrypoint = false);
+	void CancelAsyncExecutions();
+	std::shared_ptr<jenova::clektron::CompiledScript> CompileScript(const std::string& ctronScriptContent, bool noEntrypoint = false);
+	size_t GetCompilationCount() const;
+	void ClearScriptCache();
+};
+
+// Jenova Clektron Context Definition
+/*
+	Holds A Compiled Script So Tools Can Load It Once Then Execute It Or Call Its Functions Many Times.
+	Globals Keep Their Values Between Executions Of A Context, Executions Of One Context Are Serialized.
+*/
+class ClektronContext : public RefCounted
+{
+	GDCLASS(ClektronContext, RefCounted);
+
+protected:
+	static void _bind_methods();
+
+public:
+	ClektronContext();
+	~ClektronContext();
+
+public:
+	bool LoadScript(const std::string& ctronScriptContent, bool noEntrypoint = false);
+	bool LoadScript(const godot::String& ctronScriptContent, bool noEntrypoint = false);
+	bool LoadScriptFromFile(const std::string& ctronScriptFilePath, bool noEntrypoint = false);
+	bool LoadScriptFromFile(const godot::String& ctronScriptFilePath, bool noEntrypoint = false);
+	bool IsLoaded() const;
+	bool Execute();
+	void* GetFunction(const std::string& functionName) const;
+	void Unload();
+
+private:
+	std::shared_ptr<jenova::clektron::CompiledScript> compiledScript;
+	std::mutex executionMutex;
 };
\ No newline at end of file
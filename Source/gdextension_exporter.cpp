@@ -61,8 +61,8 @@ bool GDExtensionExporter::Export()
 				return false;
 			}
 
-			// Compress Built Module 
-			jenova::MemoryBuffer compressedData = jenova::CompressBuffer(jenovaModuleBuffer.data(), jenovaModuleBuffer.size());
+			// Compress Built Module (Prebuilt Extension Host Only Decodes Zlib)
+			jenova::MemoryBuffer compressedData = jenova::CompressBuffer(jenovaModuleBuffer.data(), jenovaModuleBuffer.size(), jenova::CompressionCodec::Zlib);
 
 			// Create Section Data
 			struct JenovaModuleEntity { size_t originalModuleSize, compressedModuleSize; } jenovaModuleEntity { jenovaModuleBuffer.size(), compressedData.size() };
@@ -0,0 +1,208 @@
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Imports
+using GlobalHandle = JenovaGlobalStore::GlobalHandle;
+
+// Jenova Global Store Internal Storage
+namespace jenova::globals
+{
+    // Name Table Is Kept At Most Half Full, Capacity Must Be Power of Two
+    constexpr size_t StoreCapacity = jenova::GlobalSettings::GlobalStoreCapacity;
+    constexpr size_t NameTableCapacity = StoreCapacity * 2;
+    constexpr size_t NameTableMask = NameTableCapacity - 1;
+    constexpr size_t MaxReaders = jenova::GlobalSettings::GlobalStoreMaxReaders;
+    static_assert((NameTableCapacity & NameTableMask) == 0, "Global Store Capacity Must Be Power of Two.");
+
+    // Structures
+    struct NameEntry
+    {
+        size_t nameHash;
+        std::string globalName;
+        GlobalHandle globalHandle;
+    };
+    struct GlobalSlot
+    {
+        std::atomic<void*> pointerValue = nullptr;
+        std::atomic<Variant*> variableValue = nullptr;
+    };
+    struct ReaderSlot
+    {
+        alignas(64) std::atomic<uint64_t> pinnedEpoch = 0;
+        std::atomic<bool> isClaimed = false;
+    };
+    struct RetiredVariable
+    {
+        Variant* variableValue;
+        uint64_t retireEpoch;
+    };
+    struct ReaderRegistration
+    {
+        ReaderSlot* readerSlot = nullptr;
+        bool isResolved = false;
+        ~ReaderRegistration() { if (readerSlot) readerSlot->isClaimed.store(false, std::memory_order_release); }
+    };
+
+    // Global Store State [Entries And Retired Variants Outlive Engine Shutdown On Purpose]
+    static std::atomic<NameEntry*> nameTable[NameTableCapacity];
+    static GlobalSlot globalSlots[StoreCapacity];
+    static std::atomic<uint32_t> globalCount = 0;
+    static ReaderSlot readerSlots[MaxReaders];
+    static std::atomic<uint64_t> globalEpoch = 1;
+    static std::mutex writerMutex;
+    static std::vector<RetiredVariable> retiredVariables;
+    static thread_local ReaderRegistration readerRegistration;
+
+    // Utilities
+    static size_t HashGlobalName(std::string_view globalName)
+    {
+        return std::hash<std::string_view>()(globalName);
+    }
+    static GlobalHandle ProbeNameTable(std::string_view globalName, size_t nameHash, size_t* emptyIndex)
+    {
+        for (size_t probeIndex = nameHash & NameTableMask;; probeIndex = (probeIndex + 1) & NameTableMask)
+        {
+            NameEntry* nameEntry = nameTable[probeIndex].load(std::memory_order_acquire);
+            if (!nameEntry)
+            {
+                if (emptyIndex) *emptyIndex = probeIndex;
+                return JenovaGlobalStore::InvalidHandle;
+            }
+            if (nameEntry->nameHash == nameHash && nameEntry->globalName == globalName) return nameEntry->globalHandle;
+        }
+    }
+    static ReaderSlot* AcquireReaderSlot()
+    {
+        if (readerRegistration.isResolved) return readerRegistration.readerSlot;
+        readerRegistration.isResolved = true;
+        for (size_t i = 0; i < MaxReaders; i++)
+        {
+            bool isClaimed = false;
+            if (!readerSlots[i].isClaimed.compare_exchange_strong(isClaimed, true, std::memory_order_acq_rel)) continue;
+            readerRegistration.readerSlot = &readerSlots[i];
+            break;
+        }
+        return readerRegistration.readerSlot;
+    }
+}
+
+// Jenova Global Store Implementation
+using namespace jenova::globals;
+GlobalHandle JenovaGlobalStore::RegisterGlobal(const char* globalName)
+{
+    // Fast Path, Already Interned
+    if (!globalName) return InvalidHandle;
+    std::string_view globalNameView(globalName);
+    size_t nameHash = HashGlobalName(globalNameView);
+    GlobalHandle globalHandle = ProbeNameTable(globalNameView, nameHash, nullptr);
+    if (globalHandle != InvalidHandle) return globalHandle;
+
+    // Intern Name [Insert Only, Entries Are Published After Construction]
+    std::lock_guard<std::mutex> lock(writerMutex);
+    size_t emptyIndex = 0;
+    globalHandle = ProbeNameTable(globalNameView, nameHash, &emptyIndex);
+    if (globalHandle != InvalidHandle) return globalHandle;
+    if (globalCount.load(std::memory_order_relaxed) >= StoreCapacity)
+    {
+        jenova::Error("Jenova Global Store", "Failed to Register Global '%s', Store Capacity (%zu) Reached.", globalName, StoreCapacity);
+        return InvalidHandle;
+    }
+    globalHandle = globalCount.load(std::memory_order_relaxed);
+    nameTable[emptyIndex].store(new NameEntry{ nameHash, std::string(globalNameView), globalHandle }, std::memory_order_release);
+    globalCount.store(globalHandle + 1, std::memory_order_release);
+    return globalHandle;
+}
+GlobalHandle JenovaGlobalStore::FindGlobal(const char* globalName)
+{
+    if (!globalName) return InvalidHandle;
+    std::string_view globalNameView(globalName);
+    return ProbeNameTable(globalNameView, HashGlobalName(globalNameView), nullptr);
+}
+void* JenovaGlobalStore::GetPointer(GlobalHandle globalHandle)
+{
+    if (globalHandle >= StoreCapacity) return nullptr;
+    return globalSlots[globalHandle].pointerValue.load(std::memory_order_acquire);
+}
+void* JenovaGlobalStore::ExchangePointer(GlobalHandle globalHandle, void* pointerValue)
+{
+    if (globalHandle >= StoreCapacity) return nullptr;
+    return globalSlots[globalHandle].pointerValue.exchange(pointerValue, std::memory_order_acq_rel);
+}
+Variant JenovaGlobalStore::GetVariable(GlobalHandle globalHandle)
+{
+    if (globalHandle >= StoreCapacity) return Variant();
+
+    // Readers Beyond Reader Slot Capacity Fall Back to Writer Lock
+    ReaderSlot* readerSlot = AcquireReaderSlot();
+    if (!readerSlot)
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        Variant* variableValue = globalSlots[globalHandle].variableValue.load(std::memory_order_acquire);
+        return variableValue ? *variableValue : Variant();
+    }
+
+    // Pin Epoch, Copy Current Value And Unpin [Pinned Values Are Not Reclaimed]
+    readerSlot->pinnedEpoch.store(globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    Variant* variableValue = globalSlots[globalHandle].variableValue.load(std::memory_order_seq_cst);
+    Variant result = variableValue ? *variableValue : Variant();
+    readerSlot->pinnedEpoch.store(0, std::memory_order_release);
+    return result;
+}
+bool JenovaGlobalStore::SetVariable(GlobalHandle globalHandle, const Variant& variableValue)
+{
+    if (globalHandle >= StoreCapacity) return false;
+    Variant* newVariableValue = new Variant(variableValue);
+    std::lock_guard<std::mutex> lock(writerMutex);
+    RetireVariable(globalSlots[globalHandle].variableValue.exchange(newVariableValue, std::memory_order_seq_cst));
+    ReclaimVariables();
+    return true;
+}
+void JenovaGlobalStore::ClearVariables()
+{
+    std::lock_guard<std::mutex> lock(writerMutex);
+    uint32_t registeredCount = globalCount.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < registeredCount; i++) RetireVariable(globalSlots[i].variableValue.exchange(nullptr, std::memory_order_seq_cst));
+    ReclaimVariables();
+}
+size_t JenovaGlobalStore::GetGlobalCount()
+{
+    return globalCount.load(std::memory_order_acquire);
+}
+void JenovaGlobalStore::RetireVariable(Variant* variableValue)
+{
+    // Readers That Pinned Up to This Epoch May Still Copy The Value
+    if (!variableValue) return;
+    retiredVariables.push_back({ variableValue, globalEpoch.fetch_add(1, std::memory_order_seq_cst) });
+}
+void JenovaGlobalStore::ReclaimVariables()
+{
+    // Oldest Pinned Epoch Among Active Readers
+    uint64_t oldestPinnedEpoch = UINT64_MAX;
+    for (size_t i = 0; i < MaxReaders; i++)
+    {
+        uint64_t pinnedEpoch = readerSlots[i].pinnedEpoch.load(std::memory_order_seq_cst);
+        if (pinnedEpoch != 0 && pinnedEpoch < oldestPinnedEpoch) oldestPinnedEpoch = pinnedEpoch;
+    }
+
+    // Delete Values Retired Before Every Active Reader Pinned
+    auto firstRemaining = std::remove_if(retiredVariables.begin(), retiredVariables.end(), [&](const RetiredVariable& retiredVariable)
+    {
+        if (retiredVariable.retireEpoch >= oldestPinnedEpoch) return false;
+        delete retiredVariable.variableValue;
+        return true;
+    });
+    retiredVariables.erase(firstRemaining, retiredVariables.end());
+}
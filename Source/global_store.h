@@ -0,0 +1,45 @@
+#pragma once
+
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Global Store Definition
+/*
+    Backs SDK Global Pointers And Variables Shared Between Scripts, Tasks And The Main Thread.
+    Names Are Interned Once Into Stable Handles, Handle Access Is A Direct Slot Index And Name Lookups
+    Probe An Insert-Only Table Without Locking. Pointers Are Plain Atomics, Variants Are Replaced Copy-On-Write
+    And Reclaimed By Epochs, So Readers Never Block. Writers Are Serialized.
+*/
+class JenovaGlobalStore
+{
+public:
+    typedef uint32_t GlobalHandle;
+    static constexpr GlobalHandle InvalidHandle = UINT32_MAX;
+
+public:
+    static GlobalHandle RegisterGlobal(const char* globalName);
+    static GlobalHandle FindGlobal(const char* globalName);
+    static void* GetPointer(GlobalHandle globalHandle);
+    static void* ExchangePointer(GlobalHandle globalHandle, void* pointerValue);
+    static Variant GetVariable(GlobalHandle globalHandle);
+    static bool SetVariable(GlobalHandle globalHandle, const Variant& variableValue);
+    static void ClearVariables();
+    static size_t GetGlobalCount();
+
+private:
+    static void RetireVariable(Variant* variableValue);
+    static void ReclaimVariables();
+};
@@ -33,6 +33,9 @@
 // Third-Party
 #include <Parsers/argparse.hpp>
 #include <Zlib/zlib.h>
+#include <Zstd/zstd.h>
+#include <LZ4/lz4.h>
+#include <LZ4/lz4hc.h>
 
 // Namespaces
 using namespace std;
@@ -126,6 +129,13 @@ namespace jenova
 			 String GodotKitPackageConfigPath							= "jenova/godot_kit_package";
 			 String SDKLinkingModeConfigPath							= "jenova/sdk_linking_mode";
 			 String ManagedSafeExecutionConfigPath						= "jenova/managed_safe_execution";
+			 String ModuleSymbolBindingConfigPath						= "jenova/module_symbol_binding";
+			 String ModuleLayoutConfigPath								= "jenova/module_layout";
+			 String TraceRecordingConfigPath							= "jenova/trace_recording";
+			 String BuildServiceModeConfigPath							= "jenova/build_service_mode";
+			 String NativeSamplingProfilerConfigPath					= "jenova/native_sampling_profiler";
+			 String FrameBudgetConfigPath								= "jenova/frame_budget";
+			 String AssetMonitorCoalesceWindowConfigPath				= "jenova/asset_monitor_coalesce_window";
 			 String BuildToolButtonEditorConfigPath						= "jenova/build_tool_button_placement";
 
 		private:
@@ -136,6 +146,10 @@ namespace jenova
 			const jenova::EditorVerboseOutput EditorVerboseDefaultOutput = jenova::EditorVerboseOutput::JenovaTerminal;
 			const jenova::InterpreterBackend InterpreterBackendDefaultMode = jenova::InterpreterBackend::TinyCC;
 			const jenova::SDKLinkingMode SDKLinkingDefaultMode = jenova::SDKLinkingMode::Dynamically;
+			const jenova::ModuleSymbolBinding ModuleSymbolDefaultBinding = jenova::ModuleSymbolBinding::ImmediateGlobal;
+			const jenova::ModuleLayout ModuleDefaultLayout = jenova::ModuleLayout::Monolithic;
+			const jenova::TraceRecording TraceRecordingDefaultMode = jenova::TraceRecording::Disabled;
+			const jenova::BuildServiceMode BuildServiceDefaultMode = jenova::BuildServiceMode::CompileOnSave;
 
 			// Default Compiler
 			#if defined(TARGET_PLATFORM_WINDOWS)
@@ -153,6 +167,7 @@ namespace jenova
 			Ref<JenovaDebuggerPlugin> debuggerPlugin;
 			jenova::ModuleList scriptModules;
 			jenova::IJenovaCompiler* jenovaCompiler = nullptr;
+			Array warmCompilerSignature;
 			Button* buildToolButton = nullptr;
 			PopupMenu* jenovaMenu = nullptr;
 			PopupMenu* toolsMenu = nullptr;
@@ -161,6 +176,7 @@ namespace jenova
 			Ref<Mutex> buildSystemMutex;
 			Ref<Shortcut> developerModeShortcut;
 			std::vector<VisualStudioInstance> vsInstances;
+			bool monolithicLinkPending = false;
 
 		protected:
 
@@ -242,6 +258,14 @@ namespace jenova
 				// Register Asset Monitors
 				VALIDATE_FUNCTION(RegisterAssetMonitors());
 
+				// Start Build Service
+				VALIDATE_FUNCTION(JenovaBuildService::Initialize());
+
+				// Schedule Benchmark Suite If Requested
+				#ifdef JENOVA_BENCHMARK
+				if (JenovaBenchmarkSuite::IsRunRequested()) JenovaBenchmarkSuite::ScheduleRun();
+				#endif
+
 				// Update Flag
 				isEditorPluginInitialized = true;
 
@@ -253,6 +277,9 @@ namespace jenova
 				// Unregister Editor Plugin Events
 				VALIDATE_FUNCTION(UnRegisterEditorPluginEvents());
 
+				// Stop Build Service
+				VALIDATE_FUNCTION(StopBuildService());
+
 				// Unregister Asset Monitors
 				VALIDATE_FUNCTION(UnRegisterAssetMonitors());
 
@@ -317,8 +344,8 @@ namespace jenova
 					return true;
 				}
 
-				// Build Project If Required
-				if (jenova::GlobalStorage::CurrentBuildAndRunMode == jenova::BuildAndRunMode::BuildBeforeRun)
+				// Build Project If Required [Partial Reloads Leave Module Database Stale Until Next Full Link]
+				if (jenova::GlobalStorage::CurrentBuildAndRunMode == jenova::BuildAndRunMode::BuildBeforeRun || monolithicLinkPending)
 				{
 					if (!BuildProject())
 					{
@@ -337,11 +364,11 @@ namespace jenova
 			// Scene Events
 			void _clear() override
 			{
-				jenova::VerboseByID(__LINE__, "All States Have Been Cleared And Reset.");
+				JENOVA_VERBOSE_BY_ID(__LINE__, "All States Have Been Cleared And Reset.");
 			}
 			void _apply_changes() override
 			{
-				jenova::VerboseByID(__LINE__, "All Pending State Changes Applied.");
+				JENOVA_VERBOSE_BY_ID(__LINE__, "All Pending State Changes Applied.");
 			}
 
 			// Methods
@@ -358,7 +385,7 @@ namespace jenova
 				buildSystemMutex.instantiate();
 
 				// Verbose
-				jenova::VerboseByID(__LINE__, "Editor Plugin Initialized At %p", jenovaEditorPlugin);
+				JENOVA_VERBOSE_BY_ID(__LINE__, "Editor Plugin Initialized At %p", jenovaEditorPlugin);
 
 				// All Good
 				return true;
@@ -376,7 +403,7 @@ namespace jenova
 				buildSystemMutex.unref();
 
 				// Verbose
-				jenova::VerboseByID(__LINE__, "Editor Plugin Uninitialized");
+				JENOVA_VERBOSE_BY_ID(__LINE__, "Editor Plugin Uninitialized");
 
 				// All Good
 				return true;
@@ -472,6 +499,13 @@ namespace jenova
 						if (!editor_settings->has_setting(GodotKitPackageConfigPath)) editor_settings->set(GodotKitPackageConfigPath, "Latest");
 						if (!editor_settings->has_setting(SDKLinkingModeConfigPath)) editor_settings->set(SDKLinkingModeConfigPath, int32_t(SDKLinkingDefaultMode));
 						if (!editor_settings->has_setting(ManagedSafeExecutionConfigPath)) editor_settings->set(ManagedSafeExecutionConfigPath, true);
+						if (!editor_settings->has_setting(ModuleSymbolBindingConfigPath)) editor_settings->set(ModuleSymbolBindingConfigPath, int32_t(ModuleSymbolDefaultBinding));
+						if (!editor_settings->has_setting(ModuleLayoutConfigPath)) editor_settings->set(ModuleLayoutConfigPath, int32_t(ModuleDefaultLayout));
+						if (!editor_settings->has_setting(TraceRecordingConfigPath)) editor_settings->set(TraceRecordingConfigPath, int32_t(TraceRecordingDefaultMode));
+						if (!editor_settings->has_setting(BuildServiceModeConfigPath)) editor_settings->set(BuildServiceModeConfigPath, int32_t(BuildServiceDefaultMode));
+						if (!editor_settings->has_setting(NativeSamplingProfilerConfigPath)) editor_settings->set(NativeSamplingProfilerConfigPath, false);
+						if (!editor_settings->has_setting(FrameBudgetConfigPath)) editor_settings->set(FrameBudgetConfigPath, 0.0);
+						if (!editor_settings->has_setting(AssetMonitorCoalesceWindowConfigPath)) editor_settings->set(AssetMonitorCoalesceWindowConfigPath, int64_t(jenova::GlobalSettings::AssetMonitorCoalesceWindow));
 						if (!editor_settings->has_setting(BuildToolButtonEditorConfigPath)) editor_settings->set(BuildToolButtonEditorConfigPath, int32_t(BuildToolButtonDefaultPlacement));
 				
 						// Add the Setting Descriptions to The Editor Settings
@@ -597,6 +631,52 @@ namespace jenova
 						editor_settings->add_property_info(ManagedSafeExecutionProperty);
 						editor_settings->set_initial_value(ManagedSafeExecutionConfigPath, true, false);
 
+						// Module Symbol Binding Property
+						PropertyInfo ModuleSymbolBindingProperty(Variant::INT, ModuleSymbolBindingConfigPath,
+							PropertyHint::PROPERTY_HINT_ENUM, "Immediate (Global), Lazy (Global), Immediate (Local), Lazy (Local)",
+							PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(ModuleSymbolBindingProperty);
+						editor_settings->set_initial_value(ModuleSymbolBindingConfigPath, int32_t(ModuleSymbolDefaultBinding), false);
+
+						// Module Layout Property
+						PropertyInfo ModuleLayoutProperty(Variant::INT, ModuleLayoutConfigPath,
+							PropertyHint::PROPERTY_HINT_ENUM, "Monolithic, Per Script (Partial Reload)",
+							PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(ModuleLayoutProperty);
+						editor_settings->set_initial_value(ModuleLayoutConfigPath, int32_t(ModuleDefaultLayout), false);
+
+						// Trace Recording Property
+						PropertyInfo TraceRecordingProperty(Variant::INT, TraceRecordingConfigPath,
+							PropertyHint::PROPERTY_HINT_ENUM, "Disabled, Build, Build & Runtime",
+							PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(TraceRecordingProperty);
+						editor_settings->set_initial_value(TraceRecordingConfigPath, int32_t(TraceRecordingDefaultMode), false);
+
+						// Build Service Mode Property
+						PropertyInfo BuildServiceModeProperty(Variant::INT, BuildServiceModeConfigPath,
+							PropertyHint::PROPERTY_HINT_ENUM, "Disabled, Warm Pipeline, Warm Pipeline & Compile On Save, Warm Pipeline & Compile While Editing",
+							PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(BuildServiceModeProperty);
+						editor_settings->set_initial_value(BuildServiceModeConfigPath, int32_t(BuildServiceDefaultMode), false);
+
+						// Native Sampling Profiler Property
+						PropertyInfo NativeSamplingProfilerProperty(Variant::BOOL, NativeSamplingProfilerConfigPath,
+							PropertyHint::PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(NativeSamplingProfilerProperty);
+						editor_settings->set_initial_value(NativeSamplingProfilerConfigPath, false, false);
+
+						// Frame Budget Property [Milliseconds, Zero Disables]
+						PropertyInfo FrameBudgetProperty(Variant::FLOAT, FrameBudgetConfigPath,
+							PropertyHint::PROPERTY_HINT_RANGE, "0,100,0.1,or_greater,suffix:ms", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(FrameBudgetProperty);
+						editor_settings->set_initial_value(FrameBudgetConfigPath, 0.0, false);
+
+						// Asset Monitor Coalesce Window Property [Milliseconds]
+						PropertyInfo AssetMonitorCoalesceWindowProperty(Variant::INT, AssetMonitorCoalesceWindowConfigPath,
+							PropertyHint::PROPERTY_HINT_RANGE, "0,2000,1,or_greater,suffix:ms", PROPERTY_USAGE_DEFAULT, JenovaEditorSettingsCategory);
+						editor_settings->add_property_info(AssetMonitorCoalesceWindowProperty);
+						editor_settings->set_initial_value(AssetMonitorCoalesceWindowConfigPath, int64_t(jenova::GlobalSettings::AssetMonitorCoalesceWindow), false);
+
 						// Build Tool Button Placement Property
 						String buttonPlacements = "Before Main Menu,After Main Menu,Before Stage Selector,After Stage Selector,Before Run Bar,After Run Bar,After Render Method";
 						if (jenova::IsEngineBlazium()) buttonPlacements = "Blazium Default";
@@ -684,6 +764,41 @@ namespace jenova
 				if (!GetEditorSetting(ManagedSafeExecutionConfigPath, useManagedSafeExecution)) return false;
 				jenova::GlobalStorage::UseManagedSafeExecution = bool(useManagedSafeExecution);
 
+				// Update Module Symbol Binding
+				Variant moduleSymbolBinding;
+				if (!GetEditorSetting(ModuleSymbolBindingConfigPath, moduleSymbolBinding)) return false;
+				jenova::GlobalStorage::ModuleSymbolBinding = jenova::ModuleSymbolBinding(int32_t(moduleSymbolBinding));
+
+				// Update Module Layout
+				Variant moduleLayout;
+				if (!GetEditorSetting(ModuleLayoutConfigPath, moduleLayout)) return false;
+				jenova::GlobalStorage::ModuleLayout = jenova::ModuleLayout(int32_t(moduleLayout));
+
+				// Update Trace Recording
+				Variant traceRecording;
+				if (!GetEditorSetting(TraceRecordingConfigPath, traceRecording)) return false;
+				jenova::GlobalStorage::TraceRecording = jenova::TraceRecording(int32_t(traceRecording));
+
+				// Update Build Service Mode
+				Variant buildServiceMode;
+				if (!GetEditorSetting(BuildServiceModeConfigPath, buildServiceMode)) return false;
+				jenova::GlobalStorage::BuildServiceMode = jenova::BuildServiceMode(int32_t(buildServiceMode));
+
+				// Update Native Sampling Profiler
+				Variant useNativeSamplingProfiler;
+				if (!GetEditorSetting(NativeSamplingProfilerConfigPath, useNativeSamplingProfiler)) return false;
+				jenova::GlobalStorage::UseNativeSamplingProfiler = bool(useNativeSamplingProfiler);
+
+				// Update Frame Budget
+				Variant frameBudget;
+				if (!GetEditorSetting(FrameBudgetConfigPath, frameBudget)) return false;
+				JenovaFrameBudget::SetFrameBudget(double(frameBudget));
+
+				// Update Asset Monitor Coalesce Window
+				Variant coalesceWindow;
+				if (!GetEditorSetting(AssetMonitorCoalesceWindowConfigPath, coalesceWindow)) return false;
+				if (JenovaAssetMonitor::get_singleton()) JenovaAssetMonitor::get_singleton()->SetCoalesceWindow(int64_t(coalesceWindow));
+
 				// All Good
 				return true;
 			}
@@ -957,11 +1072,12 @@ namespace jenova
 			}
 			bool RegisterAssetMonitors()
 			{
-				// Register Project Directory Monitor
-				if (!JenovaAssetMonitor::get_singleton()->AddDirectory(jenova::GetJenovaProjectDirectory())) return false;
+				// Register Project Directory Monitor [Scripts, Headers And Package Configs, Generated Directories Are Never Watched]
+				if (!JenovaAssetMonitor::get_singleton()->AddDirectory(jenova::GetJenovaProjectDirectory(),
+					jenova::GlobalSettings::AssetMonitorProjectFilters, jenova::GlobalSettings::AssetMonitorIgnoreFilters, true)) return false;
 
-				// Register Jenova Cache Directory Monitor
-				if (!JenovaAssetMonitor::get_singleton()->AddDirectory(jenova::GetJenovaCacheDirectory())) return false;
+				// Register Jenova Cache Directory Monitor [Watchdog Files Only]
+				if (!JenovaAssetMonitor::get_singleton()->AddDirectory(jenova::GetJenovaCacheDirectory(), jenova::GlobalSettings::AssetMonitorWatchdogFilter, "", false)) return false;
 
 				// Register Callback
 				if (!JenovaAssetMonitor::get_singleton()->RegisterCallback(JenovaEditorPlugin::OnAssetChanged)) return false;
@@ -977,6 +1093,15 @@ namespace jenova
 				// All Good
 				return true;
 			}
+			bool StopBuildService()
+			{
+				// Stop Service Then Release Warm Compiler
+				JenovaBuildService::Shutdown();
+				DisposeCompiler(false);
+
+				// All Good
+				return true;
+			}
 			bool RegisterScriptTemplates()
 			{
 				// Install Script Templates
@@ -1122,7 +1247,7 @@ namespace jenova
 			void OnBuildButtonPressed()
 			{
 				if (Input::get_singleton()->is_key_pressed(KEY_ALT)) CleanProject();
-				else BuildProject();
+				else ExecuteProjectBuild(true);
 			}
 			void OnMenuItemPressed(int32_t menuID)
 			{
@@ -1134,7 +1259,7 @@ namespace jenova
 				switch (menuItemID)
 				{
 				case jenova::EditorMenuID::BuildSolution:
-					BuildProject();
+					ExecuteProjectBuild(true);
 					break;
 				case jenova::EditorMenuID::RebuildSolution:
 					CleanProject();
@@ -1287,6 +1412,10 @@ namespace jenova
 
 			// Project Actions
 			bool BuildProject()
+			{
+				return ExecuteProjectBuild(false);
+			}
+			bool ExecuteProjectBuild(bool allowPartialReload)
 			{
 				// Check If Editor Running Project
 				if (EditorInterface::get_singleton()->is_playing_scene())
@@ -1348,6 +1477,24 @@ namespace jenova
 					return false;
 				}
 
+				// Record Build Trace If Enabled [Written When Build Returns]
+				struct BuildTraceRecorder
+				{
+					bool isRecording = false;
+					~BuildTraceRecorder()
+					{
+						if (!isRecording) return;
+						std::string buildTraceFile = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::JenovaBuildTraceFile;
+						if (JenovaTinyProfiler::StopTraceRecording(buildTraceFile)) jenova::Output("Build Trace Recorded : [color=#70a9d4]%s[/color]", buildTraceFile.c_str());
+					}
+				} buildTraceRecorder;
+				if (jenova::GlobalStorage::TraceRecording != jenova::TraceRecording::Disabled && !JenovaTinyProfiler::IsTraceRecording())
+				{
+					JenovaTinyProfiler::StartTraceRecording();
+					buildTraceRecorder.isRecording = true;
+				}
+				JENOVA_PROFILE_SCOPE("ProjectBuild");
+
 				// Create Project Build Profiler Checkpoint
 				JenovaTinyProfiler::CreateCheckpoint("JenovaProjectBuild");
 
@@ -1517,60 +1664,31 @@ namespace jenova
 							AS_C_STRING(scriptResource->get_path()), AS_C_STRING(scriptResource->GetScriptIdentity()), 
 							isUsedScript ? "[color=#24ed49]Used[/color]" : "[color=#ed2456]Unused[/color]");
 
-						// Set Per-Script Preprocessor Settings
-						preprocessorSettings["PropertyMetadata"] = jenova::GetJenovaCacheDirectory() + scriptResource->get_path().get_file().get_basename() + "_" + scriptResource->GetScriptIdentity() + ".props";
-
-						// Preprocess Source
-						String preprocessedSource = jenovaCompiler->PreprocessScript(cppResource, preprocessorSettings);
-
-						// Create Script Module
+						// Preprocess Script [Cached On Disk Once Speculative Compiles Settle]
 						jenova::ScriptModule scriptModule;
-						scriptModule.scriptFilename = scriptResource->get_path();
-						scriptModule.scriptUID = scriptResource->GetScriptIdentity();
-						scriptModule.scriptType = isUsedScript ? jenova::ScriptModuleType::UsedScript : jenova::ScriptModuleType::UnusedScript;
-						scriptModule.scriptSource = preprocessedSource;
-						scriptModule.scriptHash = scriptModule.scriptSource.md5_text();
-
-						// Detect Embedded Built-In Scripts
-						if (scriptResource->is_built_in()) scriptModule.scriptType = jenova::ScriptModuleType::BuiltinScript;
-
-						// Generate Script Cache and Object Filenames
-						scriptModule.scriptCacheFile = jenova::GetJenovaCacheDirectory() + scriptResource->get_path().get_file().get_basename() + "_" + scriptResource->GetScriptIdentity() + ".cpp";
-						scriptModule.scriptObjectFile = jenova::GetJenovaCacheDirectory() + scriptResource->get_path().get_file().get_basename() + "_" + scriptResource->GetScriptIdentity() + ".obj";
-						scriptModule.scriptPropertiesFile = preprocessorSettings["PropertyMetadata"];
-
-						// Create Preprocessed Source File
-						Ref<FileAccess> handle = FileAccess::open(scriptModule.scriptCacheFile, FileAccess::ModeFlags::WRITE);
-						if (handle.is_valid())
+						if (!PrepareScriptModule(scriptResource, isUsedScript, preprocessorSettings, scriptModule, false))
 						{
-							// Cache Preprocessed On Disk
-							handle->store_string(scriptModule.scriptSource);
-							handle->close();
-
-							// Verbose
-							jenova::Verbose("C++ Script ([color=#70a9d4]%s[/color]) Successfully Preprocessed.", AS_C_STRING(scriptResource->get_path()));
-						}
-						else
-						{
-							jenova::Error("Jenova Builder", "Failed to Preprocess Script File : [color=#70a9d4]%s[/color]", AS_C_STRING(scriptModule.scriptFilename));
 							DisposeCompiler();
 							return false;
 						}
 
-						// Apply Reference File Encoding
-						if (jenova::GlobalSettings::RespectSourceFilesEncoding)
-						{
-							std::string inputFilePath = AS_STD_STRING(ProjectSettings::get_singleton()->globalize_path(scriptResource->get_path()));
-							if (!jenova::ApplyFileEncodingFromReferenceFile(inputFilePath, AS_STD_STRING(scriptModule.scriptCacheFile)))
-							{
-								jenova::Warning("Jenova Builder", "Failed to Apply Encoding to Source File.");
-							}
-						}
-
 						// Add Script Module
 						scriptModules.push_back(scriptModule);
 					}
 				}
+
+				// Kill Speculative Compiles of Outdated Sources, Wait for Ones Building Same Source [Queued Ones Are Compiled By This Build]
+				JenovaBuildService::FinishSpeculativeCompiles(scriptModules);
+
+				// Cache Preprocessed Scripts On Disk
+				for (const auto& scriptModule : scriptModules)
+				{
+					if (!CacheScriptModule(scriptModule))
+					{
+						DisposeCompiler();
+						return false;
+					}
+				}
 				jenova::Output("All ([color=#53b5ab]%lld[/color]) C++ Script Resources Successfully Preprocessed.", cppResources.size());
 
 				// Add Internal Sources
@@ -1587,6 +1705,25 @@ namespace jenova
 					scriptModules.push_back(moduleLoaderScript);
 				}
 
+				// Detect Partial Reload Candidates [Per-Script Layout Relinks Only Modified Scripts, Launches And Exports Need Full Module]
+				jenova::ModuleList partialReloadModules;
+				if (allowPartialReload && QUERY_PLATFORM(Linux) && jenova::GlobalStorage::ModuleLayout == jenova::ModuleLayout::PerScript && JenovaInterpreter::GetModuleBaseAddress() != 0 &&
+					!EditorInterface::get_singleton()->is_playing_scene() && jenova::GlobalStorage::CurrentBuildAndRunMode != jenova::BuildAndRunMode::RunOnBuildSuccess)
+				{
+					bool requiresFullBuild = true;
+					std::string buildCacheFile = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile;
+					partialReloadModules = jenova::CollectModifiedScriptModules(buildCacheFile, scriptModules, cppHeaderFiles, requiresFullBuild);
+					if (requiresFullBuild || partialReloadModules.size() > jenova::GlobalSettings::PartialReloadScriptLimit) partialReloadModules.clear();
+					for (const auto& partialReloadModule : partialReloadModules)
+					{
+						if (!JenovaInterpreter::HasScript(AS_STD_STRING(partialReloadModule.scriptUID))) 
+						{
+							partialReloadModules.clear();
+							break;
+						}
+					}
+				}
+
 				// Compile Scripts [Multi-Thread/Single-Thread]
 				if (bool(jenovaCompiler->GetCompilerOption("cpp_multi_threaded_compilation")))
 				{
@@ -1597,6 +1734,7 @@ namespace jenova
 					JenovaTinyProfiler::CreateCheckpoint("JenovaCompileMT");
 
 					// Compile Scripts By Module
+					JENOVA_PROFILE_SCOPE("CompileScripts");
 					jenova::CompileResult compilerResult = jenovaCompiler->CompileScriptModuleContainer(jenova::ScriptModuleContainer(scriptModules));
 
 					// Check for Compiler Result
@@ -1612,8 +1750,8 @@ namespace jenova
 						return false;
 					}
 
-					// Check If Any Compile Was Done
-					if (compilerResult.scriptsCount == 0)
+					// Check If Any Compile Was Done [Pending Full Link Still Has to Run]
+					if (compilerResult.scriptsCount == 0 && !monolithicLinkPending)
 					{
 						jenova::OutputColored("#2ebc78", "Falling Back to Previous Build, No Change Detected. Fallback Time : [color=#c8e38a]%f ms[/color]", JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaCompileMT"));
 					
@@ -1645,6 +1783,7 @@ namespace jenova
 						JenovaTinyProfiler::CreateCheckpoint("JenovaCompileST");
 
 						// Compile Script By Module
+						JENOVA_PROFILE_SCOPE("CompileScripts");
 						jenova::CompileResult compilerResult = jenovaCompiler->CompileScriptModuleContainer(jenova::ScriptModuleContainer(scriptModule, scriptModules));
 
 						// Check for Compiler Result
@@ -1671,6 +1810,35 @@ namespace jenova
 					}
 				}
 
+				// Reload Modified Scripts as Satellite Modules Instead of Full Link
+				bool partiallyReloaded = false;
+				if (partialReloadModules.size() != 0)
+				{
+					JenovaTinyProfiler::CreateCheckpoint("JenovaPartialReload");
+					partiallyReloaded = ReloadModifiedScriptsAsSatellites(partialReloadModules, scriptModules);
+					if (partiallyReloaded)
+					{
+						jenova::OutputColored("#2ebc78", "Partially Reloaded ([color=#53b5ab]%lld[/color]) Script Module%s, Reload Time : [color=#c8e38a]%f ms[/color]", 
+							partialReloadModules.size(), partialReloadModules.size() == 1 ? "" : "s", JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaPartialReload"));
+					}
+					else
+					{
+						JenovaTinyProfiler::DeleteCheckpoint("JenovaPartialReload");
+						jenova::Warning("Jenova Builder", "Partial Reload Failed, Falling Back to Full Module Reload.");
+					}
+				}
+
+				// Defer Monolithic Link to Next Launch, Export or Full Build [Build Cache Keeps Reporting Patched Scripts Until Then]
+				if (partiallyReloaded)
+				{
+					monolithicLinkPending = true;
+					jenova::OutputColored("#2ebc78", "Project Build Completed! Project Build Time : [color=#eb9234]%f ms[/color]", JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaProjectBuild"));
+					JenovaInterpreter::SetExecutionState(true);
+					OnBuildSuccess();
+					DisposeCompiler();
+					return true;
+				}
+
 				// Create Build Profiler Checkpoint
 				JenovaTinyProfiler::CreateCheckpoint("JenovaBuild");
 				
@@ -1702,6 +1870,7 @@ namespace jenova
 					DisposeCompiler();
 					return false;
 				}
+				monolithicLinkPending = false;
 
 				// Copy Addon Binaries
 				jenova::CopyAddonBinariesToEngineDirectory(jenova::GlobalSettings::CreateSymbolicAddonModules);
@@ -1771,6 +1940,9 @@ namespace jenova
 
 				// Verbose
 				jenova::Output("Cleaning Project Cache...");
+
+				// Kill Running Speculative Compiles
+				JenovaBuildService::FinishSpeculativeCompiles(jenova::ModuleList());
 			
 				// Get Jenova Cache Path
 				std::string jenovaCacheDirectory = AS_STD_STRING(jenova::GetJenovaCacheDirectory());
@@ -1942,7 +2114,7 @@ namespace jenova
 					jenova::BuildResult buildResult;
 					buildResult.hasError = false;
 					buildResult.buildResult = true;
-					buildResult.builtModuleData = moduleData;
+					buildResult.builtModuleData.assign(moduleData.begin(), moduleData.end());
 					buildResult.buildPath = jenova::GlobalStorage::CurrentJenovaCacheDirectory;
 					buildResult.compilerModel = this->jenovaCompiler->GetCompilerModel();
 					buildResult.hasDebugInformation = hasDebugInformation;
@@ -2051,6 +2223,27 @@ namespace jenova
 				Variant godotKitPackage;
 				if (!GetEditorSetting(GodotKitPackageConfigPath, godotKitPackage)) return false;
 
+				// Reuse Warm Compiler While Settings Match [Build Service]
+				Array compilerSignature;
+				compilerSignature.append(compilerModel);
+				compilerSignature.append(useMultiThreading);
+				compilerSignature.append(generateDebugInformation);
+				compilerSignature.append(additionalIncludeDirectories);
+				compilerSignature.append(additionalLibraryDirectories);
+				compilerSignature.append(additionalDependencies);
+				compilerSignature.append(compilerPackage);
+				compilerSignature.append(godotKitPackage);
+				JenovaBuildService::SetIncludeDirectories(String(additionalIncludeDirectories));
+				if (jenovaCompiler != nullptr)
+				{
+					if (JenovaBuildService::IsActive() && compilerSignature == warmCompilerSignature)
+					{
+						JENOVA_VERBOSE("Reusing Warm Compiler Implemented at [color=#44e376]%p[/color]", jenovaCompiler);
+						return true;
+					}
+					DisposeCompiler(false);
+				}
+
 				// Initialize Compiler Compiler
 				switch (jenova::CompilerModel(int32_t(compilerModel)))
 				{
@@ -2111,7 +2304,7 @@ namespace jenova
 				if (!jenovaCompiler->InitializeCompiler())
 				{
 					jenova::Error("Jenova Builder", "Compiler failed to initialize! Build aborted.");
-					DisposeCompiler();
+					DisposeCompiler(false);
 					return false;
 				};
 
@@ -2119,57 +2312,150 @@ namespace jenova
 				if (!jenovaCompiler->SetCompilerOption("cpp_multi_threaded_compilation", bool(useMultiThreading)))
 				{
 					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Multi-Threaded Compilation'");
-					DisposeCompiler();
+					DisposeCompiler(false);
 					return false;
 				};
 				if (!jenovaCompiler->SetCompilerOption("cpp_generate_debug_info", bool(generateDebugInformation)))
 				{
 					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Generate Debug Information'");
-					DisposeCompiler();
+					DisposeCompiler(false);
 					return false;
 				};
 				if (!jenovaCompiler->SetCompilerOption("cpp_extra_include_directories", String(additionalIncludeDirectories)))
 				{
 					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Additional Include Directories'");
-					DisposeCompiler();
+					DisposeCompiler(false);
 					return false;
 				};
 				if (!jenovaCompiler->SetCompilerOption("cpp_extra_library_directories", String(additionalLibraryDirectories)))
 				{
 					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Additional Library Directories'");
-					DisposeCompiler();
+					DisposeCompiler(false);
 					return false;
 				};
 				if (!jenovaCompiler->SetCompilerOption("cpp_extra_libs", String(additionalDependencies)))
 				{
 					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Additional Dependencies'");
-					DisposeCompiler();
+					DisposeCompiler(false);
 					return false;
 				};
 				if (!jenovaCompiler->SetCompilerOption("cpp_toolchain_path", String(compilerPackage)))
 				{
 					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'Compiler Package'");
-					DisposeCompiler();
+					DisposeCompiler(false);
 					return false;
 				};
 				if (!jenovaCompiler->SetCompilerOption("cpp_godotsdk_path", String(godotKitPackage)))
 				{
 					jenova::Error("Jenova Builder", "Failed to Set Compiler Setting 'GodotKit Package'");
-					DisposeCompiler();
+					DisposeCompiler(false);
 					return false;
 				};
 
+				// Store Warm Compiler Signature
+				warmCompilerSignature = compilerSignature;
+
 				// All Good
 				return true;
 			}
-			void DisposeCompiler()
+			void DisposeCompiler(bool keepWarm = true)
 			{
+				// Build Service Keeps Compiler Alive Between Builds
+				if (keepWarm && JenovaBuildService::IsActive()) return;
 				if (jenovaCompiler != nullptr)
 				{
 					jenovaCompiler->ReleaseCompiler();
 					delete jenovaCompiler;
 					jenovaCompiler = nullptr;
 				}
+				warmCompilerSignature.clear();
+			}
+			bool PrepareScriptModule(const Ref<CPPScript>& scriptResource, bool isUsedScript, godot::Dictionary& preprocessorSettings, jenova::ScriptModule& scriptModule, bool cacheOnDisk = true)
+			{
+				// Set Per-Script Preprocessor Settings
+				preprocessorSettings["PropertyMetadata"] = jenova::GetJenovaCacheDirectory() + scriptResource->get_path().get_file().get_basename() + "_" + scriptResource->GetScriptIdentity() + ".props";
+
+				// Preprocess Source
+				JenovaTinyProfiler::ScopedTimer preprocessScope(JenovaTinyProfiler::IsTraceRecording() ? 
+					JenovaTinyProfiler::InternScopeName("Preprocess " + AS_STD_STRING(scriptResource->get_path())) : "ScriptPreprocess");
+				String preprocessedSource = jenovaCompiler->PreprocessScript(scriptResource, preprocessorSettings);
+
+				// Create Script Module
+				scriptModule.scriptFilename = scriptResource->get_path();
+				scriptModule.scriptUID = scriptResource->GetScriptIdentity();
+				scriptModule.scriptType = isUsedScript ? jenova::ScriptModuleType::UsedScript : jenova::ScriptModuleType::UnusedScript;
+				scriptModule.scriptSource = preprocessedSource;
+				scriptModule.scriptHash = scriptModule.scriptSource.md5_text();
+
+				// Detect Embedded Built-In Scripts
+				if (scriptResource->is_built_in()) scriptModule.scriptType = jenova::ScriptModuleType::BuiltinScript;
+
+				// Generate Script Cache and Object Filenames
+				scriptModule.scriptCacheFile = jenova::GetJenovaCacheDirectory() + scriptResource->get_path().get_file().get_basename() + "_" + scriptResource->GetScriptIdentity() + ".cpp";
+				scriptModule.scriptObjectFile = jenova::GetJenovaCacheDirectory() + scriptResource->get_path().get_file().get_basename() + "_" + scriptResource->GetScriptIdentity() + ".obj";
+				scriptModule.scriptPropertiesFile = preprocessorSettings["PropertyMetadata"];
+
+				// Speculative Compiles Write Cache File From Build Service Worker
+				if (!cacheOnDisk) return true;
+				return CacheScriptModule(scriptModule);
+			}
+			bool CacheScriptModule(const jenova::ScriptModule& scriptModule)
+			{
+				// Create Preprocessed Source File
+				Ref<FileAccess> handle = FileAccess::open(scriptModule.scriptCacheFile, FileAccess::ModeFlags::WRITE);
+				if (handle.is_valid())
+				{
+					// Cache Preprocessed On Disk
+					handle->store_string(scriptModule.scriptSource);
+					handle->close();
+
+					// Verbose
+					JENOVA_VERBOSE("C++ Script ([color=#70a9d4]%s[/color]) Successfully Preprocessed.", AS_C_STRING(scriptModule.scriptFilename));
+				}
+				else
+				{
+					jenova::Error("Jenova Builder", "Failed to Preprocess Script File : [color=#70a9d4]%s[/color]", AS_C_STRING(scriptModule.scriptFilename));
+					return false;
+				}
+
+				// Apply Reference File Encoding
+				if (jenova::GlobalSettings::RespectSourceFilesEncoding)
+				{
+					std::string inputFilePath = AS_STD_STRING(ProjectSettings::get_singleton()->globalize_path(scriptModule.scriptFilename));
+					if (!jenova::ApplyFileEncodingFromReferenceFile(inputFilePath, AS_STD_STRING(scriptModule.scriptCacheFile)))
+					{
+						jenova::Warning("Jenova Builder", "Failed to Apply Encoding to Source File.");
+					}
+				}
+
+				// All Good
+				return true;
+			}
+			bool PrepareSpeculativeCompiler(godot::Dictionary& preprocessorSettings)
+			{
+				// Create Compiler [Warm Instance Is Reused]
+				if (!CreateCompiler()) return false;
+				Variant preprocessorDefinitions;
+				if (!GetEditorSetting(PreprocessorDefinitionsConfigPath, preprocessorDefinitions)) return false;
+				preprocessorSettings["PreprocessorDefinitions"] = preprocessorDefinitions;
+				preprocessorSettings["SpeculativeCompile"] = true;
+				return true;
+			}
+			bool QueueSpeculativeCompile(const Ref<CPPScript>& cppScript, godot::Dictionary& preprocessorSettings)
+			{
+				// Returns False When Compiler Can't Compile Ahead
+				jenova::ScriptModule scriptModule;
+				if (!PrepareScriptModule(cppScript, false, preprocessorSettings, scriptModule, false)) return true;
+				godot::Dictionary commandSettings;
+				commandSettings["ScriptCacheFile"] = scriptModule.scriptCacheFile;
+				commandSettings["ScriptObjectFile"] = scriptModule.scriptObjectFile;
+				Variant compileCommand = jenovaCompiler->ExecuteCommand("Generate-Compile-Command", commandSettings);
+				if (compileCommand.get_type() != Variant::STRING) return false;
+				if (JenovaBuildService::QueueSpeculativeCompile(scriptModule, AS_STD_STRING(String(compileCommand))))
+				{
+					JENOVA_VERBOSE("Speculative Compile Queued for ([color=#70a9d4]%s[/color])", AS_C_STRING(cppScript->get_path()));
+				}
+				return true;
 			}
 
 			// Terminal Actions
@@ -2376,6 +2662,43 @@ namespace jenova
 				// All Good
 				return true;
 			}
+			bool ReloadModifiedScriptsAsSatellites(const jenova::ModuleList& modifiedModules, const jenova::ModuleList& scriptModules)
+			{
+				// Collect Internal Modules [Each Satellite Requires Its Own API Solver]
+				jenova::ModuleList internalModules;
+				for (const auto& scriptModule : scriptModules)
+				{
+					if (scriptModule.scriptType == jenova::ScriptModuleType::InternalScript) internalModules.push_back(scriptModule);
+				}
+
+				// Store Monolithic Output Settings
+				Variant monolithicOutputModule = jenovaCompiler->GetCompilerOption("cpp_output_module");
+				Variant monolithicOutputMap = jenovaCompiler->GetCompilerOption("cpp_output_map");
+
+				// Link And Load Each Modified Script as Satellite Module
+				bool satellitesLoaded = true;
+				jenovaCompiler->SetCompilerOption("cpp_satellite_module", true);
+				for (const auto& modifiedModule : modifiedModules)
+				{
+					jenova::ModuleList satelliteScriptModules = internalModules;
+					satelliteScriptModules.push_back(modifiedModule);
+					jenovaCompiler->SetCompilerOption("cpp_output_module", "Jenova.Module." + modifiedModule.scriptUID + ".so");
+					jenovaCompiler->SetCompilerOption("cpp_output_map", "Jenova.Module." + modifiedModule.scriptUID + ".map");
+					jenova::BuildResult satelliteResult = jenovaCompiler->BuildFinalModule(satelliteScriptModules);
+					jenova::SymbolList reboundSymbols = jenova::CollectObjectFunctionSymbols(AS_STD_STRING(modifiedModule.scriptObjectFile));
+					if (!satelliteResult.buildResult || !JenovaInterpreter::LoadSatelliteModule(satelliteResult, reboundSymbols))
+					{
+						satellitesLoaded = false;
+						break;
+					}
+				}
+
+				// Restore Monolithic Output Settings
+				jenovaCompiler->SetCompilerOption("cpp_satellite_module", false);
+				jenovaCompiler->SetCompilerOption("cpp_output_module", monolithicOutputModule);
+				jenovaCompiler->SetCompilerOption("cpp_output_map", monolithicOutputMap);
+				return satellitesLoaded;
+			}
 			String GetEditorSettingStringPath(const std::string& setting_key)
 			{
 				if (setting_key == std::string("remove_source_codes_from_build")) return RemoveSourcesFromBuildEditorConfigPath;
@@ -2397,6 +2720,13 @@ namespace jenova
 				if (setting_key == std::string("godot_kit_package")) return GodotKitPackageConfigPath;
 				if (setting_key == std::string("sdk_linking_mode")) return SDKLinkingModeConfigPath;
 				if (setting_key == std::string("managed_safe_execution")) return ManagedSafeExecutionConfigPath;
+				if (setting_key == std::string("module_symbol_binding")) return ModuleSymbolBindingConfigPath;
+				if (setting_key == std::string("module_layout")) return ModuleLayoutConfigPath;
+				if (setting_key == std::string("trace_recording")) return TraceRecordingConfigPath;
+				if (setting_key == std::string("build_service_mode")) return BuildServiceModeConfigPath;
+				if (setting_key == std::string("native_sampling_profiler")) return NativeSamplingProfilerConfigPath;
+				if (setting_key == std::string("frame_budget")) return FrameBudgetConfigPath;
+				if (setting_key == std::string("asset_monitor_coalesce_window")) return AssetMonitorCoalesceWindowConfigPath;
 				if (setting_key == std::string("build_toolbutton_placement")) return BuildToolButtonEditorConfigPath;
 				return String("jenova/unknown");
 			}
@@ -3663,6 +3993,66 @@ namespace jenova
 				}
 			}
 
+			// Build Service Actions
+			void CompileSavedSourceAhead(const String& targetPath)
+			{
+				// Only Sources Count
+				String fileExtension = targetPath.get_extension();
+				bool isScriptFile = fileExtension == jenova::GlobalSettings::JenovaScriptExtension;
+				if (!isScriptFile && fileExtension != "h" && fileExtension != "hh" && fileExtension != "hpp") return;
+
+				// Only When Compiling On Save And Changes Don't Already Trigger Full Builds
+				if (!UpdateStorageConfigurations() || !JenovaBuildService::IsActive()) return;
+				if (jenova::GlobalStorage::BuildServiceMode < jenova::BuildServiceMode::CompileOnSave) return;
+				if (jenova::GlobalStorage::CurrentChangesTriggerMode == jenova::ChangesTriggerMode::TriggerOnScriptChange) return;
+				if (EditorInterface::get_singleton()->is_playing_scene() && !jenova::GlobalStorage::UseHotReloadAtRuntime) return;
+
+				// Collect Saved Script Or Scripts Reaching Saved Header
+				PackedStringArray scriptPaths;
+				if (isScriptFile) scriptPaths.push_back(ProjectSettings::get_singleton()->localize_path(targetPath));
+				else scriptPaths = JenovaBuildService::GetDependentScripts(targetPath);
+				if (scriptPaths.is_empty()) return;
+				if (size_t(scriptPaths.size()) > jenova::GlobalSettings::BuildServiceSpeculativeScriptLimit)
+				{
+					JENOVA_VERBOSE("Header ([color=#70a9d4]%s[/color]) Reaches %lld Scripts, Left to Next Build.", AS_C_STRING(targetPath), scriptPaths.size());
+					return;
+				}
+
+				// Queue Speculative Compiles [In-Memory Source, Same As Next Build Will See]
+				godot::Dictionary preprocessorSettings;
+				if (!PrepareSpeculativeCompiler(preprocessorSettings)) return;
+				for (const auto& scriptPath : scriptPaths)
+				{
+					Ref<Resource> scriptResource = ResourceLoader::get_singleton()->load(scriptPath);
+					if (scriptResource.is_null() || scriptResource->get_class() != jenova::GlobalSettings::JenovaScriptType) continue;
+					if (!QueueSpeculativeCompile(Object::cast_to<CPPScript>(scriptResource.ptr()), preprocessorSettings)) return;
+				}
+			}
+			void CompileEditedSourceAhead(const String& scriptPath, const String& scriptCode)
+			{
+				// Only Saved Scripts, Built-In Scripts Live Inside Scenes
+				if (scriptPath.get_extension() != jenova::GlobalSettings::JenovaScriptExtension || scriptPath.contains("::")) return;
+
+				// Only When Compiling While Editing [Storage Follows Editor Settings Changes]
+				if (!JenovaBuildService::IsActive()) return;
+				if (jenova::GlobalStorage::BuildServiceMode != jenova::BuildServiceMode::CompileWhileEditing) return;
+				if (EditorInterface::get_singleton()->is_playing_scene() && !jenova::GlobalStorage::UseHotReloadAtRuntime) return;
+
+				// Half Typed Code Would Only Fail, Wait For Next Validation
+				if (!JenovaBuildService::IsSourceStable(scriptCode)) return;
+
+				// Get Edited Script [Editor Holds The Cached Instance]
+				Ref<Resource> scriptResource = ResourceLoader::get_singleton()->load(scriptPath);
+				if (scriptResource.is_null() || scriptResource->get_class() != jenova::GlobalSettings::JenovaScriptType) return;
+				Ref<CPPScript> cppScript = Object::cast_to<CPPScript>(scriptResource.ptr());
+
+				// Compile Editor Text, Cached Resource Is Never Touched
+				godot::Dictionary preprocessorSettings;
+				if (!PrepareSpeculativeCompiler(preprocessorSettings)) return;
+				preprocessorSettings["ScriptSourceCode"] = scriptCode;
+				QueueSpeculativeCompile(cppScript, preprocessorSettings);
+			}
+
 		private:
 
 			// Asset Monitor Events
@@ -3683,19 +4073,19 @@ namespace jenova
 						// Check for Visual Studio Watchdog
 						if (jenova::CompareFilePaths(targetFullPath, visualStudioWatchdogFile))
 						{
-							// Wait For File to Be Written
-							std::this_thread::sleep_for(std::chrono::milliseconds(60));
-
-							// Launch Bootstrapper
+							// Launch Bootstrapper [Asset Monitor Delivers Once Writes Settled]
 							if (jenovaEditorPlugin) jenovaEditorPlugin->call_deferred("BootstrapModule", jenova::ReadStringFromFile(targetPath));
 							std::filesystem::remove(targetFullPath);
 						}
 					}
 				}
 
-				// Handle Changed Files
-				if (callbackEvent == jenova::AssetMonitor::CallbackEvent::Modified)
+				// Handle Changed Files [Renamed Over Existing File Counts As Change]
+				if (callbackEvent == jenova::AssetMonitor::CallbackEvent::Modified || callbackEvent == jenova::AssetMonitor::CallbackEvent::RenamedNew)
 				{
+					// Compile Saved Sources Ahead of Next Build [Build Service]
+					if (jenovaEditorPlugin) jenovaEditorPlugin->CompileSavedSourceAhead(targetPath);
+
 					// Handle Changes to C++/Header Scripts in Project
 					if (targetPath.get_extension() == jenova::GlobalSettings::JenovaScriptExtension || targetPath.get_extension() == jenova::GlobalSettings::HandlePreLaunchErrors)
 					{
@@ -3709,12 +4099,10 @@ namespace jenova
 						// Trigger Recompile If Source Change Detected
 						if (jenova::GlobalStorage::CurrentChangesTriggerMode == jenova::ChangesTriggerMode::TriggerOnScriptChange)
 						{
-							// Wait for Files to Written [Find A Better Method]
-							OS::get_singleton()->delay_msec(30);
-
 							// Update Script Object Source
 							String updatedScriptPath = ProjectSettings::get_singleton()->localize_path(targetPath);
 							Ref<Resource> updatedScript = ResourceLoader::get_singleton()->load(updatedScriptPath);
+							if (updatedScript.is_null()) return;
 							if (updatedScript->get_class() == jenova::GlobalSettings::JenovaScriptType)
 							{
 								Ref<CPPScript> cppScript = Object::cast_to<CPPScript>(updatedScript.ptr());
@@ -3818,6 +4206,20 @@ namespace jenova
 					Ref<FileAccess> fileAccess = FileAccess::open(defaultModuleDatabasePath, FileAccess::READ);
 					PackedByteArray moduleCacheData = fileAccess->get_buffer(fileAccess->get_length());
 					fileAccess->close();
+
+					// Recompress Module Cache With Export Codec
+					jenova::MemoryBuffer exportDatabase = JenovaInterpreter::RecompressModuleDatabase(jenova::MemoryBuffer(moduleCacheData.ptr(), moduleCacheData.ptr() + moduleCacheData.size()),
+						jenova::GlobalSettings::ExportCompressionCodec, jenova::GlobalSettings::ExportCompressionLevel);
+					if (exportDatabase.size() != 0)
+					{
+						moduleCacheData.resize(exportDatabase.size());
+						memcpy(moduleCacheData.ptrw(), exportDatabase.data(), exportDatabase.size());
+					}
+					else
+					{
+						jenova::Warning("Jenova Exporter", "Failed to Recompress Module Cache, Exporting Editor Cache As Is.");
+					}
+
 					this->add_file(runtimeCachePath, moduleCacheData, false);
 					moduleCacheData.clear();
 				}
@@ -3910,7 +4312,7 @@ namespace jenova
 		public:
 			void _setup_session(int32_t p_session_id) override
 			{
-				jenova::Verbose("_setup_session %d", p_session_id);
+				JENOVA_VERBOSE("_setup_session %d", p_session_id);
 				currentSessionID = p_session_id;
 			}
 			bool _has_capture(const String& p_capture) const override
@@ -4046,17 +4448,17 @@ namespace jenova
 				enteredSceneTree = true;
 
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::EnterTree, nullptr, 0);
+				RiseEvent(RuntimeEvent::EnterTree);
 			}
 			void _ready() override
 			{
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::Ready, nullptr, 0);
+				RiseEvent(RuntimeEvent::Ready);
 			}
 			void _process(double p_delta) override
 			{
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::Process, &p_delta, sizeof(p_delta));
+				RiseEvent(RuntimeEvent::Process, &p_delta, sizeof(p_delta));
 
 				// Call Idle Frame
 				this->call_deferred("OnFrameIdle");
@@ -4064,12 +4466,12 @@ namespace jenova
 			void _physics_process(double p_delta) override
 			{
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::PhysicsProcess, &p_delta, sizeof(p_delta));
+				RiseEvent(RuntimeEvent::PhysicsProcess, &p_delta, sizeof(p_delta));
 			}
 			void _exit_tree() override
 			{
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::ExitTree, nullptr, 0);
+				RiseEvent(RuntimeEvent::ExitTree);
 			}
 
 			// Methods
@@ -4083,7 +4485,7 @@ namespace jenova
 				}
 
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::Initialized, nullptr, 0);
+				RiseEvent(RuntimeEvent::Initialized);
 
 				// Update Runtime State
 				isInitialized = true;
@@ -4101,11 +4503,14 @@ namespace jenova
 				RenderingServer::get_singleton()->connect("frame_pre_draw", callable_mp(this, &JenovaRuntime::OnFrameEnd));
 				RenderingServer::get_singleton()->connect("frame_post_draw", callable_mp(this, &JenovaRuntime::OnFramePresent));
 
+				// Register Performance Monitors
+				if (!JenovaRuntimeCounters::RegisterMonitors()) jenova::Warning("Jenova Runtime", "Failed to Register Performance Monitors.");
+
 				// Add Runtime to Tree
 				jenova::GetSceneTree()->get_root()->add_child(this);
 
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::Started, nullptr, 0);
+				RiseEvent(RuntimeEvent::Started);
 
 				// Update Runtime State
 				isStarted = true;
@@ -4129,8 +4534,11 @@ namespace jenova
 					RenderingServer::get_singleton()->disconnect("frame_post_draw", callable_mp(this, &JenovaRuntime::OnFramePresent));
 				}
 
+				// Unregister Performance Monitors
+				JenovaRuntimeCounters::UnregisterMonitors();
+
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::Stopped, nullptr, 0);
+				RiseEvent(RuntimeEvent::Stopped);
 
 				// Update Runtime State
 				isStarted = false;
@@ -4164,23 +4572,70 @@ namespace jenova
 			}
 			void OnFrameBegin()
 			{
+				// Begin Frame Profiler Scope
+				isRecordingFrameScope = JenovaTinyProfiler::BeginScope(JenovaTinyProfiler::HashScopeName("RuntimeFrame"), "RuntimeFrame");
+
+				// Begin Frame Budget
+				JenovaFrameBudget::BeginFrame();
+
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::FrameBegin, nullptr, 0);
+				RiseEvent(RuntimeEvent::FrameBegin);
 			}
 			void OnFrameIdle()
 			{
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::FrameIdle, nullptr, 0);
+				RiseEvent(RuntimeEvent::FrameIdle);
 			}
 			void OnFrameEnd()
 			{
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::FrameEnd, nullptr, 0);
+				RiseEvent(RuntimeEvent::FrameEnd);
+
+				// Reset Frame Scratch Memory
+				JenovaArenaAllocator::ResetFrameArena();
+
+				// Aggregate Runtime Counters
+				JenovaRuntimeCounters::CollectFrame();
+
+				// Aggregate Native Samples
+				JenovaSamplingProfiler::CollectSamples();
+
+				// Flush Perf Map Entries
+				if (JenovaPerfMap::IsOpen()) JenovaPerfMap::Flush();
 			}
 			void OnFramePresent()
 			{
 				// Rise Events
-				for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(RuntimeEvent::FramePresent, nullptr, 0);
+				RiseEvent(RuntimeEvent::FramePresent);
+
+				// End Frame Budget
+				JenovaFrameBudget::EndFrame();
+
+				// Count Frames Dropped By Module Reload
+				JenovaInterpreter::CollectReloadFrame();
+
+				// End Frame Profiler Scope
+				if (isRecordingFrameScope) JenovaTinyProfiler::EndScope(JenovaTinyProfiler::HashScopeName("RuntimeFrame"), "RuntimeFrame");
+				isRecordingFrameScope = false;
+			}
+
+			// Utilities
+			static void RiseEvent(RuntimeEvent runtimeEvent, void* dataPtr = nullptr, size_t dataSize = 0)
+			{
+				// Fast Path
+				if (!JenovaFrameBudget::IsEnabled())
+				{
+					for (const auto& runtimeCallback : runtimeCallbacks) runtimeCallback(runtimeEvent, dataPtr, dataSize);
+					return;
+				}
+
+				// Timed Path [Frame Budget Active]
+				for (const auto& runtimeCallback : runtimeCallbacks)
+				{
+					int64_t startTime = JenovaTinyProfiler::ReadClock();
+					runtimeCallback(runtimeEvent, dataPtr, dataSize);
+					JenovaFrameBudget::RecordCallback((const void*)runtimeCallback, uint32_t(runtimeEvent), JenovaTinyProfiler::ReadClock() - startTime);
+				}
 			}
 
 		public:
@@ -4188,6 +4643,7 @@ namespace jenova
 			inline static bool isInitialized = false;
 			inline static bool isStarted = false;
 			inline static bool enteredSceneTree = false;
+			inline static bool isRecordingFrameScope = false;
 			inline static std::vector<RuntimeCallback> runtimeCallbacks;
 		};
 
@@ -4317,6 +4773,9 @@ namespace jenova
 				// Process Command Line Arguments
 				jenova::ProcessCommandLineArguments();
 
+				// Register Main Thread For Native Sampling
+				JenovaSamplingProfiler::RegisterThread("Main");
+
 				// Register Classes
 				ClassDB::register_class<CPPScript>();
 				ClassDB::register_class<CPPHeader>();
@@ -4407,12 +4866,37 @@ namespace jenova
 					VALIDATE_FUNCTION(JenovaInterpreter::UnloadModule(ModuleUnloadStage::UnloadModuleToShutdown));
 				}
 
+				// Stop Scene Index
+				JenovaSceneIndex::Shutdown();
+
 				// Release Interpreter
 				VALIDATE_FUNCTION(JenovaInterpreter::ReleaseInterpreter());
 
 				// Uninitialize Runtime
 				JenovaRuntime::deinit();
 
+				// Write Runtime Trace
+				if (JenovaTinyProfiler::IsTraceRecording())
+				{
+					std::string runtimeTraceFile = AS_STD_STRING(ProjectSettings::get_singleton()->globalize_path(jenova::GlobalSettings::JenovaRuntimeTraceFile));
+					if (JenovaTinyProfiler::StopTraceRecording(runtimeTraceFile)) jenova::Output("Runtime Trace Recorded : %s", runtimeTraceFile.c_str());
+				}
+
+				// Unregister Main Thread From Native Sampling
+				JenovaSamplingProfiler::UnregisterThread();
+
+				// Close Perf Map
+				JenovaPerfMap::Close();
+
+				// Write Memory Report
+				if (!jenova::GlobalStorage::MemoryReportPath.empty() && JenovaMemoryTracker::DumpMemoryReport(jenova::GlobalStorage::MemoryReportPath))
+				{
+					jenova::Output("Memory Report Written : %s", jenova::GlobalStorage::MemoryReportPath.c_str());
+				}
+
+				// Flush Pending Logs
+				JenovaLogSystem::Shutdown();
+
 				// Release Extension
 				OnExtensionRelease();
 
@@ -4764,17 +5248,23 @@ namespace jenova
 		jenova::ChangesTriggerMode CurrentChangesTriggerMode = jenova::ChangesTriggerMode::DoNothing;
 		jenova::EditorVerboseOutput CurrentEditorVerboseOutput = jenova::EditorVerboseOutput::StandardOutput;
 		jenova::SDKLinkingMode SDKLinkingMode = jenova::SDKLinkingMode::Dynamically;
+		jenova::ModuleSymbolBinding ModuleSymbolBinding = jenova::ModuleSymbolBinding::ImmediateGlobal;
+		jenova::ModuleLayout ModuleLayout = jenova::ModuleLayout::Monolithic;
+		jenova::TraceRecording TraceRecording = jenova::TraceRecording::Disabled;
+		jenova::BuildServiceMode BuildServiceMode = jenova::BuildServiceMode::Disabled;
 
 		// Database
 		std::string CurrentJenovaCacheDirectory = "";
 		std::string CurrentJenovaGeneratedConfiguration = "";
 		std::string CurrentJenovaRuntimeModulePath = "";
+		std::string MemoryReportPath = "";
 
 		// Flags
 		bool DeveloperModeActivated = jenova::GlobalSettings::VerboseEnabled;
 		bool UseHotReloadAtRuntime = true;
 		bool UseMonospaceFontForTerminal = true;
 		bool UseManagedSafeExecution = true;
+		bool UseNativeSamplingProfiler = false;
 
 		// Values
 		int TerminalDefaultFontSize = 12;
@@ -4941,6 +5431,14 @@ namespace jenova
 		if (memoryPtr) free(memoryPtr);
 		return false;
 	}
+	void RecordMemoryAllocation(MemoryTag memoryTag, size_t memorySize)
+	{
+		JenovaMemoryTracker::TrackAllocation(memoryTag, memorySize);
+	}
+	void RecordMemoryRelease(MemoryTag memoryTag, size_t memorySize)
+	{
+		JenovaMemoryTracker::TrackRelease(memoryTag, memorySize);
+	}
 	const char* CloneString(const char* str)
 	{
 		// Bad Approach, Needs Improvement
@@ -5171,6 +5669,9 @@ namespace jenova
 		vsnprintf(buffer, sizeof(buffer), fmt, args);
 		va_end(args);
 
+		// Emit Pending Verbose Records First
+		JenovaLogSystem::Flush();
+
 		// Suppress if Disabled
 		if (jenova::GlobalStorage::CurrentEditorVerboseOutput == jenova::EditorVerboseOutput::Disabled) return;
 
@@ -5203,6 +5704,9 @@ namespace jenova
 		vswprintf(buffer, sizeof(buffer) / sizeof(wchar_t), fmt, args);
 		va_end(args);
 
+		// Emit Pending Verbose Records First
+		JenovaLogSystem::Flush();
+
 		// Suppress if Disabled
 		if (jenova::GlobalStorage::CurrentEditorVerboseOutput == jenova::EditorVerboseOutput::Disabled) return;
 
@@ -5235,6 +5739,9 @@ namespace jenova
 		vsnprintf(buffer, sizeof(buffer), fmt, args);
 		va_end(args);
 
+		// Emit Pending Verbose Records First
+		JenovaLogSystem::Flush();
+
 		// Suppress if Disabled
 		if (jenova::GlobalStorage::CurrentEditorVerboseOutput == jenova::EditorVerboseOutput::Disabled) return;
 
@@ -5261,80 +5768,28 @@ namespace jenova
 	}
 	void Verbose(const char* fmt, ...)
 	{
-		if (!jenova::GlobalStorage::DeveloperModeActivated) return;
-		char buffer[jenova::GlobalSettings::PrintOutputBufferSize];
+		// Suppress if Disabled
+		if (!JenovaLogSystem::IsVerboseEnabled()) return;
+
+		// Record Verbose [Emitted By Log Drain Thread]
 		va_list args;
 		va_start(args, fmt);
-		vsnprintf(buffer, sizeof(buffer), fmt, args);
+		JenovaLogSystem::RecordV(JenovaLogSystem::LogLevel::Verbose, 0, fmt, args);
 		va_end(args);
-
-		// Suppress if Disabled
-		if (jenova::GlobalStorage::CurrentEditorVerboseOutput == jenova::EditorVerboseOutput::Disabled) return;
-
-		// Handle Verbose In Different Modes
-		if (QUERY_ENGINE_MODE(Editor))
-		{
-			// Jenova Terminal Log
-			if (jenova::GlobalStorage::CurrentEditorVerboseOutput == jenova::EditorVerboseOutput::JenovaTerminal)
-			{
-				if (jenova::plugin::JenovaEditorPlugin::get_singleton())
-				{
-					jenova::plugin::JenovaEditorPlugin::get_singleton()->call_deferred("VerboseLog", String(" [color=#fcb603]^[/color] ") + String(buffer));
-					return;
-				}
-			}
-
-			// Standard Log
-			UtilityFunctions::print_rich(String("[b][JENOVA][/b] [color=#fcb603]^[/color] ") + String(buffer));
-		}
-		else
-		{
-			UtilityFunctions::print(String("[JENOVA] ^ ") + String(buffer));
-		}
 	}
 	void VerboseByID(int id, const char* fmt, ...)
 	{
-		if (!jenova::GlobalStorage::DeveloperModeActivated) return;
-		char buffer[jenova::GlobalSettings::PrintOutputBufferSize];
+		// Suppress if Disabled
+		if (!JenovaLogSystem::IsVerboseEnabled()) return;
+
+		// Record Verbose [Emitted By Log Drain Thread]
 		va_list args;
 		va_start(args, fmt);
-		vsnprintf(buffer, sizeof(buffer), fmt, args);
+		JenovaLogSystem::RecordV(JenovaLogSystem::LogLevel::VerboseByID, id, fmt, args);
 		va_end(args);
-
-		// Suppress if Disabled
-		if (jenova::GlobalStorage::CurrentEditorVerboseOutput == jenova::EditorVerboseOutput::Disabled) return;
-
-		// Generate A Unique Color based on id (Knuth's multiplicative hash, Mod 360 for HUE)
-		unsigned int hash = id * 2654435761 % 360;
-
-		// Convert HUE to RGB
-		float hue = static_cast<float>(hash);
-		float saturation = 0.8f; // Saturation of 80%
-		float value = 0.9f; // Brightness of 90%
-		int hi = static_cast<int>(hue / 60) % 6;
-		float f = hue / 60 - hi;
-		float p = value * (1 - saturation);
-		float q = value * (1 - f * saturation);
-		float t = value * (1 - (1 - f) * saturation);
-		float r, g, b;
-		switch (hi) 
-		{
-			case 0: r = value; g = t; b = p; break;
-			case 1: r = q; g = value; b = p; break;
-			case 2: r = p; g = value; b = t; break;
-			case 3: r = p; g = q; b = value; break;
-			case 4: r = t; g = p; b = value; break;
-			case 5: r = value; g = p; b = q; break;
-		}
-
-		// Convert RGB to hex
-		std::stringstream colorHash;
-		colorHash << "#" << std::hex 
-			<< std::setw(2) << std::setfill('0') << static_cast<int>(r * 255)
-			<< std::setw(2) << std::setfill('0') << static_cast<int>(g * 255)
-			<< std::setw(2) << std::setfill('0') << static_cast<int>(b * 255);
-
-
+	}
+	void EmitVerbose(const char* colorHash, const char* message)
+	{
 		// Handle Verbose In Different Modes
 		if (QUERY_ENGINE_MODE(Editor))
 		{
@@ -5343,17 +5798,19 @@ namespace jenova
 			{
 				if (jenova::plugin::JenovaEditorPlugin::get_singleton())
 				{
-					jenova::plugin::JenovaEditorPlugin::get_singleton()->call_deferred("VerboseLog", "[color=" + String(colorHash.str().c_str()) + String("] ^ ") + String(buffer) + "[/color]");
+					if (colorHash) jenova::plugin::JenovaEditorPlugin::get_singleton()->call_deferred("VerboseLog", "[color=" + String(colorHash) + String("] ^ ") + String(message) + "[/color]");
+					else jenova::plugin::JenovaEditorPlugin::get_singleton()->call_deferred("VerboseLog", String(" [color=#fcb603]^[/color] ") + String(message));
 					return;
 				}
 			}
 
 			// Standard Log
-			UtilityFunctions::print_rich("[color=" + String(colorHash.str().c_str()) + String("][JENOVA] ^ ") + String(buffer) + "[/color]");
+			if (colorHash) UtilityFunctions::print_rich("[color=" + String(colorHash) + String("][JENOVA] ^ ") + String(message) + "[/color]");
+			else UtilityFunctions::print_rich(String("[b][JENOVA][/b] [color=#fcb603]^[/color] ") + String(message));
 		}
 		else
 		{
-			UtilityFunctions::print(String("[JENOVA] ^ ") + String(buffer));
+			UtilityFunctions::print(String("[JENOVA] ^ ") + String(message));
 		}
 	}
 	void Error(const char* stageName, const char* fmt, ...)
@@ -5364,6 +5821,9 @@ namespace jenova
 		vsnprintf(buffer, sizeof(buffer), fmt, args);
 		va_end(args);
 
+		// Emit Pending Verbose Records First
+		JenovaLogSystem::Flush();
+
 		// Handle Verbose In Different Modes
 		if (QUERY_ENGINE_MODE(Editor))
 		{
@@ -5400,6 +5860,9 @@ namespace jenova
 		vsnprintf(buffer, sizeof(buffer), fmt, args);
 		va_end(args);
 
+		// Emit Pending Verbose Records First
+		JenovaLogSystem::Flush();
+
 		// Handle Verbose In Different Modes
 		if (QUERY_ENGINE_MODE(Editor))
 		{
@@ -5903,6 +6366,18 @@ namespace jenova
 			return jenova::plugin::JenovaEditorPlugin::get_singleton()->BuildProject();
 		}
 	}
+	bool BuildProjectImmediately()
+	{
+		// Builds On Calling Thread And Returns Result [Benchmarks Time The Build Itself]
+		if (!jenova::plugin::JenovaEditorPlugin::get_singleton()) return false;
+		return jenova::plugin::JenovaEditorPlugin::get_singleton()->BuildProject();
+	}
+	bool QueueEditedScriptCompile(const String& scriptPath, const String& scriptCode)
+	{
+		if (!jenova::plugin::JenovaEditorPlugin::get_singleton()) return false;
+		jenova::plugin::JenovaEditorPlugin::get_singleton()->CompileEditedSourceAhead(scriptPath, scriptCode);
+		return true;
+	}
 	bool UpdateGlobalStorageFromEditorSettings()
 	{
 		if (!jenova::plugin::JenovaEditorPlugin::get_singleton()) return false;
@@ -6353,7 +6828,7 @@ namespace jenova
 			for (const auto& scriptHeader : scriptHeaders)
 			{
 				// Update Hashes
-				serializer["Headers"][AS_STD_STRING(jenova::GenerateStandardUIDFromPath(scriptHeader))] = AS_STD_STRING(jenova::GenerateMD5HashFromFile(scriptHeader));
+				serializer["Headers"][AS_STD_STRING(jenova::GenerateStandardUIDFromPath(scriptHeader))] = AS_STD_STRING(JenovaBuildService::GetFileHash(scriptHeader));
 			}
 			serializer["HeaderCount"] = scriptHeaders.size();
 
@@ -6367,8 +6842,11 @@ namespace jenova
 				handle->store_string(String(serializer.dump(2).c_str()));
 				handle->close();
 
+				// Keep Parsed Database Warm
+				JenovaBuildService::StoreBuildCacheDatabase(cacheFile, serializer);
+
 				// Verbose
-				jenova::VerboseByID(__LINE__, "Build Cache Database Saved At (%s)", cacheFile.c_str());
+				JENOVA_VERBOSE_BY_ID(__LINE__, "Build Cache Database Saved At (%s)", cacheFile.c_str());
 
 				// All Good
 				return true;
@@ -6383,6 +6861,78 @@ namespace jenova
 			return false;
 		}
 	}
+	jenova::ModuleList CollectModifiedScriptModules(const std::string& cacheFile, const jenova::ModuleList& scriptModules, const jenova::HeaderList& scriptHeaders, bool& requiresFullBuild)
+	{
+		// Any Structural Change Requires Full Build
+		requiresFullBuild = true;
+		jenova::ModuleList modifiedModules;
+		try
+		{
+			// Parse Cache File
+			jenova::json_t buildCacheDatabase;
+			if (!JenovaBuildService::LoadBuildCacheDatabase(cacheFile, buildCacheDatabase)) return modifiedModules;
+			if (!buildCacheDatabase.contains("Modules") || !buildCacheDatabase.contains("Headers")) return modifiedModules;
+
+			// Validate Module & Header Count
+			if (buildCacheDatabase["ModuleCount"].get<size_t>() != scriptModules.size()) return modifiedModules;
+			if (buildCacheDatabase["HeaderCount"].get<size_t>() != scriptHeaders.size()) return modifiedModules;
+
+			// Detect Header Changes
+			for (const auto& scriptHeader : scriptHeaders)
+			{
+				std::string headerUID = AS_STD_STRING(jenova::GenerateStandardUIDFromPath(scriptHeader));
+				if (!buildCacheDatabase["Headers"].contains(headerUID)) return modifiedModules;
+				if (buildCacheDatabase["Headers"][headerUID].get<std::string>() != AS_STD_STRING(JenovaBuildService::GetFileHash(scriptHeader))) return modifiedModules;
+			}
+
+			// Collect Modified Scripts
+			for (const auto& scriptModule : scriptModules)
+			{
+				std::string scriptUID = AS_STD_STRING(scriptModule.scriptUID);
+				if (!buildCacheDatabase["Modules"].contains(scriptUID)) return jenova::ModuleList();
+				if (buildCacheDatabase["Modules"][scriptUID].get<std::string>() == AS_STD_STRING(scriptModule.scriptHash)) continue;
+				if (scriptModule.scriptType == jenova::ScriptModuleType::InternalScript) return jenova::ModuleList();
+				modifiedModules.push_back(scriptModule);
+			}
+
+			// Only Script Sources Changed
+			requiresFullBuild = false;
+			return modifiedModules;
+		}
+		catch (const std::exception&)
+		{
+			return jenova::ModuleList();
+		}
+	}
+	jenova::SymbolList CollectObjectFunctionSymbols(const std::string& objectFile)
+	{
+		// Strong Global Functions Defined By Script Object [Targets for Rebinding Cross-Script Calls]
+		jenova::SymbolList functionSymbols;
+		#ifdef TARGET_PLATFORM_LINUX
+			jenova::MemoryBuffer objectData = jenova::ReadMemoryBufferFromFile(objectFile);
+			const Elf64_Ehdr* elfHeader = reinterpret_cast<const Elf64_Ehdr*>(objectData.data());
+			if (objectData.size() < sizeof(Elf64_Ehdr) || memcmp(elfHeader->e_ident, ELFMAG, SELFMAG) != 0 || elfHeader->e_ident[EI_CLASS] != ELFCLASS64) return functionSymbols;
+			if (elfHeader->e_shoff + size_t(elfHeader->e_shnum) * sizeof(Elf64_Shdr) > objectData.size()) return functionSymbols;
+			const Elf64_Shdr* sectionHeaders = reinterpret_cast<const Elf64_Shdr*>(objectData.data() + elfHeader->e_shoff);
+			for (size_t i = 0; i < elfHeader->e_shnum; i++)
+			{
+				const Elf64_Shdr& symbolSection = sectionHeaders[i];
+				if (symbolSection.sh_type != SHT_SYMTAB || symbolSection.sh_link >= elfHeader->e_shnum) continue;
+				const Elf64_Shdr& stringSection = sectionHeaders[symbolSection.sh_link];
+				if (symbolSection.sh_offset + symbolSection.sh_size > objectData.size() || stringSection.sh_offset + stringSection.sh_size > objectData.size()) continue;
+				const Elf64_Sym* elfSymbols = reinterpret_cast<const Elf64_Sym*>(objectData.data() + symbolSection.sh_offset);
+				const char* symbolNames = reinterpret_cast<const char*>(objectData.data() + stringSection.sh_offset);
+				for (size_t s = 0; s < symbolSection.sh_size / sizeof(Elf64_Sym); s++)
+				{
+					const Elf64_Sym& elfSymbol = elfSymbols[s];
+					if (ELF64_ST_TYPE(elfSymbol.st_info) != STT_FUNC || ELF64_ST_BIND(elfSymbol.st_info) != STB_GLOBAL) continue;
+					if (elfSymbol.st_shndx == SHN_UNDEF || elfSymbol.st_name == 0 || elfSymbol.st_name >= stringSection.sh_size) continue;
+					functionSymbols.push_back(symbolNames + elfSymbol.st_name);
+				}
+			}
+		#endif
+		return functionSymbols;
+	}
 	std::string GetLoadedModulePath(jenova::ModuleHandle moduleHandle)
 	{
 		// Windows Implementation
@@ -6410,111 +6960,229 @@ namespace jenova
 		// Not Implemented
 		return std::string("Unsupported");
 	}
-	jenova::MemoryBuffer CompressBuffer(void* bufferPtr, size_t bufferSize)
+	jenova::MemoryBuffer CompressBuffer(void* bufferPtr, size_t bufferSize, jenova::CompressionCodec compressionCodec, int compressionLevel)
 	{
+		// Create Profiler Scope
+		JENOVA_PROFILE_SCOPE("CompressBuffer");
+
 		try
 		{
-			jenova::MemoryBuffer buffer;
-			const size_t BUFSIZE = 128 * 1024;
-			std::unique_ptr<uint8_t[]> temp_buffer(new uint8_t[BUFSIZE]);
+			// Validate Input
+			if (!bufferPtr && bufferSize != 0) return jenova::MemoryBuffer();
 
-			z_stream strm;
-			strm.zalloc = 0;
-			strm.zfree = 0;
-			strm.next_in = reinterpret_cast<uint8_t*>(bufferPtr);
-			strm.avail_in = uInt(bufferSize);
-			strm.next_out = temp_buffer.get();
-			strm.avail_out = BUFSIZE;
+			// Preallocate Output Using Codec Bound
+			jenova::MemoryBuffer buffer(jenova::GetCompressionBound(bufferSize, compressionCodec));
 
-			deflateInit(&strm, Z_BEST_COMPRESSION);
+			// Store (No Compression)
+			if (compressionCodec == jenova::CompressionCodec::Store)
+			{
+				if (bufferSize != 0) memcpy(buffer.data(), bufferPtr, bufferSize);
+				return buffer;
+			}
 
-			while (strm.avail_in != 0)
+			// Zlib Codec
+			if (compressionCodec == jenova::CompressionCodec::Zlib)
 			{
-				int res = deflate(&strm, Z_NO_FLUSH);
-				assert(res == Z_OK);
-				if (strm.avail_out == 0)
-				{
-					buffer.insert(buffer.end(), temp_buffer.get(), temp_buffer.get() + BUFSIZE);
-					strm.next_out = temp_buffer.get();
-					strm.avail_out = BUFSIZE;
-				}
+				z_stream strm;
+				strm.zalloc = 0;
+				strm.zfree = 0;
+				strm.opaque = 0;
+				strm.next_in = reinterpret_cast<uint8_t*>(bufferPtr);
+				strm.avail_in = uInt(bufferSize);
+				strm.next_out = buffer.data();
+				strm.avail_out = uInt(buffer.size());
+				if (deflateInit(&strm, compressionLevel < 0 ? Z_BEST_COMPRESSION : std::clamp(compressionLevel, 1, 9)) != Z_OK) return jenova::MemoryBuffer();
+				int deflateResult = deflate(&strm, Z_FINISH);
+				deflateEnd(&strm);
+				if (deflateResult != Z_STREAM_END) return jenova::MemoryBuffer();
+				buffer.resize(strm.total_out);
+				return buffer;
 			}
 
-			int deflate_res = Z_OK;
-			while (deflate_res == Z_OK)
+			// LZ4 Codec (Level Above 1 Switches to High Compression Mode)
+			if (compressionCodec == jenova::CompressionCodec::LZ4)
 			{
-				if (strm.avail_out == 0)
-				{
-					buffer.insert(buffer.end(), temp_buffer.get(), temp_buffer.get() + BUFSIZE);
-					strm.next_out = temp_buffer.get();
-					strm.avail_out = BUFSIZE;
-				}
-				deflate_res = deflate(&strm, Z_FINISH);
+				if (bufferSize > size_t(LZ4_MAX_INPUT_SIZE)) return jenova::MemoryBuffer();
+				int compressedSize = 0;
+				if (compressionLevel <= 1) compressedSize = LZ4_compress_default((const char*)bufferPtr, (char*)buffer.data(), int(bufferSize), int(buffer.size()));
+				else compressedSize = LZ4_compress_HC((const char*)bufferPtr, (char*)buffer.data(), int(bufferSize), int(buffer.size()), std::clamp(compressionLevel, LZ4HC_CLEVEL_MIN, LZ4HC_CLEVEL_MAX));
+				if (compressedSize <= 0) return jenova::MemoryBuffer();
+				buffer.resize(compressedSize);
+				return buffer;
 			}
 
-			assert(deflate_res == Z_STREAM_END);
-			buffer.insert(buffer.end(), temp_buffer.get(), temp_buffer.get() + BUFSIZE - strm.avail_out);
-			deflateEnd(&strm);
+			// Zstandard Codec (Multithreaded)
+			if (compressionCodec == jenova::CompressionCodec::Zstd)
+			{
+				ZSTD_CCtx* zstdContext = ZSTD_createCCtx();
+				if (!zstdContext) return jenova::MemoryBuffer();
+				size_t workerThreads = jenova::GlobalSettings::CompressionWorkerThreads;
+				if (workerThreads == 0) workerThreads = std::max(1u, std::thread::hardware_concurrency());
+				ZSTD_CCtx_setParameter(zstdContext, ZSTD_c_compressionLevel, compressionLevel < 0 ? 19 : std::clamp(compressionLevel, 1, 19));
+				ZSTD_CCtx_setParameter(zstdContext, ZSTD_c_nbWorkers, int(workerThreads));
+				ZSTD_CCtx_setParameter(zstdContext, ZSTD_c_contentSizeFlag, 1);
+				size_t compressedSize = ZSTD_compress2(zstdContext, buffer.data(), buffer.size(), bufferPtr, bufferSize);
+				ZSTD_freeCCtx(zstdContext);
+				if (ZSTD_isError(compressedSize)) return jenova::MemoryBuffer();
+				buffer.resize(compressedSize);
+				return buffer;
+			}
 
-			return buffer;
+			// Unknown Codec
+			return jenova::MemoryBuffer();
 		}
 		catch (const std::exception&)
 		{
 			return jenova::MemoryBuffer();
 		}
 	}
-	jenova::MemoryBuffer DecompressBuffer(void* bufferPtr, size_t bufferSize)
+	jenova::MemoryBuffer DecompressBuffer(void* bufferPtr, size_t bufferSize, jenova::CompressionCodec compressionCodec, size_t decompressedSize)
 	{
 		try
 		{
-			jenova::MemoryBuffer buffer;
-			const size_t BUFSIZE = 128 * 1024;
-			std::unique_ptr<uint8_t[]> temp_buffer(new uint8_t[BUFSIZE]);
+			// Validate Input
+			if (!bufferPtr || bufferSize == 0) return jenova::MemoryBuffer();
 
-			z_stream strm;
-			strm.zalloc = 0;
-			strm.zfree = 0;
-			strm.next_in = reinterpret_cast<uint8_t*>(bufferPtr);
-			strm.avail_in = uInt(bufferSize);
-			strm.next_out = temp_buffer.get();
-			strm.avail_out = BUFSIZE;
-
-			inflateInit(&strm);
+			// Store (No Compression)
+			if (compressionCodec == jenova::CompressionCodec::Store)
+			{
+				if (decompressedSize != 0 && decompressedSize != bufferSize) return jenova::MemoryBuffer();
+				return jenova::MemoryBuffer((uint8_t*)bufferPtr, (uint8_t*)bufferPtr + bufferSize);
+			}
 
-			while (strm.avail_in != 0)
+			// Zlib Codec (Grows Output Geometrically When Size is Unknown)
+			if (compressionCodec == jenova::CompressionCodec::Zlib)
 			{
-				int res = inflate(&strm, Z_NO_FLUSH);
-				if (strm.avail_out == 0)
+				jenova::MemoryBuffer buffer(decompressedSize != 0 ? decompressedSize : bufferSize * 4);
+				z_stream strm;
+				strm.zalloc = 0;
+				strm.zfree = 0;
+				strm.opaque = 0;
+				strm.next_in = reinterpret_cast<uint8_t*>(bufferPtr);
+				strm.avail_in = uInt(bufferSize);
+				if (inflateInit(&strm) != Z_OK) return jenova::MemoryBuffer();
+				int inflateResult = Z_OK;
+				while (inflateResult == Z_OK || inflateResult == Z_BUF_ERROR)
 				{
-					buffer.insert(buffer.end(), temp_buffer.get(), temp_buffer.get() + BUFSIZE);
-					strm.next_out = temp_buffer.get();
-					strm.avail_out = BUFSIZE;
+					if (strm.total_out == buffer.size())
+					{
+						if (decompressedSize != 0) break;
+						buffer.resize(buffer.size() * 2);
+					}
+					strm.next_out = buffer.data() + strm.total_out;
+					strm.avail_out = uInt(buffer.size() - strm.total_out);
+					inflateResult = inflate(&strm, Z_FINISH);
+					if (inflateResult == Z_BUF_ERROR && strm.avail_in == 0) break;
 				}
+				inflateEnd(&strm);
+				if (inflateResult != Z_STREAM_END) return jenova::MemoryBuffer();
+				buffer.resize(strm.total_out);
+				return buffer;
+			}
+
+			// LZ4 Codec (Block Format Requires Original Size)
+			if (compressionCodec == jenova::CompressionCodec::LZ4)
+			{
+				if (decompressedSize == 0 || decompressedSize > size_t(LZ4_MAX_INPUT_SIZE)) return jenova::MemoryBuffer();
+				jenova::MemoryBuffer buffer(decompressedSize);
+				int result = LZ4_decompress_safe((const char*)bufferPtr, (char*)buffer.data(), int(bufferSize), int(decompressedSize));
+				if (result < 0 || size_t(result) != decompressedSize) return jenova::MemoryBuffer();
+				return buffer;
 			}
 
-			int inflate_res = Z_OK;
-			while (inflate_res == Z_OK)
+			// Zstandard Codec
+			if (compressionCodec == jenova::CompressionCodec::Zstd)
 			{
-				if (strm.avail_out == 0)
+				if (decompressedSize == 0)
 				{
-					buffer.insert(buffer.end(), temp_buffer.get(), temp_buffer.get() + BUFSIZE);
-					strm.next_out = temp_buffer.get();
-					strm.avail_out = BUFSIZE;
+					unsigned long long frameContentSize = ZSTD_getFrameContentSize(bufferPtr, bufferSize);
+					if (frameContentSize == ZSTD_CONTENTSIZE_ERROR || frameContentSize == ZSTD_CONTENTSIZE_UNKNOWN) return jenova::MemoryBuffer();
+					decompressedSize = size_t(frameContentSize);
 				}
-				inflate_res = inflate(&strm, Z_FINISH);
+				jenova::MemoryBuffer buffer(decompressedSize);
+				size_t result = ZSTD_decompress(buffer.data(), buffer.size(), bufferPtr, bufferSize);
+				if (ZSTD_isError(result) || result != decompressedSize) return jenova::MemoryBuffer();
+				return buffer;
 			}
 
-			assert(inflate_res == Z_STREAM_END);
-			buffer.insert(buffer.end(), temp_buffer.get(), temp_buffer.get() + BUFSIZE - strm.avail_out);
-			inflateEnd(&strm);
-
-			return buffer;
+			// Unknown Codec
+			return jenova::MemoryBuffer();
 		}
 		catch (const std::exception&)
 		{
 			return jenova::MemoryBuffer();
 		}
 	}
+	bool DecompressBufferTo(void* bufferPtr, size_t bufferSize, jenova::CompressionCodec compressionCodec, void* outputPtr, size_t outputSize)
+	{
+		// Validate Buffers
+		if (!bufferPtr || !outputPtr || bufferSize == 0 || outputSize == 0) return false;
+
+		// Store Codec
+		if (compressionCodec == jenova::CompressionCodec::Store)
+		{
+			if (bufferSize != outputSize) return false;
+			memcpy(outputPtr, bufferPtr, outputSize);
+			return true;
+		}
+
+		// Zlib Codec
+		if (compressionCodec == jenova::CompressionCodec::Zlib)
+		{
+			z_stream strm;
+			strm.zalloc = 0;
+			strm.zfree = 0;
+			strm.opaque = 0;
+			strm.next_in = reinterpret_cast<uint8_t*>(bufferPtr);
+			strm.avail_in = uInt(bufferSize);
+			strm.next_out = reinterpret_cast<uint8_t*>(outputPtr);
+			strm.avail_out = uInt(outputSize);
+			if (inflateInit(&strm) != Z_OK) return false;
+			int inflateResult = inflate(&strm, Z_FINISH);
+			inflateEnd(&strm);
+			return inflateResult == Z_STREAM_END && strm.total_out == outputSize;
+		}
+
+		// LZ4 Codec
+		if (compressionCodec == jenova::CompressionCodec::LZ4)
+		{
+			if (outputSize > size_t(LZ4_MAX_INPUT_SIZE)) return false;
+			int result = LZ4_decompress_safe((const char*)bufferPtr, (char*)outputPtr, int(bufferSize), int(outputSize));
+			return result >= 0 && size_t(result) == outputSize;
+		}
+
+		// Zstandard Codec
+		if (compressionCodec == jenova::CompressionCodec::Zstd)
+		{
+			size_t result = ZSTD_decompress(outputPtr, outputSize, bufferPtr, bufferSize);
+			return !ZSTD_isError(result) && result == outputSize;
+		}
+
+		// Unknown Codec
+		return false;
+	}
+	size_t GetCompressionBound(size_t bufferSize, jenova::CompressionCodec compressionCodec)
+	{
+		switch (compressionCodec)
+		{
+		case jenova::CompressionCodec::Store:	return bufferSize;
+		case jenova::CompressionCodec::Zlib:	return size_t(compressBound(uLong(bufferSize)));
+		case jenova::CompressionCodec::LZ4:		return size_t(LZ4_compressBound(int(std::min(bufferSize, size_t(LZ4_MAX_INPUT_SIZE)))));
+		case jenova::CompressionCodec::Zstd:	return ZSTD_compressBound(bufferSize);
+		default:								return bufferSize;
+		}
+	}
+	std::string GetCompressionCodecName(jenova::CompressionCodec compressionCodec)
+	{
+		switch (compressionCodec)
+		{
+		case jenova::CompressionCodec::Store:	return "Store";
+		case jenova::CompressionCodec::Zlib:	return "Zlib";
+		case jenova::CompressionCodec::LZ4:		return "LZ4";
+		case jenova::CompressionCodec::Zstd:	return "Zstd";
+		default:								return "Unknown";
+		}
+	}
 	float CalculateCompressionRatio(size_t baseSize, size_t compressedSize) 
 	{
 		if (baseSize == 0) return 100.0f;
@@ -7196,6 +7864,9 @@ namespace jenova
 	{
 		// Create Addon List
 		jenova::InstalledAddons addonList;
+
+		// Use Build Service Cache If Still Valid
+		if (JenovaBuildService::GetInstalledAddons(addonList)) return addonList;
 		
 		// Collect Installed Addons
 		for (const auto& addonPackage : jenova::GetInstalledAddonPackages())
@@ -7242,6 +7913,9 @@ namespace jenova
 			}
 		}
 
+		// Cache Addon List
+		JenovaBuildService::CacheInstalledAddons(addonList);
+
 		// Return Addon List
 		return addonList;
 	}
@@ -8007,7 +8681,7 @@ namespace jenova
 					propertiesMetadata.push_back(propertyMetadata);
 
 					// Verbose
-					jenova::VerboseByID(__LINE__, "Property Extracted >> Name : [%s] Type : [%s]  Default Value :[%s]", args[0].c_str(), args[1].c_str(), args[2].c_str());
+					JENOVA_VERBOSE_BY_ID(__LINE__, "Property Extracted >> Name : [%s] Type : [%s]  Default Value :[%s]", args[0].c_str(), args[1].c_str(), args[2].c_str());
 				}
 
 				// Add Header Comment
@@ -8152,6 +8826,12 @@ namespace jenova
 		jenova::ReplaceAllMatchesWithString(typeName, "&", "");
 		jenova::ReplaceAllMatchesWithString(typeName, "godot::", "");
 	}
+	template <typename T> void* AllocateTrackedProperty()
+	{
+		T* propertyPtr = new T();
+		JenovaMemoryTracker::TrackPointer(jenova::MemoryTag::ScriptProperties, propertyPtr, sizeof(T));
+		return propertyPtr;
+	}
 	void* AllocateVariantBasedProperty(const std::string& typeName)
 	{
 		// Clean Type Name
@@ -8159,53 +8839,53 @@ namespace jenova
 		CleanVariantTypeName(typeNameCleaned);
 
 		// Atomic types
-		if (typeNameCleaned == "bool") return new bool();
-		if (typeNameCleaned == "int" || typeNameCleaned == "int32_t" || typeNameCleaned == "int64_t") return new int64_t();
-		if (typeNameCleaned == "double" || typeNameCleaned == "float") return new double();
-		if (typeNameCleaned == "String") return new godot::String();
+		if (typeNameCleaned == "bool") return AllocateTrackedProperty<bool>();
+		if (typeNameCleaned == "int" || typeNameCleaned == "int32_t" || typeNameCleaned == "int64_t") return AllocateTrackedProperty<int64_t>();
+		if (typeNameCleaned == "double" || typeNameCleaned == "float") return AllocateTrackedProperty<double>();
+		if (typeNameCleaned == "String") return AllocateTrackedProperty<godot::String>();
 
 		// Math types
-		if (typeNameCleaned == "Vector2") return new godot::Vector2();
-		if (typeNameCleaned == "Vector2i") return new godot::Vector2i();
-		if (typeNameCleaned == "Rect2") return new godot::Rect2();
-		if (typeNameCleaned == "Rect2i") return new godot::Rect2i();
-		if (typeNameCleaned == "Vector3") return new godot::Vector3();
-		if (typeNameCleaned == "Vector3i") return new godot::Vector3i();
-		if (typeNameCleaned == "Transform2D") return new godot::Transform2D();
-		if (typeNameCleaned == "Vector4") return new godot::Vector4();
-		if (typeNameCleaned == "Vector4i") return new godot::Vector4i();
-		if (typeNameCleaned == "Plane") return new godot::Plane();
-		if (typeNameCleaned == "Quaternion") return new godot::Quaternion();
-		if (typeNameCleaned == "AABB") return new godot::AABB();
-		if (typeNameCleaned == "Basis") return new godot::Basis();
-		if (typeNameCleaned == "Transform3D") return new godot::Transform3D();
-		if (typeNameCleaned == "Projection") return new godot::Projection();
+		if (typeNameCleaned == "Vector2") return AllocateTrackedProperty<godot::Vector2>();
+		if (typeNameCleaned == "Vector2i") return AllocateTrackedProperty<godot::Vector2i>();
+		if (typeNameCleaned == "Rect2") return AllocateTrackedProperty<godot::Rect2>();
+		if (typeNameCleaned == "Rect2i") return AllocateTrackedProperty<godot::Rect2i>();
+		if (typeNameCleaned == "Vector3") return AllocateTrackedProperty<godot::Vector3>();
+		if (typeNameCleaned == "Vector3i") return AllocateTrackedProperty<godot::Vector3i>();
+		if (typeNameCleaned == "Transform2D") return AllocateTrackedProperty<godot::Transform2D>();
+		if (typeNameCleaned == "Vector4") return AllocateTrackedProperty<godot::Vector4>();
+		if (typeNameCleaned == "Vector4i") return AllocateTrackedProperty<godot::Vector4i>();
+		if (typeNameCleaned == "Plane") return AllocateTrackedProperty<godot::Plane>();
+		if (typeNameCleaned == "Quaternion") return AllocateTrackedProperty<godot::Quaternion>();
+		if (typeNameCleaned == "AABB") return AllocateTrackedProperty<godot::AABB>();
+		if (typeNameCleaned == "Basis") return AllocateTrackedProperty<godot::Basis>();
+		if (typeNameCleaned == "Transform3D") return AllocateTrackedProperty<godot::Transform3D>();
+		if (typeNameCleaned == "Projection") return AllocateTrackedProperty<godot::Projection>();
 
 		// Misc types
-		if (typeNameCleaned == "Color") return new godot::Color();
-		if (typeNameCleaned == "StringName") return new godot::StringName();
-		if (typeNameCleaned == "NodePath") return new godot::NodePath();
-		if (typeNameCleaned == "RID") return new godot::RID();
-		if (typeNameCleaned == "Object") return new Variant();
-		if (typeNameCleaned == "Callable") return new godot::Callable();
-		if (typeNameCleaned == "Signal") return new godot::Signal();
-		if (typeNameCleaned == "Dictionary") return new godot::Dictionary();
-		if (typeNameCleaned == "Array") return new godot::Array();
+		if (typeNameCleaned == "Color") return AllocateTrackedProperty<godot::Color>();
+		if (typeNameCleaned == "StringName") return AllocateTrackedProperty<godot::StringName>();
+		if (typeNameCleaned == "NodePath") return AllocateTrackedProperty<godot::NodePath>();
+		if (typeNameCleaned == "RID") return AllocateTrackedProperty<godot::RID>();
+		if (typeNameCleaned == "Object") return AllocateTrackedProperty<Variant>();
+		if (typeNameCleaned == "Callable") return AllocateTrackedProperty<godot::Callable>();
+		if (typeNameCleaned == "Signal") return AllocateTrackedProperty<godot::Signal>();
+		if (typeNameCleaned == "Dictionary") return AllocateTrackedProperty<godot::Dictionary>();
+		if (typeNameCleaned == "Array") return AllocateTrackedProperty<godot::Array>();
 
 		// Typed arrays
-		if (typeNameCleaned == "PackedByteArray") return new godot::PackedByteArray();
-		if (typeNameCleaned == "PackedInt32Array") return new godot::PackedInt32Array();
-		if (typeNameCleaned == "PackedInt64Array") return new godot::PackedInt64Array();
-		if (typeNameCleaned == "PackedFloat32Array") return new godot::PackedFloat32Array();
-		if (typeNameCleaned == "PackedFloat64Array") return new godot::PackedFloat64Array();
-		if (typeNameCleaned == "PackedStringArray") return new godot::PackedStringArray();
-		if (typeNameCleaned == "PackedVector2Array") return new godot::PackedVector2Array();
-		if (typeNameCleaned == "PackedVector3Array") return new godot::PackedVector3Array();
-		if (typeNameCleaned == "PackedColorArray") return new godot::PackedColorArray();
-		if (typeNameCleaned == "PackedVector4Array") return new godot::PackedVector4Array();
+		if (typeNameCleaned == "PackedByteArray") return AllocateTrackedProperty<godot::PackedByteArray>();
+		if (typeNameCleaned == "PackedInt32Array") return AllocateTrackedProperty<godot::PackedInt32Array>();
+		if (typeNameCleaned == "PackedInt64Array") return AllocateTrackedProperty<godot::PackedInt64Array>();
+		if (typeNameCleaned == "PackedFloat32Array") return AllocateTrackedProperty<godot::PackedFloat32Array>();
+		if (typeNameCleaned == "PackedFloat64Array") return AllocateTrackedProperty<godot::PackedFloat64Array>();
+		if (typeNameCleaned == "PackedStringArray") return AllocateTrackedProperty<godot::PackedStringArray>();
+		if (typeNameCleaned == "PackedVector2Array") return AllocateTrackedProperty<godot::PackedVector2Array>();
+		if (typeNameCleaned == "PackedVector3Array") return AllocateTrackedProperty<godot::PackedVector3Array>();
+		if (typeNameCleaned == "PackedColorArray") return AllocateTrackedProperty<godot::PackedColorArray>();
+		if (typeNameCleaned == "PackedVector4Array") return AllocateTrackedProperty<godot::PackedVector4Array>();
 
 		// Default Case [Material, Animation etc.]
-		return new Variant();
+		return AllocateTrackedProperty<Variant>();
 	}
 	bool SetPropertyPointerValueFromVariant(jenova::PropertyPointer propertyPointer, const Variant& variantValue)
 	{
@@ -8766,6 +9446,52 @@ namespace jenova
 			{
 				JenovaInterpreter::SetDebugModeExecutionState(true);
 			}
+
+			// Record Runtime Trace
+			if (argument == "--Enable-Trace-Recording")
+			{
+				JenovaTinyProfiler::StartTraceRecording(jenova::GlobalSettings::TraceRecorderRuntimeRingEvents);
+			}
+
+			// Sample Native Script Code
+			if (argument == "--Enable-Native-Sampling")
+			{
+				jenova::GlobalStorage::UseNativeSamplingProfiler = true;
+			}
+
+			// Time Runtime Events Against A Frame Budget
+			if (argument.begins_with("--Jenova-Frame-Budget="))
+			{
+				JenovaFrameBudget::SetFrameBudget(argument.get_slice("=", 1).to_float());
+			}
+
+			// Write Memory Report On Shutdown
+			if (argument == "--Dump-Jenova-Memory-Report")
+			{
+				jenova::GlobalStorage::MemoryReportPath = AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::JenovaMemoryReportFile;
+			}
+			if (argument.begins_with("--Dump-Jenova-Memory-Report="))
+			{
+				jenova::GlobalStorage::MemoryReportPath = AS_STD_STRING(argument.get_slice("=", 1));
+			}
+
+			// Write Perf Map For External Profilers
+			if (argument == "--Enable-Perf-Map")
+			{
+				JenovaPerfMap::Open();
+			}
+
+			// Run Benchmark Suite [Benchmark Builds Only]
+			#ifdef JENOVA_BENCHMARK
+			if (argument == "--Run-Jenova-Benchmark")
+			{
+				if (!JenovaBenchmarkSuite::IsRunRequested()) JenovaBenchmarkSuite::RequestRun("");
+			}
+			if (argument.begins_with("--Jenova-Benchmark-Output="))
+			{
+				JenovaBenchmarkSuite::RequestRun(AS_STD_STRING(argument.get_slice("=", 1)));
+			}
+			#endif
 		}
 
 		// All Good
@@ -21,6 +21,8 @@
 #include <stdarg.h>
 #include <iostream>
 #include <functional>
+#include <string>
+#include <vector>
 
 // Godot SDK
 #include <gdextension_interface.h>
@@ -101,10 +103,43 @@ public:
 
 // Storages
 godot::Vector<NodeBackup> nodeBackups;
-std::unordered_map<std::string, void*> globalMemoryMap;
-std::unordered_map<std::string, godot::Variant> globalVariables;
 
 // Internal Helpers
+static const char* FormatToBuffer(const char* format, va_list args)
+{
+	// Per-Thread Buffer Grows to Fit, No Truncation And No Allocation Once Warm
+	static thread_local std::vector<char> formatBuffer(1024);
+	va_list argsCopy;
+	va_copy(argsCopy, args);
+	int requiredSize = vsnprintf(formatBuffer.data(), formatBuffer.size(), format, argsCopy);
+	va_end(argsCopy);
+	if (requiredSize < 0) return "";
+	if (size_t(requiredSize) >= formatBuffer.size())
+	{
+		formatBuffer.resize(size_t(requiredSize) + 1);
+		vsnprintf(formatBuffer.data(), formatBuffer.size(), format, args);
+	}
+	return formatBuffer.data();
+}
+static const wchar_t* FormatToBuffer(const wchar_t* format, va_list args)
+{
+	// vswprintf Does Not Report Required Size, Grow Until It Fits [Capped to Stop On Encoding Errors]
+	static thread_local std::vector<wchar_t> formatBuffer(1024);
+	while (true)
+	{
+		va_list argsCopy;
+		va_copy(argsCopy, args);
+		int writtenSize = vswprintf(formatBuffer.data(), formatBuffer.size(), format, argsCopy);
+		va_end(argsCopy);
+		if (writtenSize >= 0 && size_t(writtenSize) < formatBuffer.size()) return formatBuffer.data();
+		if (formatBuffer.size() >= (1 << 24))
+		{
+			formatBuffer.back() = L'\0';
+			return formatBuffer.data();
+		}
+		formatBuffer.resize(formatBuffer.size() * 2);
+	}
+}
 static void CollectNodesByClassName(godot::Node* node, const godot::String& class_name, godot::Vector<godot::Node*>& result)
 {
 	if (node->is_class(class_name))
@@ -127,7 +162,7 @@ static bool OverrideClassAPIType(const godot::StringName& className, jenova::sdk
 		auto result = godot::ClassDBSingleton::get_singleton()->call("class_override_api_type", className, int(apiType));
 		if (godot::Error(int(result)) != godot::Error::OK)
 		{
-			jenova::Error("Sakura", "Failed to Override API of Class '%s'", jenova::sdk::GetCStr(className));
+			jenova::Error("Sakura", "Failed to Override API of Class '%s'", jenova::sdk::GetTempCStr(className));
 			return false;
 		};
 
@@ -190,22 +225,6 @@ namespace jenova::sdk
 		if (scene_tree) return scene_tree->get_root()->get_node<godot::Node>(godot::NodePath(path));
 		return nullptr;
 	}
-	godot::Node* JenovaSDK::FindNodeByName(godot::Node* parent, const godot::String& name)
-	{
-		if (!parent) return nullptr;
-		if (parent->get_name() == name) return parent;
-		for (int i = 0; i < parent->get_child_count(); ++i)
-		{
-			godot::Node* child = parent->get_child(i);
-			godot::Node* result = FindNodeByName(child, name);
-			if (result) return result;
-		}
-		return nullptr;
-	}
-	StringPtr JenovaSDK::GetNodeUniqueID(godot::Node* node)
-	{
-		return GetCStr(godot::String(node->get_path()).md5_text());
-	}
 	godot::SceneTree* JenovaSDK::GetTree()
 	{
 		godot::SceneTree* scene_tree = dynamic_cast<godot::SceneTree*>(godot::Engine::get_singleton()->get_main_loop());
@@ -218,34 +237,24 @@ namespace jenova::sdk
 	}
 	godot::String JenovaSDK::Format(StringPtr format, va_list args)
 	{
-		char buffer[1024];
-		vsnprintf(buffer, sizeof(buffer), format, args);
-		return godot::String(buffer);
+		return godot::String(FormatToBuffer(format, args));
 	}
 	godot::String JenovaSDK::Format(WideStringPtr format, va_list args)
 	{
-		wchar_t buffer[1024];
-		vswprintf(buffer, sizeof(buffer) / sizeof(wchar_t), format, args);
-		return godot::String(buffer);
+		return godot::String(FormatToBuffer(format, args));
 	}
 	void JenovaSDK::Output(StringPtr format, va_list args)
 	{
-		char buffer[1024];
-		vsnprintf(buffer, sizeof(buffer), format, args);
-		godot::UtilityFunctions::print(godot::String("[JENOVA-SDK] > ") + godot::String(buffer));
+		godot::UtilityFunctions::print(godot::String("[JENOVA-SDK] > ") + godot::String(FormatToBuffer(format, args)));
 	}
 	void JenovaSDK::Output(WideStringPtr format, va_list args)
 	{
-		wchar_t buffer[1024];
-		vswprintf(buffer, sizeof(buffer) / sizeof(wchar_t), format, args);
-		godot::UtilityFunctions::print(godot::String(L"[JENOVA-SDK] > ") + godot::String(buffer));
+		godot::UtilityFunctions::print(godot::String(L"[JENOVA-SDK] > ") + godot::String(FormatToBuffer(format, args)));
 	}
 	void JenovaSDK::DebugOutput(StringPtr format, va_list args)
 	{
-		char buffer[1024];
-		vsnprintf(buffer, sizeof(buffer), format, args);
 		std::string debugMessage = "[JENOVA-SDK] ::> ";
-		debugMessage += buffer;
+		debugMessage += FormatToBuffer(format, args);
 
 		// Debug Print
 		#if defined(_WIN32) || defined(_WIN64)
@@ -256,10 +265,8 @@ namespace jenova::sdk
 	}
 	void JenovaSDK::DebugOutput(WideStringPtr format, va_list args)
 	{
-		wchar_t buffer[1024];
-		vswprintf(buffer, sizeof(buffer) / sizeof(wchar_t), format, args);
 		std::wstring debugMessage = L"[JENOVA-SDK] ::> ";
-		debugMessage += buffer;
+		debugMessage += FormatToBuffer(format, args);
 
 		// Debug Print
 		#if defined(_WIN32) || defined(_WIN64)
@@ -268,32 +275,6 @@ namespace jenova::sdk
 			std::wclog << debugMessage << std::endl;
 		#endif
 	}
-	StringPtr JenovaSDK::GetCStr(const godot::String& godotStr)
-	{
-		std::string str((char*)godotStr.utf8().ptr(), godotStr.utf8().size());
-		if (!str.empty() && str.back() == '\0') str.pop_back();
-
-		// Bad Approach, Needs Improvement
-		#if defined(_WIN32) || defined(_WIN64)
-			return _strdup(str.c_str());
-		#else
-			return strdup(str.c_str());
-		#endif
-	}
-	WideStringPtr JenovaSDK::GetWCStr(const godot::String& godotStr)
-	{
-		godot::PackedByteArray wchar_buffer = godotStr.to_wchar_buffer();
-		size_t length = wchar_buffer.size() / sizeof(wchar_t);
-		std::wstring str((wchar_t*)wchar_buffer.ptr(), length);
-		if (!str.empty() && str.back() == L'\0') str.pop_back();
-
-		// Bad Approach, Needs Improvement
-		#if defined(_WIN32) || defined(_WIN64)
-				return _wcsdup(str.c_str());
-		#else
-				return wcsdup(str.c_str());
-		#endif
-	}
 	bool JenovaSDK::SetClassIcon(const godot::String& className, const godot::Ref<godot::Texture2D> iconImage)
 	{
 		if (!godot::ClassDB::class_exists(className)) return false;
@@ -323,15 +304,133 @@ namespace jenova::sdk
 // Jenova Runtime SDK
 #include "Jenova.hpp"
 
+// Runtime SDK Internal Helpers
+template <typename CharType> class SDKStringRing
+{
+public:
+	// Strings Returned to Scripts Live Until TemporaryStringCount More Conversions On The Same Thread
+	static SDKStringRing& GetInstance()
+	{
+		static thread_local SDKStringRing stringRing;
+		return stringRing;
+	}
+	const CharType* Store(const CharType* stringData, size_t stringLength)
+	{
+		std::basic_string<CharType>& stringSlot = stringSlots[nextSlot];
+		nextSlot = (nextSlot + 1) % jenova::sdk::TemporaryStringCount;
+		size_t previousCapacity = stringSlot.capacity();
+		if (stringData) stringSlot.assign(stringData, stringLength);
+		else stringSlot.clear();
+		if (stringSlot.capacity() > previousCapacity) JenovaMemoryTracker::TrackAllocation(jenova::MemoryTag::SDKStrings, (stringSlot.capacity() - previousCapacity) * sizeof(CharType));
+		return stringSlot.c_str();
+	}
+	~SDKStringRing()
+	{
+		// Inline Capacity Was Never Tracked
+		size_t inlineCapacity = std::basic_string<CharType>().capacity();
+		for (const auto& stringSlot : stringSlots) JenovaMemoryTracker::TrackRelease(jenova::MemoryTag::SDKStrings, (stringSlot.capacity() - inlineCapacity) * sizeof(CharType));
+	}
+
+private:
+	SDKStringRing() = default;
+	std::basic_string<CharType> stringSlots[jenova::sdk::TemporaryStringCount];
+	size_t nextSlot = 0;
+};
+
 // Runtime SDK Implementation
 namespace jenova::sdk
 {
 	// Helpers Utilities
+	godot::Node* JenovaSDK::FindNodeByName(godot::Node* parent, const godot::String& name)
+	{
+		// Indexed Lookup For Nodes Inside Scene Tree
+		if (!parent) return nullptr;
+		if (JenovaSceneIndex::IsIndexed(parent)) return JenovaSceneIndex::FindNodeByName(parent, name);
+
+		// Detached Nodes Fall Back to Depth-First Search
+		if (parent->get_name() == name) return parent;
+		for (int i = 0; i < parent->get_child_count(); ++i)
+		{
+			godot::Node* child = parent->get_child(i);
+			godot::Node* result = FindNodeByName(child, name);
+			if (result) return result;
+		}
+		return nullptr;
+	}
+	StringPtr JenovaSDK::GetNodeUniqueID(godot::Node* node)
+	{
+		// Caller Owns Returned Copy, Scene Index Only Saves The Path Hashing
+		if (!node) return nullptr;
+		const std::string* uniqueID = JenovaSceneIndex::GetNodeUniqueID(node);
+		if (!uniqueID) return GetCStr(godot::String(node->get_path()).md5_text());
+		JenovaMemoryTracker::TrackAllocation(jenova::MemoryTag::SDKStrings, uniqueID->size() + 1);
+		#if defined(_WIN32) || defined(_WIN64)
+			return _strdup(uniqueID->c_str());
+		#else
+			return strdup(uniqueID->c_str());
+		#endif
+	}
+	StringPtr JenovaSDK::GetBorrowedNodeUniqueID(godot::Node* node)
+	{
+		// Cached In Scene Index, Valid While Node Stays In Tree Under Same Path
+		if (!node) return nullptr;
+		const std::string* uniqueID = JenovaSceneIndex::GetNodeUniqueID(node);
+		if (uniqueID) return uniqueID->c_str();
+		return GetTempCStr(godot::String(node->get_path()).md5_text());
+	}
+	godot::Node* JenovaSDK::GetNodeByUniqueID(const godot::String& uniqueID)
+	{
+		return JenovaSceneIndex::GetNodeByUniqueID(uniqueID);
+	}
+	godot::TypedArray<godot::Node> JenovaSDK::FindNodesByName(const godot::String& name)
+	{
+		return JenovaSceneIndex::FindNodesByName(name);
+	}
+	godot::TypedArray<godot::Node> JenovaSDK::FindNodesByClass(const godot::String& className)
+	{
+		return JenovaSceneIndex::FindNodesByClass(className);
+	}
+	StringPtr JenovaSDK::GetCStr(const godot::String& godotStr)
+	{
+		// Caller Owns Returned Copy
+		godot::CharString utf8String = godotStr.utf8();
+		JenovaMemoryTracker::TrackAllocation(jenova::MemoryTag::SDKStrings, size_t(utf8String.length()) + 1);
+		#if defined(_WIN32) || defined(_WIN64)
+			return _strdup(utf8String.get_data());
+		#else
+			return strdup(utf8String.get_data());
+		#endif
+	}
+	WideStringPtr JenovaSDK::GetWCStr(const godot::String& godotStr)
+	{
+		// Caller Owns Returned Copy
+		godot::PackedByteArray wcharBuffer = godotStr.to_wchar_buffer();
+		std::wstring str(reinterpret_cast<const wchar_t*>(wcharBuffer.ptr()), wcharBuffer.size() / sizeof(wchar_t));
+		if (!str.empty() && str.back() == L'\0') str.pop_back();
+		JenovaMemoryTracker::TrackAllocation(jenova::MemoryTag::SDKStrings, (str.size() + 1) * sizeof(wchar_t));
+		#if defined(_WIN32) || defined(_WIN64)
+			return _wcsdup(str.c_str());
+		#else
+			return wcsdup(str.c_str());
+		#endif
+	}
+	StringPtr JenovaSDK::GetTempCStr(const godot::String& godotStr)
+	{
+		// Single UTF-8 Conversion Into A Reused Ring Slot
+		godot::CharString utf8String = godotStr.utf8();
+		return SDKStringRing<char>::GetInstance().Store(utf8String.get_data(), size_t(utf8String.length()));
+	}
+	WideStringPtr JenovaSDK::GetTempWCStr(const godot::String& godotStr)
+	{
+		godot::PackedByteArray wcharBuffer = godotStr.to_wchar_buffer();
+		const wchar_t* wcharData = reinterpret_cast<const wchar_t*>(wcharBuffer.ptr());
+		size_t wcharLength = wcharBuffer.size() / sizeof(wchar_t);
+		if (wcharLength != 0 && wcharData[wcharLength - 1] == L'\0') wcharLength--;
+		return SDKStringRing<wchar_t>::GetInstance().Store(wcharData, wcharLength);
+	}
 	void JenovaSDK::Alert(StringPtr fmt, va_list args)
 	{
-		char buffer[1024];
-		vsnprintf(buffer, sizeof(buffer), fmt, args);
-		ShowMessageBox(buffer, "[JENOVA-SDK]", 0);
+		ShowMessageBox(FormatToBuffer(fmt, args), "[JENOVA-SDK]", 0);
 	}
 	jenova::sdk::EngineMode JenovaSDK::GetEngineMode()
 	{
@@ -373,19 +472,19 @@ namespace jenova::sdk
 	}
 	void JenovaSDK::CreateCheckpoint(const godot::String& checkPointName)
 	{
-		JenovaTinyProfiler::CreateCheckpoint(AS_STD_STRING(checkPointName));
+		JenovaTinyProfiler::CreateCheckpoint(JenovaTinyProfiler::HashScopeName(checkPointName.ptr(), checkPointName.length()));
 	}
 	double JenovaSDK::GetCheckpointTime(const godot::String& checkPointName)
 	{
-		return JenovaTinyProfiler::GetCheckpointTime(AS_STD_STRING(checkPointName));
+		return JenovaTinyProfiler::GetCheckpointTime(JenovaTinyProfiler::HashScopeName(checkPointName.ptr(), checkPointName.length()));
 	}
 	void JenovaSDK::DeleteCheckpoint(const godot::String& checkPointName)
 	{
-		JenovaTinyProfiler::DeleteCheckpoint(AS_STD_STRING(checkPointName));
+		JenovaTinyProfiler::DeleteCheckpoint(JenovaTinyProfiler::HashScopeName(checkPointName.ptr(), checkPointName.length()));
 	}
 	double JenovaSDK::GetCheckpointTimeAndDispose(const godot::String& checkPointName)
 	{
-		return JenovaTinyProfiler::GetCheckpointTimeAndDispose(AS_STD_STRING(checkPointName));
+		return JenovaTinyProfiler::GetCheckpointTimeAndDispose(JenovaTinyProfiler::HashScopeName(checkPointName.ptr(), checkPointName.length()));
 	}
 	bool JenovaSDK::RegisterRuntimeCallback(RuntimeCallback callbackPtr)
 	{
@@ -395,6 +494,16 @@ namespace jenova::sdk
 	{
 		return jenova::UnregisterRuntimeEventCallback((jenova::FunctionPointer)callbackPtr);
 	}
+	bool JenovaSDK::SetFrameBudget(double budgetMilliseconds)
+	{
+		if (budgetMilliseconds < 0.0) return false;
+		JenovaFrameBudget::SetFrameBudget(budgetMilliseconds);
+		return true;
+	}
+	godot::Dictionary JenovaSDK::GetFrameTimingReport()
+	{
+		return JenovaFrameBudget::GetFrameTimingReport();
+	}
 
 	// Graphic Utilities
 	NativePtr JenovaSDK::GetGameWindowHandle()
@@ -420,57 +529,104 @@ namespace jenova::sdk
 	// Memory Management Utilities (Anzen)
 	NativePtr JenovaSDK::GetGlobalPointer(MemoryID id)
 	{
-		auto it = globalMemoryMap.find(id);
-		if (it != globalMemoryMap.end()) return it->second;
-		return nullptr;
+		return JenovaGlobalStore::GetPointer(JenovaGlobalStore::FindGlobal(id));
 	}
 	NativePtr JenovaSDK::SetGlobalPointer(MemoryID id, NativePtr ptr)
 	{
-		auto it = globalMemoryMap.find(id);
-		if (it != globalMemoryMap.end())
-		{
-			NativePtr oldPtr = it->second;
-			it->second = ptr;
-			return oldPtr;
-		}
-		else {
-			globalMemoryMap[id] = ptr;
-			return ptr;
-		}
+		NativePtr oldPtr = JenovaGlobalStore::ExchangePointer(JenovaGlobalStore::RegisterGlobal(id), ptr);
+		return oldPtr ? oldPtr : ptr;
 	}
 	void JenovaSDK::DeleteGlobalPointer(MemoryID id)
 	{
-		globalMemoryMap.erase(id);
+		JenovaGlobalStore::ExchangePointer(JenovaGlobalStore::FindGlobal(id), nullptr);
 	}
 	NativePtr JenovaSDK::AllocateGlobalMemory(MemoryID id, size_t size)
 	{
+		JenovaGlobalStore::GlobalHandle globalHandle = JenovaGlobalStore::RegisterGlobal(id);
+		if (globalHandle == JenovaGlobalStore::InvalidHandle) return nullptr;
 		NativePtr mem = jenova::AllocateMemory(size);
 		if (!mem) return nullptr;
-		globalMemoryMap[id] = mem;
+		JenovaMemoryTracker::TrackPointer(jenova::MemoryTag::GlobalMemory, mem, size);
+		JenovaGlobalStore::ExchangePointer(globalHandle, mem);
 		return mem;
 	}
 	void JenovaSDK::FreeGlobalMemory(MemoryID id)
 	{
-		auto it = globalMemoryMap.find(id);
-		if (it != globalMemoryMap.end())
-		{
-			jenova::FreeMemory(it->second);
-			globalMemoryMap.erase(it);
-		}
+		NativePtr mem = JenovaGlobalStore::ExchangePointer(JenovaGlobalStore::FindGlobal(id), nullptr);
+		if (!mem) return;
+		JenovaMemoryTracker::UntrackPointer(jenova::MemoryTag::GlobalMemory, mem);
+		jenova::FreeMemory(mem);
+	}
+	godot::Dictionary JenovaSDK::GetMemoryReport()
+	{
+		return JenovaMemoryTracker::GetMemoryReport();
+	}
+	bool JenovaSDK::DumpMemoryReport(const godot::String& reportFile)
+	{
+		if (reportFile.is_empty()) return JenovaMemoryTracker::DumpMemoryReport(AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + jenova::GlobalSettings::JenovaMemoryReportFile);
+		return JenovaMemoryTracker::DumpMemoryReport(AS_STD_STRING(reportFile));
+	}
+	NativePtr JenovaSDK::AllocateFrameMemory(size_t size, size_t alignment)
+	{
+		return JenovaArenaAllocator::AllocateFrameMemory(size, alignment);
+	}
+	NativePtr JenovaSDK::AllocateArenaMemory(ArenaID id, size_t size, size_t alignment)
+	{
+		return JenovaArenaAllocator::AllocateArenaMemory(id, size, alignment);
+	}
+	bool JenovaSDK::ResetArena(ArenaID id)
+	{
+		return JenovaArenaAllocator::ResetArena(id);
+	}
+	bool JenovaSDK::ReleaseArena(ArenaID id)
+	{
+		return JenovaArenaAllocator::ReleaseArena(id);
+	}
+	NativePtr JenovaSDK::AllocatePoolObject(size_t size)
+	{
+		return JenovaArenaAllocator::AllocatePoolObject(size);
+	}
+	void JenovaSDK::FreePoolObject(NativePtr ptr, size_t size)
+	{
+		JenovaArenaAllocator::FreePoolObject(ptr, size);
+	}
+	godot::Dictionary JenovaSDK::GetAllocatorReport()
+	{
+		return JenovaArenaAllocator::GetAllocatorReport();
 	}
 
 	// Global Variable Storage Utilities (Anzen)
 	godot::Variant JenovaSDK::GetGlobalVariable(VariableID id)
 	{
-		return globalVariables[id];
+		return JenovaGlobalStore::GetVariable(JenovaGlobalStore::FindGlobal(id));
 	}
 	void JenovaSDK::SetGlobalVariable(VariableID id, godot::Variant var)
 	{
-		globalVariables[id] = var;
+		JenovaGlobalStore::SetVariable(JenovaGlobalStore::RegisterGlobal(id), var);
 	}
 	void JenovaSDK::ClearGlobalVariables()
 	{
-		globalVariables.clear();
+		JenovaGlobalStore::ClearVariables();
+	}
+	GlobalHandle JenovaSDK::RegisterGlobal(const char* globalName)
+	{
+		return JenovaGlobalStore::RegisterGlobal(globalName);
+	}
+	NativePtr JenovaSDK::GetGlobalPointerByHandle(GlobalHandle handle)
+	{
+		return JenovaGlobalStore::GetPointer(handle);
+	}
+	NativePtr JenovaSDK::SetGlobalPointerByHandle(GlobalHandle handle, NativePtr ptr)
+	{
+		return JenovaGlobalStore::ExchangePointer(handle, ptr);
+	}
+	godot::Variant JenovaSDK::GetGlobalVariableByHandle(GlobalHandle handle)
+	{
+		return JenovaGlobalStore::GetVariable(handle);
+	}
+	void JenovaSDK::SetGlobalVariableByHandle(GlobalHandle handle, godot::Variant var)
+	{
+		JenovaGlobalStore::SetVariable(handle, var);
 	}
 
 	// Task System Utilities
@@ -696,6 +852,9 @@ namespace jenova
 		if (string(sdkFunctionName) == "GetNodeByPath") return FunctionPtr(&GetNodeByPath);
 		if (string(sdkFunctionName) == "FindNodeByName") return FunctionPtr(&FindNodeByName);
 		if (string(sdkFunctionName) == "GetNodeUniqueID") return FunctionPtr(&GetNodeUniqueID);
+		if (string(sdkFunctionName) == "GetNodeByUniqueID") return FunctionPtr(&GetNodeByUniqueID);
+		if (string(sdkFunctionName) == "FindNodesByName") return FunctionPtr(&FindNodesByName);
+		if (string(sdkFunctionName) == "FindNodesByClass") return FunctionPtr(&FindNodesByClass);
 		if (string(sdkFunctionName) == "GetTree") return FunctionPtr(&GetTree);
 		if (string(sdkFunctionName) == "GetTime") return FunctionPtr(&GetTime);
 		if (string(sdkFunctionName) == "Alert") return FunctionPtr(&Alert);
@@ -707,6 +866,9 @@ namespace jenova
 		if (string(sdkFunctionName) == "DebugOutputW") return FunctionPtr((void(*)(WideStringPtr, ...))(DebugOutput));
 		if (string(sdkFunctionName) == "GetCStr") return FunctionPtr(&GetCStr);
 		if (string(sdkFunctionName) == "GetWCStr") return FunctionPtr(&GetWCStr);
+		if (string(sdkFunctionName) == "GetTempCStr") return FunctionPtr(&GetTempCStr);
+		if (string(sdkFunctionName) == "GetTempWCStr") return FunctionPtr(&GetTempWCStr);
+		if (string(sdkFunctionName) == "GetBorrowedNodeUniqueID") return FunctionPtr(&GetBorrowedNodeUniqueID);
 		if (string(sdkFunctionName) == "SetClassIcon") return FunctionPtr(&SetClassIcon);
 		if (string(sdkFunctionName) == "MatchScaleFactor") return FunctionPtr(&MatchScaleFactor);
 		if (string(sdkFunctionName) == "CreateSignalCallback") return FunctionPtr(&CreateSignalCallback);
@@ -721,6 +883,8 @@ namespace jenova
 		if (string(sdkFunctionName) == "GetCheckpointTimeAndDispose") return FunctionPtr(&GetCheckpointTimeAndDispose);
 		if (string(sdkFunctionName) == "RegisterRuntimeCallback") return FunctionPtr(&RegisterRuntimeCallback);
 		if (string(sdkFunctionName) == "UnregisterRuntimeCallback") return FunctionPtr(&UnregisterRuntimeCallback);
+		if (string(sdkFunctionName) == "SetFrameBudget") return FunctionPtr(&SetFrameBudget);
+		if (string(sdkFunctionName) == "GetFrameTimingReport") return FunctionPtr(&GetFrameTimingReport);
 
 		// Solve Graphic Utilities Functions
 		if (string(sdkFunctionName) == "GetGameWindowHandle") return FunctionPtr(&GetGameWindowHandle);
@@ -739,11 +903,25 @@ namespace jenova
 		if (string(sdkFunctionName) == "DeleteGlobalPointer") return FunctionPtr(&DeleteGlobalPointer);
 		if (string(sdkFunctionName) == "AllocateGlobalMemory") return FunctionPtr(&AllocateGlobalMemory);
 		if (string(sdkFunctionName) == "FreeGlobalMemory") return FunctionPtr(&FreeGlobalMemory);
+		if (string(sdkFunctionName) == "GetMemoryReport") return FunctionPtr(&GetMemoryReport);
+		if (string(sdkFunctionName) == "DumpMemoryReport") return FunctionPtr(&DumpMemoryReport);
+		if (string(sdkFunctionName) == "AllocateFrameMemory") return FunctionPtr(&AllocateFrameMemory);
+		if (string(sdkFunctionName) == "AllocateArenaMemory") return FunctionPtr(&AllocateArenaMemory);
+		if (string(sdkFunctionName) == "ResetArena") return FunctionPtr(&ResetArena);
+		if (string(sdkFunctionName) == "ReleaseArena") return FunctionPtr(&ReleaseArena);
+		if (string(sdkFunctionName) == "AllocatePoolObject") return FunctionPtr(&AllocatePoolObject);
+		if (string(sdkFunctionName) == "FreePoolObject") return FunctionPtr(&FreePoolObject);
+		if (string(sdkFunctionName) == "GetAllocatorReport") return FunctionPtr(&GetAllocatorReport);
 
 		// Solve Global Variable Storage Utilities (Anzen) Functions
 		if (string(sdkFunctionName) == "GetGlobalVariable") return FunctionPtr(&GetGlobalVariable);
 		if (string(sdkFunctionName) == "SetGlobalVariable") return FunctionPtr(&SetGlobalVariable);
 		if (string(sdkFunctionName) == "ClearGlobalVariables") return FunctionPtr(&ClearGlobalVariables);
+		if (string(sdkFunctionName) == "RegisterGlobal") return FunctionPtr(&RegisterGlobal);
+		if (string(sdkFunctionName) == "GetGlobalPointerByHandle") return FunctionPtr(&GetGlobalPointerByHandle);
+		if (string(sdkFunctionName) == "SetGlobalPointerByHandle") return FunctionPtr(&SetGlobalPointerByHandle);
+		if (string(sdkFunctionName) == "GetGlobalVariableByHandle") return FunctionPtr(&GetGlobalVariableByHandle);
+		if (string(sdkFunctionName) == "SetGlobalVariableByHandle") return FunctionPtr(&SetGlobalVariableByHandle);
 
 		// Solve Task System Utilities Functions
 		if (string(sdkFunctionName) == "InitiateTask") return FunctionPtr(&InitiateTask);
@@ -769,12 +947,11 @@ namespace jenova
 	*/
 	void Output(sdk::StringPtr fmt, ...)
 	{
-		char buffer[1024];
 		va_list args;
 		va_start(args, fmt);
-		vsnprintf(buffer, sizeof(buffer), fmt, args);
+		godot::String message = godot::String(FormatToBuffer(fmt, args));
 		va_end(args);
-		godot::UtilityFunctions::print(godot::String("[JENOVA-SDK] > ") + godot::String(buffer));
+		godot::UtilityFunctions::print(godot::String("[JENOVA-SDK] > ") + message);
 	}
 	std::string ConvertToStdString(const godot::String& gstr)
 	{
@@ -0,0 +1,219 @@
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Log System Internal Storage
+namespace jenova::logging
+{
+    // Ring Capacity Must Be Power of Two
+    constexpr size_t RingCapacity = jenova::GlobalSettings::LogRingCapacity;
+    constexpr size_t RingMask = RingCapacity - 1;
+    static_assert((RingCapacity & RingMask) == 0, "Log Ring Capacity Must Be Power of Two.");
+
+    // Structures
+    struct LogRecord
+    {
+        std::atomic<size_t> sequence;
+        JenovaLogSystem::LogLevel logLevel;
+        int sourceID;
+        char* spilledMessage;
+        char message[jenova::GlobalSettings::LogRecordMessageSize];
+    };
+    enum class DrainState : uint8_t
+    {
+        Stopped,
+        Running,
+        ShutDown
+    };
+    struct LogRing
+    {
+        LogRing() { for (size_t i = 0; i < RingCapacity; i++) records[i].sequence.store(i, std::memory_order_relaxed); }
+        LogRecord records[RingCapacity];
+        alignas(64) std::atomic<size_t> enqueuePosition = 0;
+        alignas(64) std::atomic<size_t> dequeuePosition = 0;
+    };
+
+    // Log System State
+    static LogRing logRing;
+    static std::atomic<size_t> droppedRecords = 0;
+    static size_t reportedDroppedRecords = 0;
+    static std::atomic<DrainState> drainState = DrainState::Stopped;
+    static std::atomic<uint32_t> publishedRecords = 0;
+    static std::mutex drainThreadMutex;
+    static std::thread drainThread;
+    static std::mutex drainMutex;
+
+    // Utilities
+    static void GenerateSourceColor(int sourceID, char* colorHash, size_t colorHashSize)
+    {
+        // Generate A Unique Color based on id (Knuth's multiplicative hash, Mod 360 for HUE)
+        unsigned int hash = sourceID * 2654435761 % 360;
+
+        // Convert HUE to RGB [Saturation 80%, Brightness 90%]
+        float hue = static_cast<float>(hash);
+        float saturation = 0.8f;
+        float value = 0.9f;
+        int hi = static_cast<int>(hue / 60) % 6;
+        float f = hue / 60 - hi;
+        float p = value * (1 - saturation);
+        float q = value * (1 - f * saturation);
+        float t = value * (1 - (1 - f) * saturation);
+        float r = value, g = t, b = p;
+        switch (hi)
+        {
+            case 1: r = q; g = value; b = p; break;
+            case 2: r = p; g = value; b = t; break;
+            case 3: r = p; g = q; b = value; break;
+            case 4: r = t; g = p; b = value; break;
+            case 5: r = value; g = p; b = q; break;
+        }
+
+        // Convert RGB to Hex
+        snprintf(colorHash, colorHashSize, "#%02x%02x%02x", static_cast<int>(r * 255), static_cast<int>(g * 255), static_cast<int>(b * 255));
+    }
+}
+
+// Jenova Log System Implementation
+using namespace jenova::logging;
+void JenovaLogSystem::Record(LogLevel logLevel, int sourceID, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    RecordV(logLevel, sourceID, fmt, args);
+    va_end(args);
+}
+void JenovaLogSystem::RecordV(LogLevel logLevel, int sourceID, const char* fmt, va_list args)
+{
+    // Start Drain Thread On First Record
+    if (drainState.load(std::memory_order_acquire) == DrainState::Stopped) StartDrainThread();
+
+    // Claim Slot [Bounded Multi-Producer Ring]
+    size_t position = logRing.enqueuePosition.load(std::memory_order_relaxed);
+    LogRecord* logRecord = nullptr;
+    while (true)
+    {
+        logRecord = &logRing.records[position & RingMask];
+        intptr_t sequenceDelta = intptr_t(logRecord->sequence.load(std::memory_order_acquire)) - intptr_t(position);
+        if (sequenceDelta == 0)
+        {
+            if (logRing.enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        }
+        else if (sequenceDelta < 0)
+        {
+            droppedRecords.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        else position = logRing.enqueuePosition.load(std::memory_order_relaxed);
+    }
+
+    // Format Directly Into Slot, Oversized Messages Spill To Heap Instead of Being Cut
+    va_list spillArgs;
+    va_copy(spillArgs, args);
+    logRecord->logLevel = logLevel;
+    logRecord->sourceID = sourceID;
+    logRecord->spilledMessage = nullptr;
+    int messageLength = vsnprintf(logRecord->message, sizeof(logRecord->message), fmt, args);
+    if (messageLength >= int(sizeof(logRecord->message)))
+    {
+        logRecord->spilledMessage = static_cast<char*>(malloc(size_t(messageLength) + 1));
+        if (logRecord->spilledMessage) vsnprintf(logRecord->spilledMessage, size_t(messageLength) + 1, fmt, spillArgs);
+    }
+    va_end(spillArgs);
+
+    // Publish And Wake Drain Thread
+    logRecord->sequence.store(position + 1, std::memory_order_release);
+    publishedRecords.fetch_add(1, std::memory_order_release);
+    publishedRecords.notify_one();
+
+    // After Shutdown Records Are Emitted By Producer [Pairs With Fence In Shutdown]
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (drainState.load(std::memory_order_relaxed) == DrainState::ShutDown) Flush();
+}
+void JenovaLogSystem::Flush()
+{
+    // Emit Only Records Claimed Before This Call, Nothing Pending Means No Lock Is Taken
+    size_t flushPosition = logRing.enqueuePosition.load(std::memory_order_acquire);
+    while (logRing.dequeuePosition.load(std::memory_order_acquire) < flushPosition && DrainRecords(flushPosition));
+}
+void JenovaLogSystem::Shutdown()
+{
+    // Stop Drain Thread And Emit Remaining Records, Later Records Are Emitted Synchronously
+    {
+        std::lock_guard<std::mutex> threadLock(drainThreadMutex);
+        drainState.store(DrainState::ShutDown, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        publishedRecords.fetch_add(1, std::memory_order_release);
+        publishedRecords.notify_all();
+        if (drainThread.joinable()) drainThread.join();
+    }
+    Flush();
+}
+size_t JenovaLogSystem::GetDroppedRecordCount()
+{
+    return droppedRecords.load(std::memory_order_relaxed);
+}
+void JenovaLogSystem::StartDrainThread()
+{
+    std::lock_guard<std::mutex> threadLock(drainThreadMutex);
+    if (drainState.load(std::memory_order_relaxed) != DrainState::Stopped) return;
+    drainState.store(DrainState::Running, std::memory_order_release);
+    drainThread = std::thread(&JenovaLogSystem::DrainThread);
+}
+void JenovaLogSystem::DrainThread()
+{
+    // Sleep Until A Record Is Published, Counter Taken Before Draining So No Wake Is Lost
+    while (drainState.load(std::memory_order_acquire) == DrainState::Running)
+    {
+        uint32_t observedRecords = publishedRecords.load(std::memory_order_acquire);
+        if (!DrainRecords(std::numeric_limits<size_t>::max())) publishedRecords.wait(observedRecords, std::memory_order_acquire);
+    }
+}
+bool JenovaLogSystem::DrainRecords(size_t drainPosition)
+{
+    // Single Consumer At A Time [Drain Thread Or Flushing Caller], Lock Is Held Per Record So Flush Waits For One Emit At Most
+    bool hasDrained = false;
+    while (true)
+    {
+        std::lock_guard<std::mutex> lock(drainMutex);
+        size_t position = logRing.dequeuePosition.load(std::memory_order_relaxed);
+        if (position >= drainPosition) break;
+        LogRecord& logRecord = logRing.records[position & RingMask];
+        if (logRecord.sequence.load(std::memory_order_acquire) != position + 1) break;
+
+        // Emit Record
+        const char* recordMessage = logRecord.spilledMessage ? logRecord.spilledMessage : logRecord.message;
+        if (logRecord.logLevel == LogLevel::VerboseByID)
+        {
+            char colorHash[8];
+            GenerateSourceColor(logRecord.sourceID, colorHash, sizeof(colorHash));
+            jenova::EmitVerbose(colorHash, recordMessage);
+        }
+        else jenova::EmitVerbose(nullptr, recordMessage);
+        if (logRecord.spilledMessage) free(logRecord.spilledMessage);
+        logRecord.spilledMessage = nullptr;
+
+        // Release Slot
+        logRecord.sequence.store(position + RingCapacity, std::memory_order_release);
+        logRing.dequeuePosition.store(position + 1, std::memory_order_release);
+        hasDrained = true;
+    }
+
+    // Report Dropped Records
+    std::lock_guard<std::mutex> lock(drainMutex);
+    size_t droppedCount = droppedRecords.load(std::memory_order_relaxed) - reportedDroppedRecords;
+    reportedDroppedRecords += droppedCount;
+    if (droppedCount != 0) jenova::EmitVerbose(nullptr, jenova::Format("%zu Log Records Dropped, Log Ring Was Full.", droppedCount).c_str());
+    return hasDrained;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Log Levels [Compile-Time Filter, Override JENOVA_LOG_LEVEL From Build Flags]
+#define JENOVA_LOG_LEVEL_NONE       0
+#define JENOVA_LOG_LEVEL_VERBOSE    1
+#ifndef JENOVA_LOG_LEVEL
+#define JENOVA_LOG_LEVEL            JENOVA_LOG_LEVEL_VERBOSE
+#endif
+
+// Jenova Log Macros [Arguments Are Only Evaluated When Verbose Logging Is Active]
+#if JENOVA_LOG_LEVEL >= JENOVA_LOG_LEVEL_VERBOSE
+#define JENOVA_VERBOSE(...) do { if (JenovaLogSystem::IsVerboseEnabled()) JenovaLogSystem::Record(JenovaLogSystem::LogLevel::Verbose, 0, __VA_ARGS__); } while (0)
+#define JENOVA_VERBOSE_BY_ID(sourceID, ...) do { if (JenovaLogSystem::IsVerboseEnabled()) JenovaLogSystem::Record(JenovaLogSystem::LogLevel::VerboseByID, sourceID, __VA_ARGS__); } while (0)
+#else
+#define JENOVA_VERBOSE(...) do {} while (0)
+#define JENOVA_VERBOSE_BY_ID(sourceID, ...) do {} while (0)
+#endif
+
+// Jenova Log System Definition
+/*
+    Log Records Are Formatted Directly Into Slots Of A Bounded Lock-Free Multi-Producer Ring,
+    A Background Thread Woken On Publish Drains Them To The Jenova Terminal Or Standard Output.
+    Producers Never Lock Or Wait, When The Ring Is Full Records Are Dropped And Counted.
+    Messages Longer Than A Slot Spill To Heap, Synchronous Output First Emits Records Claimed Before It To Keep Order,
+    Returning Without Locking When None Are Pending.
+    After Shutdown Records Are Emitted Synchronously By The Producer.
+*/
+class JenovaLogSystem
+{
+public:
+    enum class LogLevel : uint8_t
+    {
+        Verbose,
+        VerboseByID
+    };
+
+public:
+    static inline bool IsVerboseEnabled()
+    {
+        return jenova::GlobalStorage::DeveloperModeActivated && jenova::GlobalStorage::CurrentEditorVerboseOutput != jenova::EditorVerboseOutput::Disabled;
+    }
+    static void Record(LogLevel logLevel, int sourceID, const char* fmt, ...);
+    static void RecordV(LogLevel logLevel, int sourceID, const char* fmt, va_list args);
+    static void Flush();
+    static void Shutdown();
+    static size_t GetDroppedRecordCount();
+
+private:
+    static void StartDrainThread();
+    static void DrainThread();
+    static bool DrainRecords(size_t drainPosition);
+};
@@ -0,0 +1,163 @@
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Memory Tracker Internal Storage
+namespace jenova::memory
+{
+    // Tag Count
+    constexpr size_t TagCount = size_t(jenova::MemoryTag::TagCount);
+
+    // Tag Names [Must Match jenova::MemoryTag]
+    static constexpr const char* TagNames[TagCount] =
+    {
+        "ScriptProperties",
+        "GlobalMemory",
+        "SDKStrings",
+        "ModuleImages",
+        "JITCode",
+        "BuildBuffers",
+        "FrameArena",
+        "NamedArenas",
+        "ObjectPools"
+    };
+
+    // Structures
+    struct TagCounters
+    {
+        alignas(64) std::atomic<int64_t> currentBytes = 0;
+        std::atomic<int64_t> peakBytes = 0;
+        std::atomic<uint64_t> allocationCount = 0;
+        std::atomic<uint64_t> releaseCount = 0;
+    };
+
+    // Tracker State
+    static TagCounters tagCounters[TagCount];
+    static std::mutex trackedPointersMutex;
+    static std::unordered_map<const void*, size_t> trackedPointers[TagCount];
+
+    // Utilities
+    static std::string FormatByteSize(int64_t byteSize)
+    {
+        double absoluteSize = double(byteSize < 0 ? -byteSize : byteSize);
+        if (absoluteSize >= 1024.0 * 1024.0 * 1024.0) return jenova::Format("%.2f GB", double(byteSize) / (1024.0 * 1024.0 * 1024.0));
+        if (absoluteSize >= 1024.0 * 1024.0) return jenova::Format("%.2f MB", double(byteSize) / (1024.0 * 1024.0));
+        if (absoluteSize >= 1024.0) return jenova::Format("%.2f KB", double(byteSize) / 1024.0);
+        return jenova::Format("%lld B", (long long)byteSize);
+    }
+}
+
+// Jenova Memory Tracker Implementation
+using namespace jenova::memory;
+void JenovaMemoryTracker::TrackAllocation(jenova::MemoryTag memoryTag, size_t memorySize)
+{
+    if (memoryTag >= jenova::MemoryTag::TagCount) return;
+    TagCounters& counters = tagCounters[size_t(memoryTag)];
+    counters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+    int64_t currentBytes = counters.currentBytes.fetch_add(int64_t(memorySize), std::memory_order_relaxed) + int64_t(memorySize);
+
+    // Raise Peak [Lock-Free Maximum]
+    int64_t peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    while (currentBytes > peakBytes && !counters.peakBytes.compare_exchange_weak(peakBytes, currentBytes, std::memory_order_relaxed));
+}
+void JenovaMemoryTracker::TrackRelease(jenova::MemoryTag memoryTag, size_t memorySize)
+{
+    if (memoryTag >= jenova::MemoryTag::TagCount) return;
+    TagCounters& counters = tagCounters[size_t(memoryTag)];
+    counters.releaseCount.fetch_add(1, std::memory_order_relaxed);
+    counters.currentBytes.fetch_sub(int64_t(memorySize), std::memory_order_relaxed);
+}
+void JenovaMemoryTracker::TrackPointer(jenova::MemoryTag memoryTag, const void* memoryPtr, size_t memorySize)
+{
+    if (!memoryPtr || memoryTag >= jenova::MemoryTag::TagCount) return;
+    {
+        // Same Pointer Tracked Twice Is Counted Once [Shared Module Handles]
+        std::lock_guard<std::mutex> lock(trackedPointersMutex);
+        if (!trackedPointers[size_t(memoryTag)].emplace(memoryPtr, memorySize).second) return;
+    }
+    TrackAllocation(memoryTag, memorySize);
+}
+void JenovaMemoryTracker::UntrackPointer(jenova::MemoryTag memoryTag, const void* memoryPtr)
+{
+    if (!memoryPtr || memoryTag >= jenova::MemoryTag::TagCount) return;
+    size_t memorySize = 0;
+    {
+        std::lock_guard<std::mutex> lock(trackedPointersMutex);
+        auto trackedPointer = trackedPointers[size_t(memoryTag)].find(memoryPtr);
+        if (trackedPointer == trackedPointers[size_t(memoryTag)].end()) return;
+        memorySize = trackedPointer->second;
+        trackedPointers[size_t(memoryTag)].erase(trackedPointer);
+    }
+    TrackRelease(memoryTag, memorySize);
+}
+JenovaMemoryTracker::TagStatistics JenovaMemoryTracker::GetTagStatistics(jenova::MemoryTag memoryTag)
+{
+    TagStatistics tagStatistics;
+    if (memoryTag >= jenova::MemoryTag::TagCount) return tagStatistics;
+    const TagCounters& counters = tagCounters[size_t(memoryTag)];
+    tagStatistics.currentBytes = counters.currentBytes.load(std::memory_order_relaxed);
+    tagStatistics.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    tagStatistics.allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+    tagStatistics.releaseCount = counters.releaseCount.load(std::memory_order_relaxed);
+    return tagStatistics;
+}
+const char* JenovaMemoryTracker::GetTagName(jenova::MemoryTag memoryTag)
+{
+    if (memoryTag >= jenova::MemoryTag::TagCount) return "Unknown";
+    return TagNames[size_t(memoryTag)];
+}
+Dictionary JenovaMemoryTracker::GetMemoryReport()
+{
+    Dictionary memoryReport;
+    int64_t totalCurrentBytes = 0;
+    for (size_t i = 0; i < TagCount; i++)
+    {
+        TagStatistics tagStatistics = GetTagStatistics(jenova::MemoryTag(i));
+        Dictionary tagReport;
+        tagReport["Current"] = tagStatistics.currentBytes;
+        tagReport["Peak"] = tagStatistics.peakBytes;
+        tagReport["Allocations"] = int64_t(tagStatistics.allocationCount);
+        tagReport["Releases"] = int64_t(tagStatistics.releaseCount);
+        tagReport["Live"] = int64_t(tagStatistics.allocationCount - tagStatistics.releaseCount);
+        memoryReport[TagNames[i]] = tagReport;
+        totalCurrentBytes += tagStatistics.currentBytes;
+    }
+    memoryReport["TotalCurrent"] = totalCurrentBytes;
+    return memoryReport;
+}
+std::string JenovaMemoryTracker::CreateMemoryReport()
+{
+    std::string memoryReport = "Jenova Runtime Memory Report\n\n";
+    memoryReport += jenova::Format("%-18s %14s %14s %14s %14s\n", "Tag", "Current", "Peak", "Allocations", "Live");
+    int64_t totalCurrentBytes = 0;
+    for (size_t i = 0; i < TagCount; i++)
+    {
+        TagStatistics tagStatistics = GetTagStatistics(jenova::MemoryTag(i));
+        memoryReport += jenova::Format("%-18s %14s %14s %14llu %14llu\n", TagNames[i], FormatByteSize(tagStatistics.currentBytes).c_str(), FormatByteSize(tagStatistics.peakBytes).c_str(),
+            (unsigned long long)tagStatistics.allocationCount, (unsigned long long)(tagStatistics.allocationCount - tagStatistics.releaseCount));
+        totalCurrentBytes += tagStatistics.currentBytes;
+    }
+    memoryReport += jenova::Format("%-18s %14s\n", "Total", FormatByteSize(totalCurrentBytes).c_str());
+    return memoryReport;
+}
+bool JenovaMemoryTracker::DumpMemoryReport(const std::string& reportFilePath)
+{
+    if (!jenova::WriteStdStringToFile(reportFilePath, CreateMemoryReport()))
+    {
+        jenova::Error("Jenova Memory Tracker", "Failed to Write Memory Report to %s", reportFilePath.c_str());
+        return false;
+    }
+    return true;
+}
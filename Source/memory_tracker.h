@@ -0,0 +1,47 @@
+#pragma once
+
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Memory Tracker Definition
+/*
+    Accounts Runtime Owned Memory By Subsystem Tag With Current, Peak And Allocation Count Values.
+    Sized Tracking Uses Relaxed Atomics Only, Pointer Tracking Remembers Sizes For Allocations Released Without One
+    (Script Properties, SDK Global Memory, Module Images). SDK Strings Count Caller Owned Copies (Never Released Here) Plus Capacity Of Per-Thread Temporary Rings.
+*/
+class JenovaMemoryTracker
+{
+public:
+    // Tracker Structures
+    struct TagStatistics
+    {
+        int64_t currentBytes = 0;
+        int64_t peakBytes = 0;
+        uint64_t allocationCount = 0;
+        uint64_t releaseCount = 0;
+    };
+
+public:
+    static void TrackAllocation(jenova::MemoryTag memoryTag, size_t memorySize);
+    static void TrackRelease(jenova::MemoryTag memoryTag, size_t memorySize);
+    static void TrackPointer(jenova::MemoryTag memoryTag, const void* memoryPtr, size_t memorySize);
+    static void UntrackPointer(jenova::MemoryTag memoryTag, const void* memoryPtr);
+    static TagStatistics GetTagStatistics(jenova::MemoryTag memoryTag);
+    static const char* GetTagName(jenova::MemoryTag memoryTag);
+    static Dictionary GetMemoryReport();
+    static std::string CreateMemoryReport();
+    static bool DumpMemoryReport(const std::string& reportFilePath);
+};
@@ -36,6 +36,7 @@ constexpr const char* packageDatabaseFileURL = "/Jenova-Framework/Jenova-Package
 // Storages
 static jenova::PackageList onlinePackages;
 static jenova::PackageList installedPackages;
+static JenovaBuildService::FileStamp installedPackagesStamp;
 
 // Singleton Instance
 JenovaPackageManager* jnvpm_singleton = nullptr;
@@ -57,6 +58,7 @@ void JenovaPackageManager::deinit()
 	// Release Packages
 	onlinePackages.clear();
 	installedPackages.clear();
+	installedPackagesStamp = JenovaBuildService::FileStamp();
 
     // Release Singleton
     if (jnvpm_singleton) memdelete(jnvpm_singleton);
@@ -582,7 +584,7 @@ bool JenovaPackageManager::FetchOnlinePackages(const String& packageDatabaseURL)
 	onlinePackages.clear();
 
 	// Verbose
-	jenova::VerboseByID(__LINE__, "Downloading [%s%s]", AS_C_STRING(packageDatabaseURL), packageDatabaseFileURL);
+	JENOVA_VERBOSE_BY_ID(__LINE__, "Downloading [%s%s]", AS_C_STRING(packageDatabaseURL), packageDatabaseFileURL);
 
 	// Initialize cURL
 	CURL* curl = curl_easy_init();
@@ -654,21 +656,26 @@ bool JenovaPackageManager::FetchOnlinePackages(const String& packageDatabaseURL)
 	}
 	catch (const std::exception& e) 
 	{
-		jenova::VerboseByID(__LINE__, "JSON Parsing failed: %s", e.what());
+		JENOVA_VERBOSE_BY_ID(__LINE__, "JSON Parsing failed: %s", e.what());
 		return false;
 	}
 }
 bool JenovaPackageManager::ObtainInstalledPackages()
 {
-	// Clear Current List
-	installedPackages.clear();
-
 	// Create Installed Package File Path
 	String projectPath = jenova::GetJenovaProjectDirectory();
 	String installedPackageFile = projectPath + "Jenova/" + jenova::GlobalSettings::JenovaInstalledPackagesFile;
 
+	// Skip Parsing When Build Service Has Seen This Exact File Before
+	JenovaBuildService::FileStamp packageFileStamp = JenovaBuildService::GetFileStamp(AS_STD_STRING(installedPackageFile));
+	if (JenovaBuildService::IsActive() && JenovaBuildService::IsSettledStamp(packageFileStamp) && packageFileStamp == installedPackagesStamp) return true;
+	installedPackagesStamp = JenovaBuildService::FileStamp();
+
+	// Clear Current List
+	installedPackages.clear();
+
 	// Validate Package Database File
-	if (!std::filesystem::exists(AS_STD_STRING(installedPackageFile)))
+	if (!packageFileStamp.fileExists)
 	{
 		if (!CacheInstalledPackages()) return false;
 	}
@@ -703,6 +710,9 @@ bool JenovaPackageManager::ObtainInstalledPackages()
 			installedPackages.push_back(newPackage);
 		}
 
+		// Remember Parsed File
+		installedPackagesStamp = packageFileStamp;
+
 		// All Good
 		return true;
 	}
@@ -717,6 +727,9 @@ bool JenovaPackageManager::ObtainInstalledPackages()
 }
 bool JenovaPackageManager::CacheInstalledPackages()
 {
+	// List Changed In Memory, Next Obtain Parses Again
+	installedPackagesStamp = JenovaBuildService::FileStamp();
+
 	// Create Installed Package File Path
 	String projectPath = jenova::GetJenovaProjectDirectory();
 	String installedPackageFile = projectPath + "Jenova/" + jenova::GlobalSettings::JenovaInstalledPackagesFile;
@@ -1005,7 +1018,7 @@ bool JenovaPackageManager::InstallPackage(const String& packageHash)
 	}
 
 	// Verbose
-	jenova::VerboseByID(__LINE__, "Downloading Package from [%s] to [%s]", AS_C_STRING(packageFileURL), AS_C_STRING(downloadFilePath));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "Downloading Package from [%s] to [%s]", AS_C_STRING(packageFileURL), AS_C_STRING(downloadFilePath));
 
 	// Download Package
 	FormatStatus("#eb3458", "Downloading Package %s...", AS_C_STRING(package.pkgName));
@@ -0,0 +1,724 @@
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Sampling SDK
+#ifdef TARGET_PLATFORM_LINUX
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <ucontext.h>
+#include <elf.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif
+
+// Imports
+using ModuleSymbol = JenovaSamplingProfiler::ModuleSymbol;
+using FoldedStacks = JenovaSamplingProfiler::FoldedStacks;
+
+// Jenova Sampling Profiler Internal Storage
+namespace jenova::sampling
+{
+    // Ring Capacity Must Be Power of Two
+    constexpr size_t MaxStackDepth = jenova::GlobalSettings::SamplingProfilerMaxStackDepth;
+    constexpr size_t RingCapacity = jenova::GlobalSettings::SamplingProfilerRingCapacity;
+    constexpr size_t RingMask = RingCapacity - 1;
+    constexpr size_t MaxThreads = jenova::GlobalSettings::SamplingProfilerMaxThreads;
+    static_assert((RingCapacity & RingMask) == 0, "Sampling Profiler Ring Capacity Must Be Power of Two.");
+
+    // Structures
+    struct StackSample
+    {
+        uint32_t frameCount;
+        uintptr_t frames[MaxStackDepth];
+    };
+    struct SampledThread
+    {
+        bool isRegistered = false;
+        std::string threadName;
+        size_t threadNameIndex = 0;
+        #ifdef TARGET_PLATFORM_LINUX
+        pthread_t threadHandle;
+        pid_t threadID = 0;
+        timer_t samplingTimer;
+        #endif
+        bool hasTimer = false;
+        uintptr_t stackLow = 0;
+        uintptr_t stackHigh = 0;
+        StackSample* samples = nullptr;
+        std::atomic<size_t> writePosition = 0;
+        std::atomic<size_t> readPosition = 0;
+    };
+    struct StackHasher
+    {
+        size_t operator()(const std::vector<uintptr_t>& stackFrames) const
+        {
+            size_t stackHash = 14695981039346656037ULL;
+            for (uintptr_t frameAddress : stackFrames) stackHash = (stackHash ^ frameAddress) * 1099511628211ULL;
+            return stackHash;
+        }
+    };
+
+    // Sampler State [First Frame Of Each Aggregated Stack Is The Thread Name Index]
+    static SampledThread sampledThreads[MaxThreads];
+    static std::vector<std::string> threadNames;
+    static thread_local SampledThread* currentSampledThread = nullptr;
+    static std::mutex samplerMutex;
+    static std::atomic<bool> isSampling = false;
+    static std::atomic<size_t> droppedSamples = 0;
+    static bool isHandlerInstalled = false;
+    static std::unordered_map<std::vector<uintptr_t>, uint64_t, StackHasher> aggregatedStacks;
+    static FoldedStacks foldedStacks;
+
+    // Module Symbols [Sorted By Start Address]
+    static std::vector<ModuleSymbol> moduleSymbols;
+    static uintptr_t moduleStartAddress = 0;
+    static uintptr_t moduleEndAddress = 0;
+
+    // Utilities
+    static void DrainThreadSamples(size_t threadSlot)
+    {
+        SampledThread& sampledThread = sampledThreads[threadSlot];
+        if (!sampledThread.samples) return;
+        size_t readPosition = sampledThread.readPosition.load(std::memory_order_relaxed);
+        size_t writePosition = sampledThread.writePosition.load(std::memory_order_acquire);
+        std::vector<uintptr_t> stackKey;
+        for (; readPosition != writePosition; readPosition++)
+        {
+            const StackSample& stackSample = sampledThread.samples[readPosition & RingMask];
+            stackKey.assign(1, uintptr_t(sampledThread.threadNameIndex));
+            stackKey.insert(stackKey.end(), stackSample.frames, stackSample.frames + stackSample.frameCount);
+            aggregatedStacks[stackKey]++;
+        }
+        sampledThread.readPosition.store(readPosition, std::memory_order_release);
+    }
+    static std::string SanitizeFrameName(std::string frameName)
+    {
+        // Semicolons Separate Frames In Folded Stacks
+        std::replace(frameName.begin(), frameName.end(), ';', ':');
+        std::replace(frameName.begin(), frameName.end(), '\n', ' ');
+        return frameName;
+    }
+    static std::string EscapeMarkup(const std::string& text)
+    {
+        std::string escapedText;
+        escapedText.reserve(text.size());
+        for (char character : text)
+        {
+            switch (character)
+            {
+                case '&': escapedText += "&amp;"; break;
+                case '<': escapedText += "&lt;"; break;
+                case '>': escapedText += "&gt;"; break;
+                case '"': escapedText += "&quot;"; break;
+                default: escapedText += character; break;
+            }
+        }
+        return escapedText;
+    }
+
+    #ifdef TARGET_PLATFORM_LINUX
+    static std::string DemangleSymbol(const char* symbolName)
+    {
+        int status = 0;
+        char* demangledName = abi::__cxa_demangle(symbolName, nullptr, nullptr, &status);
+        if (status != 0 || !demangledName) return std::string(symbolName);
+        std::string result(demangledName);
+        free(demangledName);
+        return result;
+    }
+    static uint32_t UnwindFramePointers(void* signalContext, const SampledThread& sampledThread, uintptr_t* stackFrames)
+    {
+        // Read Program Counter And Frame Pointer From Interrupted Context
+        const ucontext_t* threadContext = static_cast<const ucontext_t*>(signalContext);
+        #if defined(__x86_64__)
+        uintptr_t programCounter = uintptr_t(threadContext->uc_mcontext.gregs[REG_RIP]);
+        uintptr_t framePointer = uintptr_t(threadContext->uc_mcontext.gregs[REG_RBP]);
+        #elif defined(__aarch64__)
+        uintptr_t programCounter = uintptr_t(threadContext->uc_mcontext.pc);
+        uintptr_t framePointer = uintptr_t(threadContext->uc_mcontext.regs[29]);
+        #else
+        return 0;
+        #endif
+
+        // Walk Frame Chain Within Thread Stack Bounds [Return Addresses Point Back Into Call Instruction]
+        uint32_t frameCount = 0;
+        stackFrames[frameCount++] = programCounter;
+        while (frameCount < MaxStackDepth)
+        {
+            if (framePointer < sampledThread.stackLow || framePointer + 2 * sizeof(uintptr_t) > sampledThread.stackHigh) break;
+            if (framePointer & (sizeof(uintptr_t) - 1)) break;
+            const uintptr_t* stackFrame = reinterpret_cast<const uintptr_t*>(framePointer);
+            uintptr_t returnAddress = stackFrame[1];
+            uintptr_t nextFramePointer = stackFrame[0];
+            if (returnAddress == 0) break;
+            stackFrames[frameCount++] = returnAddress - 1;
+            if (nextFramePointer <= framePointer) break;
+            framePointer = nextFramePointer;
+        }
+        return frameCount;
+    }
+    static void SamplingSignalHandler(int signalNumber, siginfo_t* signalInfo, void* signalContext)
+    {
+        // Only Async-Signal-Safe Work Here, Slot And Ring Are Preallocated By Registering Thread
+        int savedErrno = errno;
+        SampledThread* sampledThread = currentSampledThread;
+        if (sampledThread && sampledThread->samples && isSampling.load(std::memory_order_relaxed))
+        {
+            size_t writePosition = sampledThread->writePosition.load(std::memory_order_relaxed);
+            if (writePosition - sampledThread->readPosition.load(std::memory_order_acquire) >= RingCapacity)
+            {
+                droppedSamples.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                StackSample& stackSample = sampledThread->samples[writePosition & RingMask];
+                stackSample.frameCount = UnwindFramePointers(signalContext, *sampledThread, stackSample.frames);
+                sampledThread->writePosition.store(writePosition + 1, std::memory_order_release);
+            }
+        }
+        errno = savedErrno;
+    }
+    static bool InstallSignalHandler()
+    {
+        // Handler Stays Installed Once Set, Default SIGPROF Action Would Terminate On A Late Pending Signal
+        if (isHandlerInstalled) return true;
+        struct sigaction signalAction = {};
+        signalAction.sa_sigaction = &SamplingSignalHandler;
+        signalAction.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&signalAction.sa_mask);
+        if (sigaction(SIGPROF, &signalAction, nullptr) != 0) return false;
+        isHandlerInstalled = true;
+        return true;
+    }
+    static bool CreateThreadTimer(SampledThread& sampledThread)
+    {
+        // Allocate Sample Ring
+        if (sampledThread.hasTimer) return true;
+        if (!sampledThread.samples) sampledThread.samples = new (std::nothrow) StackSample[RingCapacity];
+        if (!sampledThread.samples) return false;
+
+        // Create Timer On Thread CPU Clock Delivering SIGPROF To That Thread Only
+        clockid_t threadClock;
+        if (pthread_getcpuclockid(sampledThread.threadHandle, &threadClock) != 0) return false;
+        struct sigevent signalEvent = {};
+        signalEvent.sigev_notify = SIGEV_THREAD_ID;
+        signalEvent.sigev_signo = SIGPROF;
+        signalEvent.sigev_notify_thread_id = sampledThread.threadID;
+        if (timer_create(threadClock, &signalEvent, &sampledThread.samplingTimer) != 0) return false;
+
+        // Arm Timer
+        struct itimerspec timerSpec = {};
+        timerSpec.it_interval.tv_nsec = long(1000000000 / jenova::GlobalSettings::SamplingProfilerFrequency);
+        timerSpec.it_value = timerSpec.it_interval;
+        if (timer_settime(sampledThread.samplingTimer, 0, &timerSpec, nullptr) != 0)
+        {
+            timer_delete(sampledThread.samplingTimer);
+            return false;
+        }
+        sampledThread.hasTimer = true;
+        return true;
+    }
+    static void DestroyThreadTimer(SampledThread& sampledThread)
+    {
+        if (!sampledThread.hasTimer) return;
+        timer_delete(sampledThread.samplingTimer);
+        sampledThread.hasTimer = false;
+    }
+    #endif
+}
+
+// Jenova Sampling Profiler Implementation
+using namespace jenova::sampling;
+bool JenovaSamplingProfiler::RegisterThread(const char* threadName)
+{
+    #ifdef TARGET_PLATFORM_LINUX
+    // Already Registered
+    if (currentSampledThread) return true;
+
+    // Find Free Slot
+    std::lock_guard<std::mutex> lock(samplerMutex);
+    for (size_t threadSlot = 0; threadSlot < MaxThreads; threadSlot++)
+    {
+        SampledThread& sampledThread = sampledThreads[threadSlot];
+        if (sampledThread.isRegistered) continue;
+
+        // Collect Thread Information And Stack Bounds For Unwinding
+        sampledThread.threadName = threadName;
+        auto threadNameIterator = std::find(threadNames.begin(), threadNames.end(), sampledThread.threadName);
+        sampledThread.threadNameIndex = size_t(threadNameIterator - threadNames.begin());
+        if (threadNameIterator == threadNames.end()) threadNames.push_back(sampledThread.threadName);
+        sampledThread.threadHandle = pthread_self();
+        sampledThread.threadID = pid_t(syscall(SYS_gettid));
+        pthread_attr_t threadAttributes;
+        if (pthread_getattr_np(sampledThread.threadHandle, &threadAttributes) == 0)
+        {
+            void* stackAddress = nullptr;
+            size_t stackSize = 0;
+            pthread_attr_getstack(&threadAttributes, &stackAddress, &stackSize);
+            sampledThread.stackLow = uintptr_t(stackAddress);
+            sampledThread.stackHigh = uintptr_t(stackAddress) + stackSize;
+            pthread_attr_destroy(&threadAttributes);
+        }
+        sampledThread.isRegistered = true;
+
+        // Touching Thread Local Here Ensures Signal Handler Never Allocates TLS
+        currentSampledThread = &sampledThread;
+
+        // Join Active Sampling Session
+        if (isSampling.load(std::memory_order_acquire)) CreateThreadTimer(sampledThread);
+        return true;
+    }
+    #endif
+
+    // No Free Slot Or Unsupported Platform
+    return false;
+}
+void JenovaSamplingProfiler::UnregisterThread()
+{
+    #ifdef TARGET_PLATFORM_LINUX
+    if (!currentSampledThread) return;
+    std::lock_guard<std::mutex> lock(samplerMutex);
+
+    // Detach Thread From Handler Before Releasing Its Ring
+    SampledThread* sampledThread = currentSampledThread;
+    currentSampledThread = nullptr;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    DestroyThreadTimer(*sampledThread);
+
+    // Keep Collected Samples And Release Slot
+    if (isSampling.load(std::memory_order_acquire)) DrainThreadSamples(size_t(sampledThread - sampledThreads));
+    delete[] sampledThread->samples;
+    sampledThread->samples = nullptr;
+    sampledThread->readPosition.store(0, std::memory_order_relaxed);
+    sampledThread->writePosition.store(0, std::memory_order_relaxed);
+    sampledThread->isRegistered = false;
+    #endif
+}
+bool JenovaSamplingProfiler::AttachModule(const uint8_t* moduleDataPtr, size_t moduleSize, jenova::ModuleAddress moduleBaseAddress, const jenova::json_t& moduleMetaData)
+{
+    #ifdef TARGET_PLATFORM_LINUX
+    // Load Symbols For New Module Generation
+    std::lock_guard<std::mutex> lock(samplerMutex);
+    if (isSampling.load(std::memory_order_acquire)) return false;
+    moduleStartAddress = uintptr_t(moduleBaseAddress);
+    if (!CollectModuleSymbols(moduleDataPtr, moduleSize, moduleBaseAddress, moduleMetaData, moduleSymbols, moduleEndAddress))
+    {
+        jenova::Warning("Jenova Sampling Profiler", "Failed to Load Module Symbols, Module Frames Will Not Be Symbolized.");
+    }
+
+    // Start Sampling Registered Threads
+    if (!StartSampling())
+    {
+        jenova::Error("Jenova Sampling Profiler", "Failed to Start Native Sampling.");
+        return false;
+    }
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Native Sampling Started At %zu Hz With %zu Module Symbols.", size_t(jenova::GlobalSettings::SamplingProfilerFrequency), moduleSymbols.size());
+    return true;
+    #else
+    jenova::Warning("Jenova Sampling Profiler", "Native Sampling Profiler Is Only Supported On Linux.");
+    return false;
+    #endif
+}
+bool JenovaSamplingProfiler::DetachModule(const std::string& outputDirectory)
+{
+    // Stop Sampling While Module Symbols Are Still Valid
+    std::lock_guard<std::mutex> lock(samplerMutex);
+    if (!isSampling.load(std::memory_order_acquire)) return false;
+    StopSampling();
+
+    // Symbolize Aggregated Stacks Into Folded Stacks [Root First, Accumulated Across Generations]
+    std::unordered_map<uintptr_t, std::string> symbolCache;
+    for (const auto& aggregatedStack : aggregatedStacks)
+    {
+        const std::vector<uintptr_t>& stackFrames = aggregatedStack.first;
+        std::string foldedStack = SanitizeFrameName(threadNames[stackFrames[0]]);
+        for (size_t frameIndex = stackFrames.size() - 1; frameIndex >= 1; frameIndex--)
+        {
+            auto cachedSymbol = symbolCache.find(stackFrames[frameIndex]);
+            if (cachedSymbol == symbolCache.end()) cachedSymbol = symbolCache.emplace(stackFrames[frameIndex], SanitizeFrameName(SymbolizeAddress(stackFrames[frameIndex]))).first;
+            foldedStack += ";" + cachedSymbol->second;
+        }
+        foldedStacks[foldedStack] += aggregatedStack.second;
+    }
+    aggregatedStacks.clear();
+    moduleSymbols.clear();
+    if (GetDroppedSampleCount() != 0) JENOVA_VERBOSE_BY_ID(__LINE__, "Native Sampling Dropped %zu Samples, Consider Lowering Sampling Frequency.", GetDroppedSampleCount());
+    moduleStartAddress = moduleEndAddress = 0;
+
+    // Write Results
+    if (foldedStacks.empty()) return false;
+    std::string foldedFilePath = outputDirectory + jenova::GlobalSettings::JenovaNativeProfileFoldedFile;
+    std::string flameGraphFilePath = outputDirectory + jenova::GlobalSettings::JenovaNativeProfileFlameGraphFile;
+    if (!WriteFoldedStacks(foldedFilePath, foldedStacks) || !WriteFlameGraph(flameGraphFilePath, foldedStacks))
+    {
+        jenova::Error("Jenova Sampling Profiler", "Failed to Write Native Profile to %s", outputDirectory.c_str());
+        return false;
+    }
+    return true;
+}
+bool JenovaSamplingProfiler::IsSampling()
+{
+    return isSampling.load(std::memory_order_acquire);
+}
+void JenovaSamplingProfiler::CollectSamples()
+{
+    // Aggregate Rings Once Per Frame So They Never Fill Up
+    if (!isSampling.load(std::memory_order_acquire)) return;
+    std::lock_guard<std::mutex> lock(samplerMutex);
+    for (size_t threadSlot = 0; threadSlot < MaxThreads; threadSlot++)
+    {
+        if (sampledThreads[threadSlot].isRegistered) DrainThreadSamples(threadSlot);
+    }
+}
+size_t JenovaSamplingProfiler::GetDroppedSampleCount()
+{
+    return droppedSamples.load(std::memory_order_relaxed);
+}
+bool JenovaSamplingProfiler::StartSampling()
+{
+    #ifdef TARGET_PLATFORM_LINUX
+    if (!InstallSignalHandler()) return false;
+    isSampling.store(true, std::memory_order_release);
+    for (size_t threadSlot = 0; threadSlot < MaxThreads; threadSlot++)
+    {
+        SampledThread& sampledThread = sampledThreads[threadSlot];
+        if (sampledThread.isRegistered && !CreateThreadTimer(sampledThread))
+        {
+            jenova::Warning("Jenova Sampling Profiler", "Failed to Create Sampling Timer for Thread [%s].", sampledThread.threadName.c_str());
+        }
+    }
+    return true;
+    #else
+    return false;
+    #endif
+}
+void JenovaSamplingProfiler::StopSampling()
+{
+    #ifdef TARGET_PLATFORM_LINUX
+    for (size_t threadSlot = 0; threadSlot < MaxThreads; threadSlot++) DestroyThreadTimer(sampledThreads[threadSlot]);
+    for (size_t threadSlot = 0; threadSlot < MaxThreads; threadSlot++)
+    {
+        if (sampledThreads[threadSlot].isRegistered) DrainThreadSamples(threadSlot);
+    }
+    #endif
+    isSampling.store(false, std::memory_order_release);
+}
+bool JenovaSamplingProfiler::CollectModuleSymbols(const uint8_t* moduleDataPtr, size_t moduleSize, jenova::ModuleAddress moduleBaseAddress, const jenova::json_t& moduleMetaData,
+    std::vector<ModuleSymbol>& symbols, uintptr_t& moduleEnd)
+{
+    // Reset Symbols
+    uintptr_t moduleStart = uintptr_t(moduleBaseAddress);
+    symbols.clear();
+    moduleEnd = moduleStart + moduleSize;
+
+    // Collect Script Methods From Metadata [Preferred Names]
+    if (moduleMetaData.contains("Scripts"))
+    {
+        for (const auto& moduleScript : moduleMetaData["Scripts"].items())
+        {
+            if (!moduleScript.value().contains("methods")) continue;
+            for (const auto& scriptMethod : moduleScript.value()["methods"].items())
+            {
+                if (!scriptMethod.value().contains("Offset")) continue;
+                uintptr_t methodAddress = moduleStart + scriptMethod.value()["Offset"].get<uintptr_t>();
+                symbols.push_back({ methodAddress, 0, moduleScript.key() + "::" + scriptMethod.key() });
+            }
+        }
+    }
+    size_t metadataSymbolCount = symbols.size();
+
+    #ifdef TARGET_PLATFORM_LINUX
+    // Collect Function Symbols From In-Memory ELF Image
+    const Elf64_Ehdr* elfHeader = reinterpret_cast<const Elf64_Ehdr*>(moduleDataPtr);
+    bool isValidImage = moduleDataPtr && moduleSize >= sizeof(Elf64_Ehdr);
+    if (isValidImage) isValidImage = memcmp(elfHeader->e_ident, ELFMAG, SELFMAG) == 0 && elfHeader->e_ident[EI_CLASS] == ELFCLASS64;
+
+    // Compute Mapped Extent From Loadable Segments
+    if (isValidImage && elfHeader->e_phoff + size_t(elfHeader->e_phnum) * sizeof(Elf64_Phdr) <= moduleSize)
+    {
+        const Elf64_Phdr* programHeaders = reinterpret_cast<const Elf64_Phdr*>(moduleDataPtr + elfHeader->e_phoff);
+        for (size_t i = 0; i < elfHeader->e_phnum; i++)
+        {
+            if (programHeaders[i].p_type != PT_LOAD) continue;
+            moduleEnd = std::max(moduleEnd, moduleStart + uintptr_t(programHeaders[i].p_vaddr + programHeaders[i].p_memsz));
+        }
+    }
+
+    // Read Symbol Tables
+    if (isValidImage && elfHeader->e_shoff + size_t(elfHeader->e_shnum) * sizeof(Elf64_Shdr) <= moduleSize)
+    {
+        const Elf64_Shdr* sectionHeaders = reinterpret_cast<const Elf64_Shdr*>(moduleDataPtr + elfHeader->e_shoff);
+        for (size_t i = 0; i < elfHeader->e_shnum; i++)
+        {
+            const Elf64_Shdr& symbolSection = sectionHeaders[i];
+            if (symbolSection.sh_type != SHT_SYMTAB && symbolSection.sh_type != SHT_DYNSYM) continue;
+            if (symbolSection.sh_link >= elfHeader->e_shnum || symbolSection.sh_offset + symbolSection.sh_size > moduleSize) continue;
+            const Elf64_Shdr& stringSection = sectionHeaders[symbolSection.sh_link];
+            if (stringSection.sh_offset + stringSection.sh_size > moduleSize) continue;
+            const Elf64_Sym* elfSymbols = reinterpret_cast<const Elf64_Sym*>(moduleDataPtr + symbolSection.sh_offset);
+            const char* symbolNames = reinterpret_cast<const char*>(moduleDataPtr + stringSection.sh_offset);
+            for (size_t s = 0; s < symbolSection.sh_size / sizeof(Elf64_Sym); s++)
+            {
+                const Elf64_Sym& elfSymbol = elfSymbols[s];
+                if (ELF64_ST_TYPE(elfSymbol.st_info) != STT_FUNC || elfSymbol.st_value == 0 || elfSymbol.st_shndx == SHN_UNDEF) continue;
+                if (elfSymbol.st_name >= stringSection.sh_size) continue;
+                uintptr_t symbolAddress = moduleStart + uintptr_t(elfSymbol.st_value);
+                symbols.push_back({ symbolAddress, symbolAddress + uintptr_t(elfSymbol.st_size), DemangleSymbol(symbolNames + elfSymbol.st_name) });
+            }
+        }
+    }
+
+    // Metadata Names Take Over Matching ELF Symbols But Inherit Their Sizes
+    std::unordered_map<uintptr_t, size_t> metadataSymbols;
+    for (size_t i = 0; i < metadataSymbolCount; i++) metadataSymbols[symbols[i].startAddress] = i;
+    for (size_t i = metadataSymbolCount; i < symbols.size(); i++)
+    {
+        auto metadataSymbol = metadataSymbols.find(symbols[i].startAddress);
+        if (metadataSymbol != metadataSymbols.end() && symbols[metadataSymbol->second].endAddress == 0) symbols[metadataSymbol->second].endAddress = symbols[i].endAddress;
+    }
+    #endif
+
+    // Sort And Remove Duplicates [Stable Sort Keeps Metadata Names First]
+    std::stable_sort(symbols.begin(), symbols.end(), [](const ModuleSymbol& a, const ModuleSymbol& b) { return a.startAddress < b.startAddress; });
+    symbols.erase(std::unique(symbols.begin(), symbols.end(), [](const ModuleSymbol& a, const ModuleSymbol& b) { return a.startAddress == b.startAddress; }), symbols.end());
+
+    // Symbols Without Size Extend To Next Symbol
+    for (size_t i = 0; i < symbols.size(); i++)
+    {
+        if (symbols[i].endAddress > symbols[i].startAddress) continue;
+        symbols[i].endAddress = (i + 1 < symbols.size()) ? symbols[i + 1].startAddress : moduleEnd;
+    }
+    return !symbols.empty();
+}
+std::string JenovaSamplingProfiler::SymbolizeAddress(uintptr_t frameAddress)
+{
+    // Resolve Jenova Module Frames
+    if (frameAddress >= moduleStartAddress && frameAddress < moduleEndAddress)
+    {
+        auto nextSymbol = std::upper_bound(moduleSymbols.begin(), moduleSymbols.end(), frameAddress, [](uintptr_t address, const ModuleSymbol& symbol) { return address < symbol.startAddress; });
+        if (nextSymbol != moduleSymbols.begin())
+        {
+            const ModuleSymbol& moduleSymbol = *std::prev(nextSymbol);
+            if (frameAddress < moduleSymbol.endAddress) return moduleSymbol.symbolName;
+        }
+        return jenova::Format("Jenova.Module+0x%llx", (unsigned long long)(frameAddress - moduleStartAddress));
+    }
+
+    // Resolve Engine And System Frames
+    #ifdef TARGET_PLATFORM_LINUX
+    Dl_info symbolInfo;
+    if (dladdr(reinterpret_cast<void*>(frameAddress), &symbolInfo) != 0)
+    {
+        if (symbolInfo.dli_sname) return DemangleSymbol(symbolInfo.dli_sname);
+        if (symbolInfo.dli_fname) return "[" + std::filesystem::path(symbolInfo.dli_fname).filename().string() + "]";
+    }
+    #endif
+    return "[unknown]";
+}
+bool JenovaSamplingProfiler::WriteFoldedStacks(const std::string& foldedFilePath, const FoldedStacks& foldedStacks)
+{
+    // Sort Lines For Stable Output
+    std::vector<std::pair<std::string, uint64_t>> foldedLines(foldedStacks.begin(), foldedStacks.end());
+    std::sort(foldedLines.begin(), foldedLines.end());
+
+    // Write Folded Stacks [Compatible With flamegraph.pl And speedscope]
+    std::ofstream foldedFile(foldedFilePath, std::ios::out | std::ios::trunc);
+    if (!foldedFile.is_open()) return false;
+    for (const auto& foldedLine : foldedLines) foldedFile << foldedLine.first << " " << foldedLine.second << "\n";
+    return foldedFile.good();
+}
+bool JenovaSamplingProfiler::WriteFlameGraph(const std::string& flameGraphFilePath, const FoldedStacks& foldedStacks)
+{
+    // Flame Graph Node
+    struct FlameNode
+    {
+        std::string frameName;
+        uint64_t sampleCount = 0;
+        std::vector<size_t> children;
+    };
+
+    // Build Frame Tree From Folded Stacks
+    std::vector<FlameNode> flameNodes(1);
+    flameNodes[0].frameName = "all";
+    size_t maxDepth = 0;
+    for (const auto& foldedStack : foldedStacks)
+    {
+        size_t currentNode = 0, depth = 0, frameStart = 0;
+        flameNodes[0].sampleCount += foldedStack.second;
+        while (frameStart <= foldedStack.first.size())
+        {
+            size_t frameEnd = foldedStack.first.find(';', frameStart);
+            if (frameEnd == std::string::npos) frameEnd = foldedStack.first.size();
+            std::string frameName = foldedStack.first.substr(frameStart, frameEnd - frameStart);
+            size_t childNode = 0;
+            for (size_t child : flameNodes[currentNode].children) if (flameNodes[child].frameName == frameName) { childNode = child; break; }
+            if (childNode == 0)
+            {
+                childNode = flameNodes.size();
+                flameNodes[currentNode].children.push_back(childNode);
+                flameNodes.push_back({ frameName, 0, {} });
+            }
+            flameNodes[childNode].sampleCount += foldedStack.second;
+            currentNode = childNode;
+            maxDepth = std::max(maxDepth, ++depth);
+            frameStart = frameEnd + 1;
+        }
+    }
+
+    // Image Layout [Root At Bottom]
+    const double imageWidth = 1200.0, framePadding = 10.0, frameHeight = 16.0, titleHeight = 34.0;
+    const double imageHeight = titleHeight + (maxDepth + 1) * frameHeight + framePadding * 2;
+    const double sampleScale = (imageWidth - framePadding * 2) / double(std::max<uint64_t>(flameNodes[0].sampleCount, 1));
+
+    // Write Header
+    std::ofstream flameGraphFile(flameGraphFilePath, std::ios::out | std::ios::trunc);
+    if (!flameGraphFile.is_open()) return false;
+    flameGraphFile << "<?xml version=\"1.0\" standalone=\"no\"?>\n";
+    flameGraphFile << jenova::Format("<svg version=\"1.1\" width=\"%.0f\" height=\"%.0f\" viewBox=\"0 0 %.0f %.0f\" xmlns=\"http://www.w3.org/2000/svg\">\n", imageWidth, imageHeight, imageWidth, imageHeight);
+    flameGraphFile << "<style>text { font-family: monospace; font-size: 12px; fill: #000; } rect:hover { stroke: #000; stroke-width: 0.5; }</style>\n";
+    flameGraphFile << jenova::Format("<rect x=\"0\" y=\"0\" width=\"%.0f\" height=\"%.0f\" fill=\"#f8f8f8\"/>\n", imageWidth, imageHeight);
+    flameGraphFile << jenova::Format("<text x=\"%.0f\" y=\"24\" text-anchor=\"middle\" style=\"font-size:17px\">Jenova Native Profile (%llu Samples)</text>\n",
+        imageWidth / 2, (unsigned long long)flameNodes[0].sampleCount);
+
+    // Write Frames [Children Sorted By Name Like flamegraph.pl]
+    std::function<void(size_t, size_t, double)> writeFrame = [&](size_t nodeIndex, size_t depth, double frameX)
+    {
+        FlameNode& flameNode = flameNodes[nodeIndex];
+        double frameWidth = flameNode.sampleCount * sampleScale;
+        if (frameWidth < 0.1) return;
+        double frameY = imageHeight - framePadding - (depth + 1) * frameHeight;
+        size_t nameHash = std::hash<std::string>()(flameNode.frameName);
+        int red = 205 + int(nameHash % 50), green = int((nameHash >> 8) % 230), blue = int((nameHash >> 16) % 55);
+        double samplePercent = 100.0 * double(flameNode.sampleCount) / double(flameNodes[0].sampleCount);
+        std::string escapedName = EscapeMarkup(flameNode.frameName);
+        flameGraphFile << jenova::Format("<g><title>%s (%llu Samples, %.2f%%)</title><rect x=\"%.1f\" y=\"%.1f\" width=\"%.1f\" height=\"%.1f\" fill=\"rgb(%d,%d,%d)\" rx=\"2\"/>",
+            escapedName.c_str(), (unsigned long long)flameNode.sampleCount, samplePercent, frameX, frameY, frameWidth, frameHeight - 1, red, green, blue);
+        size_t visibleCharacters = frameWidth > 24.0 ? size_t((frameWidth - 6.0) / 7.0) : 0;
+        if (visibleCharacters >= 3)
+        {
+            std::string frameLabel = flameNode.frameName.size() > visibleCharacters ? flameNode.frameName.substr(0, visibleCharacters - 2) + ".." : flameNode.frameName;
+            flameGraphFile << jenova::Format("<text x=\"%.1f\" y=\"%.1f\">%s</text>", frameX + 3, frameY + frameHeight - 4.5, EscapeMarkup(frameLabel).c_str());
+        }
+        flameGraphFile << "</g>\n";
+        std::vector<size_t> children = flameNode.children;
+        std::sort(children.begin(), children.end(), [&](size_t a, size_t b) { return flameNodes[a].frameName < flameNodes[b].frameName; });
+        for (size_t child : children)
+        {
+            writeFrame(child, depth + 1, frameX);
+            frameX += flameNodes[child].sampleCount * sampleScale;
+        }
+    };
+    writeFrame(0, 0, framePadding);
+    flameGraphFile << "</svg>\n";
+    return flameGraphFile.good();
+}
+
+// Jenova Perf Map Internal Storage
+namespace jenova::sampling
+{
+    static FILE* perfMapFile = nullptr;
+    static std::atomic<bool> isPerfMapOpen = false;
+    static std::mutex perfMapMutex;
+    static std::unordered_set<size_t> writtenThunks;
+    static std::unordered_map<std::string, size_t> measuredThunks;
+}
+
+// Jenova Perf Map Implementation
+bool JenovaPerfMap::Open()
+{
+    #ifdef TARGET_PLATFORM_LINUX
+    std::lock_guard<std::mutex> lock(perfMapMutex);
+    if (perfMapFile) return true;
+    std::string perfMapPath = jenova::Format("/tmp/perf-%d.map", int(getpid()));
+    perfMapFile = fopen(perfMapPath.c_str(), "a");
+    if (!perfMapFile)
+    {
+        jenova::Error("Jenova Perf Map", "Failed to Open Perf Map File : %s", perfMapPath.c_str());
+        return false;
+    }
+    setvbuf(perfMapFile, nullptr, _IOFBF, jenova::GlobalSettings::PerfMapBufferSize);
+    isPerfMapOpen.store(true, std::memory_order_release);
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Perf Map Enabled : %s", perfMapPath.c_str());
+    return true;
+    #else
+    jenova::Warning("Jenova Perf Map", "Perf Map Output Is Only Supported On Linux.");
+    return false;
+    #endif
+}
+void JenovaPerfMap::Close()
+{
+    std::lock_guard<std::mutex> lock(perfMapMutex);
+    if (!perfMapFile) return;
+    isPerfMapOpen.store(false, std::memory_order_release);
+    fclose(perfMapFile);
+    perfMapFile = nullptr;
+    writtenThunks.clear();
+    measuredThunks.clear();
+}
+bool JenovaPerfMap::IsOpen()
+{
+    return isPerfMapOpen.load(std::memory_order_acquire);
+}
+void JenovaPerfMap::WriteModuleSymbols(const uint8_t* moduleDataPtr, size_t moduleSize, jenova::ModuleAddress moduleBaseAddress, const jenova::json_t& moduleMetaData)
+{
+    // Collect Symbols Outside Of Lock
+    if (!IsOpen()) return;
+    std::vector<ModuleSymbol> symbols;
+    uintptr_t moduleEnd = 0;
+    JenovaSamplingProfiler::CollectModuleSymbols(moduleDataPtr, moduleSize, moduleBaseAddress, moduleMetaData, symbols, moduleEnd);
+
+    // Write Entries [Later Entries Override Earlier Ones For Reused Addresses]
+    std::lock_guard<std::mutex> lock(perfMapMutex);
+    if (!perfMapFile) return;
+    for (const ModuleSymbol& symbol : symbols)
+    {
+        fprintf(perfMapFile, "%llx %llx %s\n", (unsigned long long)symbol.startAddress, (unsigned long long)(symbol.endAddress - symbol.startAddress), symbol.symbolName.c_str());
+    }
+    fflush(perfMapFile);
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Perf Map Received %zu Symbols For Module At %p", symbols.size(), reinterpret_cast<void*>(moduleBaseAddress));
+}
+void JenovaPerfMap::WriteThunk(const void* thunkAddress, size_t thunkSize, const char* backendName, const std::string& scriptUID, const std::string& functionName)
+{
+    // Thunks Are Generated Per Call, Only Write Address/Target Pairs Not Seen Yet
+    if (!IsOpen() || !thunkAddress) return;
+    size_t thunkHash = std::hash<std::string>()(functionName) ^ (std::hash<std::string>()(scriptUID) << 1);
+    thunkHash = (thunkHash ^ uintptr_t(thunkAddress)) * 1099511628211ULL ^ thunkSize;
+    std::lock_guard<std::mutex> lock(perfMapMutex);
+    if (!perfMapFile || !writtenThunks.insert(thunkHash).second) return;
+    if (writtenThunks.size() > jenova::GlobalSettings::PerfMapThunkHistory) writtenThunks.clear();
+    fprintf(perfMapFile, "%llx %llx JenovaThunk[%s]::%s::%s\n", (unsigned long long)uintptr_t(thunkAddress), (unsigned long long)thunkSize, backendName, scriptUID.c_str(), functionName.c_str());
+}
+size_t JenovaPerfMap::GetThunkSize(const char* backendName, const std::string& scriptUID, const std::string& functionName, const std::function<size_t()>& measureThunk)
+{
+    // Same Script Function Always Generates Same Thunk Layout, Measure It Once
+    if (!IsOpen()) return 0;
+    std::string thunkKey = std::string(backendName) + "::" + scriptUID + "::" + functionName;
+    std::lock_guard<std::mutex> lock(perfMapMutex);
+    auto measuredThunk = measuredThunks.find(thunkKey);
+    if (measuredThunk != measuredThunks.end()) return measuredThunk->second;
+    size_t thunkSize = measureThunk();
+    measuredThunks[thunkKey] = thunkSize;
+    return thunkSize;
+}
+void JenovaPerfMap::Flush()
+{
+    std::lock_guard<std::mutex> lock(perfMapMutex);
+    if (perfMapFile) fflush(perfMapFile);
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Sampling Profiler Definition
+/*
+    Samples Native Call Stacks Of Registered Threads (Main And Task Threads) While A Jenova Module Is Attached.
+    Linux Only : Each Thread Gets A Per-Thread CPU Time Timer Delivering SIGPROF, The Handler Unwinds Frame Pointers
+    Into A Preallocated Per-Thread Ring. Rings Are Aggregated Every Frame And Symbolized On Detach Against
+    Module Metadata And ELF Symbols, Then Written As Folded Stacks And A Flame Graph To The Cache Directory.
+*/
+class JenovaSamplingProfiler
+{
+public:
+    // Sampling Structures
+    struct ModuleSymbol
+    {
+        uintptr_t startAddress = 0;
+        uintptr_t endAddress = 0;
+        std::string symbolName;
+    };
+    using FoldedStacks = std::unordered_map<std::string, uint64_t>;
+
+public:
+    static bool RegisterThread(const char* threadName);
+    static void UnregisterThread();
+    static bool AttachModule(const uint8_t* moduleDataPtr, size_t moduleSize, jenova::ModuleAddress moduleBaseAddress, const jenova::json_t& moduleMetaData);
+    static bool DetachModule(const std::string& outputDirectory);
+    static bool IsSampling();
+    static void CollectSamples();
+    static size_t GetDroppedSampleCount();
+    static bool CollectModuleSymbols(const uint8_t* moduleDataPtr, size_t moduleSize, jenova::ModuleAddress moduleBaseAddress, const jenova::json_t& moduleMetaData,
+        std::vector<ModuleSymbol>& symbols, uintptr_t& moduleEnd);
+
+private:
+    static bool StartSampling();
+    static void StopSampling();
+    static std::string SymbolizeAddress(uintptr_t frameAddress);
+    static bool WriteFoldedStacks(const std::string& foldedFilePath, const FoldedStacks& foldedStacks);
+    static bool WriteFlameGraph(const std::string& flameGraphFilePath, const FoldedStacks& foldedStacks);
+};
+
+// Jenova Perf Map Definition
+/*
+    Writes /tmp/perf-<pid>.map Entries For Loaded Jenova Modules And Generated Call Thunks,
+    Allowing External Profilers (perf, hotspot, samply) To Symbolize memfd-Loaded And JIT Code. Linux Only.
+*/
+class JenovaPerfMap
+{
+public:
+    static bool Open();
+    static void Close();
+    static bool IsOpen();
+    static void WriteModuleSymbols(const uint8_t* moduleDataPtr, size_t moduleSize, jenova::ModuleAddress moduleBaseAddress, const jenova::json_t& moduleMetaData);
+    static void WriteThunk(const void* thunkAddress, size_t thunkSize, const char* backendName, const std::string& scriptUID, const std::string& functionName);
+    static size_t GetThunkSize(const char* backendName, const std::string& scriptUID, const std::string& functionName, const std::function<size_t()>& measureThunk);
+    static void Flush();
+};
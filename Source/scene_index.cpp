@@ -0,0 +1,294 @@
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Scene Index Internal Storage
+namespace jenova::sceneindex
+{
+    // Structures
+    struct IndexedNode
+    {
+        std::string nodeName;
+        std::string className;
+        std::string uniqueID;
+        size_t nameSlot = 0;
+        size_t classSlot = 0;
+    };
+    typedef std::vector<Node*> NodeBucket;
+    typedef std::unordered_map<std::string, NodeBucket> NodeBuckets;
+
+    // Scene Index State
+    static bool isActive = false;
+    static bool isUniqueIDIndexed = false;
+    static uint64_t sceneTreeInstanceID = 0;
+    static std::unordered_map<Node*, IndexedNode> indexedNodes;
+    static NodeBuckets nameBuckets;
+    static NodeBuckets classBuckets;
+    static std::unordered_map<std::string, Node*> uniqueIDs;
+
+    // Utilities
+    static void InsertIntoBucket(NodeBuckets& nodeBuckets, const std::string& bucketKey, Node* node, size_t& bucketSlot)
+    {
+        NodeBucket& nodeBucket = nodeBuckets[bucketKey];
+        bucketSlot = nodeBucket.size();
+        nodeBucket.push_back(node);
+    }
+    static void RemoveFromBucket(NodeBuckets& nodeBuckets, const std::string& bucketKey, size_t bucketSlot, size_t IndexedNode::* slotMember)
+    {
+        // Swap With Last And Patch Its Slot [Constant Time Removal]
+        auto bucketEntry = nodeBuckets.find(bucketKey);
+        if (bucketEntry == nodeBuckets.end()) return;
+        NodeBucket& nodeBucket = bucketEntry->second;
+        Node* movedNode = nodeBucket.back();
+        nodeBucket[bucketSlot] = movedNode;
+        nodeBucket.pop_back();
+        if (bucketSlot < nodeBucket.size()) indexedNodes[movedNode].*slotMember = bucketSlot;
+        if (nodeBucket.empty()) nodeBuckets.erase(bucketEntry);
+    }
+    static std::string ComputeUniqueID(Node* node)
+    {
+        return AS_STD_STRING(String(node->get_path()).md5_text());
+    }
+    static bool IsInternalChild(Node* node, Node* parentNode)
+    {
+        // Internal Children Are Hidden From Default Child Queries, Only Scan Siblings When Parent Has Any
+        int childCount = parentNode->get_child_count(false);
+        if (childCount == parentNode->get_child_count(true)) return false;
+        for (int i = 0; i < childCount; i++) if (parentNode->get_child(i, false) == node) return false;
+        return true;
+    }
+    static Node* SearchSubtree(Node* node, const String& nodeName, size_t& visitBudget)
+    {
+        // Depth-First Search Bounded By Visit Budget, Budget Reaching Zero Means Search Was Cut Short
+        if (visitBudget == 0) return nullptr;
+        visitBudget--;
+        if (node->get_name() == nodeName) return node;
+        for (int i = 0; i < node->get_child_count(false); i++)
+        {
+            Node* foundNode = SearchSubtree(node->get_child(i, false), nodeName, visitBudget);
+            if (foundNode || visitBudget == 0) return foundNode;
+        }
+        return nullptr;
+    }
+    static TypedArray<Node> CreateNodeArray(const NodeBucket& nodeBucket)
+    {
+        TypedArray<Node> nodeArray;
+        nodeArray.resize(nodeBucket.size());
+        for (size_t i = 0; i < nodeBucket.size(); i++) nodeArray[i] = nodeBucket[i];
+        return nodeArray;
+    }
+}
+
+// Jenova Scene Index Implementation
+using namespace jenova::sceneindex;
+bool JenovaSceneIndex::Activate()
+{
+    if (isActive) return true;
+    SceneTree* sceneTree = jenova::GetSceneTree();
+    if (!sceneTree || !sceneTree->get_root()) return false;
+
+    // Index Current Tree Then Follow Changes
+    JenovaTinyProfiler::CreateCheckpoint("JenovaSceneIndexActivate");
+    IndexSubtree(sceneTree->get_root());
+    sceneTree->connect("node_added", callable_mp_static(&JenovaSceneIndex::OnNodeAdded));
+    sceneTree->connect("node_removed", callable_mp_static(&JenovaSceneIndex::OnNodeRemoved));
+    sceneTree->connect("node_renamed", callable_mp_static(&JenovaSceneIndex::OnNodeRenamed));
+    sceneTreeInstanceID = sceneTree->get_instance_id();
+    isActive = true;
+    JENOVA_VERBOSE("Jenova Scene Index Activated With %zu Nodes In %.3f ms", indexedNodes.size(), JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaSceneIndexActivate"));
+    return true;
+}
+void JenovaSceneIndex::Shutdown()
+{
+    if (!isActive) return;
+
+    // Scene Tree May Already Be Gone At Extension Release
+    SceneTree* sceneTree = Object::cast_to<SceneTree>(ObjectDB::get_instance(sceneTreeInstanceID));
+    if (sceneTree)
+    {
+        sceneTree->disconnect("node_added", callable_mp_static(&JenovaSceneIndex::OnNodeAdded));
+        sceneTree->disconnect("node_removed", callable_mp_static(&JenovaSceneIndex::OnNodeRemoved));
+        sceneTree->disconnect("node_renamed", callable_mp_static(&JenovaSceneIndex::OnNodeRenamed));
+    }
+    indexedNodes.clear();
+    nameBuckets.clear();
+    classBuckets.clear();
+    uniqueIDs.clear();
+    isUniqueIDIndexed = false;
+    isActive = false;
+}
+bool JenovaSceneIndex::IsActive()
+{
+    return isActive;
+}
+bool JenovaSceneIndex::IsIndexed(Node* node)
+{
+    if (!node || !Activate()) return false;
+    return indexedNodes.find(node) != indexedNodes.end();
+}
+size_t JenovaSceneIndex::GetIndexedNodeCount()
+{
+    return indexedNodes.size();
+}
+Node* JenovaSceneIndex::FindNodeByName(Node* parentNode, const String& nodeName)
+{
+    if (!parentNode || !Activate()) return nullptr;
+    auto bucketEntry = nameBuckets.find(AS_STD_STRING(nodeName));
+    if (bucketEntry == nameBuckets.end()) return nullptr;
+
+    // Small Subtrees Are Cheaper To Walk Than A Crowded Bucket, Try Walking With Bucket Size As Budget
+    size_t visitBudget = bucketEntry->second.size();
+    Node* searchedNode = SearchSubtree(parentNode, nodeName, visitBudget);
+    if (searchedNode || visitBudget != 0) return searchedNode;
+
+    // First Match In Tree Order Under Parent [Same Result As Depth-First Search]
+    Node* foundNode = nullptr;
+    for (Node* candidateNode : bucketEntry->second)
+    {
+        if (candidateNode != parentNode && !parentNode->is_ancestor_of(candidateNode)) continue;
+        if (!foundNode || foundNode->is_greater_than(candidateNode)) foundNode = candidateNode;
+    }
+    return foundNode;
+}
+TypedArray<Node> JenovaSceneIndex::FindNodesByName(const String& nodeName)
+{
+    if (!Activate()) return TypedArray<Node>();
+    auto bucketEntry = nameBuckets.find(AS_STD_STRING(nodeName));
+    if (bucketEntry == nameBuckets.end()) return TypedArray<Node>();
+    return CreateNodeArray(bucketEntry->second);
+}
+TypedArray<Node> JenovaSceneIndex::FindNodesByClass(const String& className)
+{
+    // Buckets Are Per Exact Class, Inherited Classes Are Matched Per Bucket Not Per Node
+    TypedArray<Node> classNodes;
+    if (!Activate()) return classNodes;
+    for (const auto& classBucket : classBuckets)
+    {
+        String bucketClassName(classBucket.first.c_str());
+        if (bucketClassName != className && !ClassDBSingleton::get_singleton()->is_parent_class(bucketClassName, className)) continue;
+        classNodes.append_array(CreateNodeArray(classBucket.second));
+    }
+    return classNodes;
+}
+Node* JenovaSceneIndex::GetNodeByUniqueID(const String& uniqueID)
+{
+    if (!Activate() || !BuildUniqueIDIndex()) return nullptr;
+    auto uniqueIDEntry = uniqueIDs.find(AS_STD_STRING(uniqueID));
+    return uniqueIDEntry != uniqueIDs.end() ? uniqueIDEntry->second : nullptr;
+}
+const std::string* JenovaSceneIndex::GetNodeUniqueID(Node* node)
+{
+    if (!node || !Activate()) return nullptr;
+    auto indexedEntry = indexedNodes.find(node);
+    if (indexedEntry == indexedNodes.end()) return nullptr;
+
+    // Hash Once, Cached Until Node Leaves Tree Or Its Path Changes [Pointer Dies With Node Removal Or Any Ancestor Rename]
+    IndexedNode& indexedNode = indexedEntry->second;
+    if (indexedNode.uniqueID.empty())
+    {
+        indexedNode.uniqueID = ComputeUniqueID(node);
+        uniqueIDs[indexedNode.uniqueID] = node;
+    }
+    return &indexedNode.uniqueID;
+}
+void JenovaSceneIndex::OnNodeAdded(Node* node)
+{
+    IndexNode(node);
+}
+void JenovaSceneIndex::OnNodeRemoved(Node* node)
+{
+    UnindexNode(node);
+}
+void JenovaSceneIndex::OnNodeRenamed(Node* node)
+{
+    auto indexedEntry = indexedNodes.find(node);
+    if (indexedEntry == indexedNodes.end()) return;
+
+    // Move Node To New Name Bucket
+    IndexedNode& indexedNode = indexedEntry->second;
+    RemoveFromBucket(nameBuckets, indexedNode.nodeName, indexedNode.nameSlot, &IndexedNode::nameSlot);
+    indexedNode.nodeName = AS_STD_STRING(String(node->get_name()));
+    InsertIntoBucket(nameBuckets, indexedNode.nodeName, node, indexedNode.nameSlot);
+
+    // Paths Of Node And Its Descendants Changed
+    RehashSubtreeIDs(node);
+}
+void JenovaSceneIndex::IndexNode(Node* node)
+{
+    if (!node || indexedNodes.find(node) != indexedNodes.end()) return;
+
+    // Internal Nodes And Their Descendants Stay Out Of Index [Parents Are Added Before Children]
+    Node* parentNode = node->get_parent();
+    if (parentNode && (indexedNodes.find(parentNode) == indexedNodes.end() || IsInternalChild(node, parentNode))) return;
+    IndexedNode& indexedNode = indexedNodes[node];
+    indexedNode.nodeName = AS_STD_STRING(String(node->get_name()));
+    indexedNode.className = AS_STD_STRING(node->get_class());
+    InsertIntoBucket(nameBuckets, indexedNode.nodeName, node, indexedNode.nameSlot);
+    InsertIntoBucket(classBuckets, indexedNode.className, node, indexedNode.classSlot);
+    if (isUniqueIDIndexed)
+    {
+        indexedNode.uniqueID = ComputeUniqueID(node);
+        uniqueIDs[indexedNode.uniqueID] = node;
+    }
+}
+void JenovaSceneIndex::UnindexNode(Node* node)
+{
+    auto indexedEntry = indexedNodes.find(node);
+    if (indexedEntry == indexedNodes.end()) return;
+    IndexedNode& indexedNode = indexedEntry->second;
+    RemoveFromBucket(nameBuckets, indexedNode.nodeName, indexedNode.nameSlot, &IndexedNode::nameSlot);
+    RemoveFromBucket(classBuckets, indexedNode.className, indexedNode.classSlot, &IndexedNode::classSlot);
+    if (!indexedNode.uniqueID.empty())
+    {
+        auto uniqueIDEntry = uniqueIDs.find(indexedNode.uniqueID);
+        if (uniqueIDEntry != uniqueIDs.end() && uniqueIDEntry->second == node) uniqueIDs.erase(uniqueIDEntry);
+    }
+    indexedNodes.erase(indexedEntry);
+}
+void JenovaSceneIndex::IndexSubtree(Node* node)
+{
+    IndexNode(node);
+    for (int i = 0; i < node->get_child_count(false); i++) IndexSubtree(node->get_child(i, false));
+}
+void JenovaSceneIndex::RehashSubtreeIDs(Node* node)
+{
+    auto indexedEntry = indexedNodes.find(node);
+    if (indexedEntry == indexedNodes.end()) return;
+    IndexedNode& indexedNode = indexedEntry->second;
+    if (!indexedNode.uniqueID.empty())
+    {
+        auto uniqueIDEntry = uniqueIDs.find(indexedNode.uniqueID);
+        if (uniqueIDEntry != uniqueIDs.end() && uniqueIDEntry->second == node) uniqueIDs.erase(uniqueIDEntry);
+        indexedNode.uniqueID.clear();
+    }
+    if (isUniqueIDIndexed)
+    {
+        indexedNode.uniqueID = ComputeUniqueID(node);
+        uniqueIDs[indexedNode.uniqueID] = node;
+    }
+    for (int i = 0; i < node->get_child_count(false); i++) RehashSubtreeIDs(node->get_child(i, false));
+}
+bool JenovaSceneIndex::BuildUniqueIDIndex()
+{
+    if (isUniqueIDIndexed) return true;
+    for (auto& indexedEntry : indexedNodes)
+    {
+        if (!indexedEntry.second.uniqueID.empty()) continue;
+        indexedEntry.second.uniqueID = ComputeUniqueID(indexedEntry.first);
+        uniqueIDs[indexedEntry.second.uniqueID] = indexedEntry.first;
+    }
+    isUniqueIDIndexed = true;
+    return true;
+}
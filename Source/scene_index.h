@@ -0,0 +1,50 @@
+#pragma once
+
+/*-------------------------------------------------------------+
+|                                                              |
+|                   _________   ______ _    _____              |
+|                  / / ____/ | / / __ \ |  / /   |             |
+|             __  / / __/ /  |/ / / / / | / / /| |             |
+|            / /_/ / /___/ /|  / /_/ /| |/ / ___ |             |
+|            \____/_____/_/ |_/\____/ |___/_/  |_|             |
+|                                                              |
+|                        Jenova Runtime                        |
+|                   Developed by Hamid.Memar                   |
+|                                                              |
++-------------------------------------------------------------*/
+
+// Jenova SDK
+#include "Jenova.hpp"
+
+// Jenova Scene Index Definition
+/*
+    Indexes Nodes Of The Active SceneTree By Name, Class And Unique ID (MD5 Of Node Path) For SDK Lookups.
+    Activated On First Query, Walks The Tree Once Then Follows node_added, node_removed And node_renamed.
+    Unique IDs Are Only Hashed Once Something Asks For Them. Main Thread Only, Like The SceneTree Itself.
+    Internal Nodes (And Everything Under Them) Are Not Indexed, Matching Default Child Queries.
+    Pointer From GetNodeUniqueID Is Owned By Index And Invalid Once Node Is Removed Or It Or Any Ancestor Is Renamed.
+*/
+class JenovaSceneIndex
+{
+public:
+    static bool Activate();
+    static void Shutdown();
+    static bool IsActive();
+    static bool IsIndexed(Node* node);
+    static size_t GetIndexedNodeCount();
+    static Node* FindNodeByName(Node* parentNode, const String& nodeName);
+    static TypedArray<Node> FindNodesByName(const String& nodeName);
+    static TypedArray<Node> FindNodesByClass(const String& className);
+    static Node* GetNodeByUniqueID(const String& uniqueID);
+    static const std::string* GetNodeUniqueID(Node* node);
+
+private:
+    static void OnNodeAdded(Node* node);
+    static void OnNodeRemoved(Node* node);
+    static void OnNodeRenamed(Node* node);
+    static void IndexNode(Node* node);
+    static void UnindexNode(Node* node);
+    static void IndexSubtree(Node* node);
+    static void RehashSubtreeIDs(Node* node);
+    static bool BuildUniqueIDIndex();
+};
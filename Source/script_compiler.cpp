@@ -134,15 +134,15 @@ namespace jenova
         }
         String PreprocessScript(Ref<CPPScript> cppScript, const Dictionary& preprocessorSettings)
         {
-            // Get Original Source Code
-            String scriptSourceCode = cppScript->get_source_code();
+            // Get Original Source Code [Speculative Compiles Pass Unsaved Editor Text]
+            String scriptSourceCode = preprocessorSettings.has("ScriptSourceCode") ? String(preprocessorSettings["ScriptSourceCode"]) : cppScript->get_source_code();
 
             // Reset Line Number
             scriptSourceCode = scriptSourceCode.insert(0, "#line 1\n");
 
             // Process And Extract Properties
             jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, cppScript->GetScriptIdentity());
-            if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
+            if (!propertiesMetadata.empty() && propertiesMetadata != "null" && !preprocessorSettings.has("SpeculativeCompile")) jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
 
             // Preprocessor Definitions [Header]
             String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
@@ -338,13 +338,8 @@ namespace jenova
             // Parse Cache File
             try
             {
-                std::ifstream buildCacheDatabaseReader(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, std::ios::binary);
-                std::string buildCacheDatabaseContent(std::istreambuf_iterator<char>(buildCacheDatabaseReader), {});
-                if (!buildCacheDatabaseContent.empty())
-                {
-                    buildCacheDatabase = jenova::json_t::parse(buildCacheDatabaseContent);
-                    buildCacheFileFound = true;
-                }
+                // Parsed Database Stays Cached By Build Service Until File Changes
+                buildCacheFileFound = JenovaBuildService::LoadBuildCacheDatabase(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, buildCacheDatabase);
             }
             catch (const std::exception&) 
             {
@@ -363,7 +358,7 @@ namespace jenova
                 for (const auto& cppHeaderFile : cppHeaderFiles)
                 {
                     String cppHeaderUID = jenova::GenerateStandardUIDFromPath(cppHeaderFile);
-                    String cppHeaderHash = jenova::GenerateMD5HashFromFile(cppHeaderFile);
+                    String cppHeaderHash = JenovaBuildService::GetFileHash(cppHeaderFile);
                     if (buildCacheDatabase["Headers"].contains(AS_STD_STRING(cppHeaderUID)))
                     {
                         if (AS_STD_STRING(cppHeaderHash) != buildCacheDatabase["Headers"][AS_STD_STRING(cppHeaderUID)].get<std::string>())
@@ -465,9 +460,15 @@ namespace jenova
                         jenova::ReplaceAllMatchesWithString(command, "\\", "/");
                         jenova::ReplaceAllMatchesWithString(command, "\\\\", "/");
 
+                        // Create Compile Profiler Scope Name
+                        const char* compileScopeName = JenovaTinyProfiler::IsTraceRecording() ? JenovaTinyProfiler::InternScopeName("Compile " + AS_STD_STRING(scriptModule.scriptFilename)) : "CompileTranslationUnit";
+
                         // Initiate Compilation Task
-                        jenova::TaskID taskID = JenovaTaskSystem::InitiateTask([command, &compilationFailed, &compilationMutex, &errorMessages]()
+                        jenova::TaskID taskID = JenovaTaskSystem::InitiateTask([command, compileScopeName, &compilationFailed, &compilationMutex, &errorMessages]()
                         {
+                            // Create Compile Profiler Scope
+                            JenovaTinyProfiler::ScopedTimer compileScope(compileScopeName);
+
                             STARTUPINFOW si;
                             PROCESS_INFORMATION pi;
                             ZeroMemory(&si, sizeof(si));
@@ -838,6 +839,9 @@ namespace jenova
             // Convert linker command to wide string
             std::wstring wLinkerArgument(linkerArgument.begin(), linkerArgument.end());
 
+            // Create Link Profiler Scope
+            JenovaTinyProfiler::ScopedTimer linkScope("LinkModule");
+
             // Execute the linker command
             if (!CreateProcessW(NULL, &wLinkerArgument[0], NULL, NULL, TRUE, CREATE_NO_WINDOW, NULL, NULL, &si, &pi))
             {
@@ -879,7 +883,7 @@ namespace jenova
 
             // Read module to buffer
             std::ifstream moduleReader(outputModule, std::ios::binary);
-            result.builtModuleData = std::vector<uint8_t>(std::istreambuf_iterator<char>(moduleReader), {});
+            result.builtModuleData = jenova::BuildBuffer(std::istreambuf_iterator<char>(moduleReader), {});
 
             // Validate Module Buffer
             if (result.builtModuleData.size() == 0)
@@ -890,6 +894,9 @@ namespace jenova
                 return result;
             }
 
+            // Close Link Profiler Scope
+            linkScope.Stop();
+
             // Generate Metadata
             result.moduleMetaData = JenovaInterpreter::GenerateModuleMetadata(outputMap, scriptModules, result);
             if (result.moduleMetaData.empty())
@@ -1102,15 +1109,15 @@ namespace jenova
         }
         String PreprocessScript(Ref<CPPScript> cppScript, const Dictionary& preprocessorSettings)
         {
-            // Get Original Source Code
-            String scriptSourceCode = cppScript->get_source_code();
+            // Get Original Source Code [Speculative Compiles Pass Unsaved Editor Text]
+            String scriptSourceCode = preprocessorSettings.has("ScriptSourceCode") ? String(preprocessorSettings["ScriptSourceCode"]) : cppScript->get_source_code();
 
             // Reset Line Number
             scriptSourceCode = scriptSourceCode.insert(0, "#line 1\n");
 
             // Process And Extract Properties
             jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, cppScript->GetScriptIdentity());
-            if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
+            if (!propertiesMetadata.empty() && propertiesMetadata != "null" && !preprocessorSettings.has("SpeculativeCompile")) jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
 
             // Preprocessor Definitions [Header]
             String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
@@ -1300,13 +1307,8 @@ namespace jenova
             // Parse Cache File
             try
             {
-                std::ifstream buildCacheDatabaseReader(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, std::ios::binary);
-                std::string buildCacheDatabaseContent(std::istreambuf_iterator<char>(buildCacheDatabaseReader), {});
-                if (!buildCacheDatabaseContent.empty())
-                {
-                    buildCacheDatabase = jenova::json_t::parse(buildCacheDatabaseContent);
-                    buildCacheFileFound = true;
-                }
+                // Parsed Database Stays Cached By Build Service Until File Changes
+                buildCacheFileFound = JenovaBuildService::LoadBuildCacheDatabase(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, buildCacheDatabase);
             }
             catch (const std::exception&) 
             {
@@ -1325,7 +1327,7 @@ namespace jenova
                 for (const auto& cppHeaderFile : cppHeaderFiles)
                 {
                     String cppHeaderUID = jenova::GenerateStandardUIDFromPath(cppHeaderFile);
-                    String cppHeaderHash = jenova::GenerateMD5HashFromFile(cppHeaderFile);
+                    String cppHeaderHash = JenovaBuildService::GetFileHash(cppHeaderFile);
                     if (buildCacheDatabase["Headers"].contains(AS_STD_STRING(cppHeaderUID)))
                     {
                         if (AS_STD_STRING(cppHeaderHash) != buildCacheDatabase["Headers"][AS_STD_STRING(cppHeaderUID)].get<std::string>())
@@ -1415,9 +1417,15 @@ namespace jenova
                 jenova::ReplaceAllMatchesWithString(command, "\\", "/");
                 jenova::ReplaceAllMatchesWithString(command, "\\\\", "/");
 
+                // Create Compile Profiler Scope Name
+                const char* compileScopeName = JenovaTinyProfiler::IsTraceRecording() ? JenovaTinyProfiler::InternScopeName("Compile " + AS_STD_STRING(scriptModule.scriptFilename)) : "CompileTranslationUnit";
+
                 // Initiate Compilation Task
-                jenova::TaskID taskID = JenovaTaskSystem::InitiateTask([command, &compilationFailed, &compilationMutex, &errorMessages]()
+                jenova::TaskID taskID = JenovaTaskSystem::InitiateTask([command, compileScopeName, &compilationFailed, &compilationMutex, &errorMessages]()
                 {
+                    // Create Compile Profiler Scope
+                    JenovaTinyProfiler::ScopedTimer compileScope(compileScopeName);
+
                     STARTUPINFOW si;
                     PROCESS_INFORMATION pi;
                     ZeroMemory(&si, sizeof(si));
@@ -1662,6 +1670,9 @@ namespace jenova
             // Convert linker command to wide string
             std::wstring wLinkerArgument(linkerArgument.begin(), linkerArgument.end());
 
+            // Create Link Profiler Scope
+            JenovaTinyProfiler::ScopedTimer linkScope("LinkModule");
+
             // Execute the linker command
             if (!CreateProcessW(NULL, &wLinkerArgument[0], NULL, NULL, TRUE, CREATE_NO_WINDOW, NULL, NULL, &si, &pi))
             {
@@ -1703,7 +1714,7 @@ namespace jenova
 
             // Read module to buffer
             std::ifstream moduleReader(outputModule, std::ios::binary);
-            result.builtModuleData = std::vector<uint8_t>(std::istreambuf_iterator<char>(moduleReader), {});
+            result.builtModuleData = jenova::BuildBuffer(std::istreambuf_iterator<char>(moduleReader), {});
 
             // Validate Module Buffer
             if (result.builtModuleData.size() == 0)
@@ -1714,6 +1725,10 @@ namespace jenova
                 return result;
             }
 
+            // Create Extract Symbols Profiler Scope
+            linkScope.Stop();
+            JenovaTinyProfiler::ScopedTimer symbolExtractionScope("ExtractModuleSymbols");
+
             // Generate Function Information
             std::string funcInfoCmd = R"(-q -batch -ex "set logging file %FUNC_INFO_FILE%" -ex "set logging enabled" -ex "info functions" -ex "quit" "%BINARY%" > NUL)";
             jenova::ReplaceAllMatchesWithString(funcInfoCmd, "%FUNC_INFO_FILE%", AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + std::filesystem::path(outputMap).stem().string() + ".finfo");
@@ -1738,6 +1753,9 @@ namespace jenova
                 return result;
             }
 
+            // Close Extract Symbols Profiler Scope
+            symbolExtractionScope.Stop();
+
             // Generate Metadata
             result.moduleMetaData = JenovaInterpreter::GenerateModuleMetadata(outputMap, scriptModules, result);
             if (result.moduleMetaData.empty())
@@ -1901,6 +1919,7 @@ namespace jenova
             internalDefaultSettings["cpp_strip_symbol"]                     = false;                                // -Wl,--strip-all         
             internalDefaultSettings["cpp_statics_libs"]                     = "-static-libstdc++ -static-libgcc";   // Static Libraries
             internalDefaultSettings["cpp_extra_linker"]                     = "";                                   // Extra Linker Options 
+            internalDefaultSettings["cpp_satellite_module"]                 = false;                                // -Wl,-Bsymbolic
 
             // All Good
             return true;
@@ -1913,15 +1932,15 @@ namespace jenova
         }
         String PreprocessScript(Ref<CPPScript> cppScript, const Dictionary& preprocessorSettings)
         {
-            // Get Original Source Code
-            String scriptSourceCode = cppScript->get_source_code();
+            // Get Original Source Code [Speculative Compiles Pass Unsaved Editor Text]
+            String scriptSourceCode = preprocessorSettings.has("ScriptSourceCode") ? String(preprocessorSettings["ScriptSourceCode"]) : cppScript->get_source_code();
 
             // Reset Line Number
             scriptSourceCode = scriptSourceCode.insert(0, "#line 1\n");
 
             // Process And Extract Properties
             jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, cppScript->GetScriptIdentity());
-            if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
+            if (!propertiesMetadata.empty() && propertiesMetadata != "null" && !preprocessorSettings.has("SpeculativeCompile")) jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
 
             // Preprocessor Definitions [Header]
             String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
@@ -2002,45 +2021,6 @@ namespace jenova
                 return result;
             }
             
-            // Utilities
-            auto GeneratePreprocessDefinitions = [](const godot::String& defsSetting) -> std::string
-            {
-                std::string defs = AS_STD_STRING(defsSetting);
-                if (defs.empty()) return "";
-                if (defs.back() == ';') defs.pop_back();
-                std::vector<std::string> defsArray;
-                size_t start = 0;
-                size_t end = defs.find(';');
-                while (end != std::string::npos) {
-                    defsArray.push_back(defs.substr(start, end - start));
-                    start = end + 1;
-                    end = defs.find(';', start);
-                }
-                defsArray.push_back(defs.substr(start));
-                std::string result;
-                for (const auto& def : defsArray) result += "-D" + def + " ";
-                return result;
-            };
-            auto GenerateAdditionalIncludeDirectories = [](const godot::String& additionalDirs) -> std::string
-            {
-                std::string dirs = AS_STD_STRING(additionalDirs);
-                if (dirs.empty()) return "";
-                if (dirs.back() == ';') dirs.pop_back();
-                std::vector<std::string> dirArray;
-                size_t start = 0;
-                size_t end = dirs.find(';');
-                while (end != std::string::npos)
-                {
-                    dirArray.push_back(dirs.substr(start, end - start));
-                    start = end + 1;
-                    end = dirs.find(';', start);
-                }
-                dirArray.push_back(dirs.substr(start));
-                std::string result;
-                for (const auto& dir : dirArray) result += "-I" + dir + " ";
-                return result;
-            };
-
             // Load Cache if Exists
             bool buildCacheFileFound = false;
             jenova::json_t buildCacheDatabase;
@@ -2060,13 +2040,8 @@ namespace jenova
             // Parse Cache File
             try
             {
-                std::ifstream buildCacheDatabaseReader(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, std::ios::binary);
-                std::string buildCacheDatabaseContent(std::istreambuf_iterator<char>(buildCacheDatabaseReader), {});
-                if (!buildCacheDatabaseContent.empty())
-                {
-                    buildCacheDatabase = jenova::json_t::parse(buildCacheDatabaseContent);
-                    buildCacheFileFound = true;
-                }
+                // Parsed Database Stays Cached By Build Service Until File Changes
+                buildCacheFileFound = JenovaBuildService::LoadBuildCacheDatabase(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, buildCacheDatabase);
             }
             catch (const std::exception&)
             {
@@ -2085,7 +2060,7 @@ namespace jenova
                 for (const auto& cppHeaderFile : cppHeaderFiles)
                 {
                     String cppHeaderUID = jenova::GenerateStandardUIDFromPath(cppHeaderFile);
-                    String cppHeaderHash = jenova::GenerateMD5HashFromFile(cppHeaderFile);
+                    String cppHeaderHash = JenovaBuildService::GetFileHash(cppHeaderFile);
                     if (buildCacheDatabase["Headers"].contains(AS_STD_STRING(cppHeaderUID)))
                     {
                         if (AS_STD_STRING(cppHeaderHash) != buildCacheDatabase["Headers"][AS_STD_STRING(cppHeaderUID)].get<std::string>())
@@ -2111,56 +2086,55 @@ namespace jenova
             // Create Task List for Parallel Compilation
             std::vector<TaskID> taskIDs; size_t taskIndex = 0;
             std::vector<int> taskResults(scriptModulesContainer.scriptModules.size(), -1);
+            std::vector<std::tuple<const ScriptModule*, std::string, std::string>> taskObjects;
+            JenovaBuildService::FileStamp buildCacheStamp = JenovaBuildService::GetFileStamp(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile);
             for (const auto& scriptModule : scriptModulesContainer.scriptModules)
             {
-                // Skip If File Hash Didn't Change
+                // Generate Command for Each Script Module
+                std::string compilerArgument = GenerateCompileCommand(scriptModule, compilerSettings);
+
+                // Check If File Hash Didn't Change
+                bool matchesBuildCache = false;
                 if (buildCacheDatabase.contains("Modules"))
                 {
                     if (buildCacheDatabase["Modules"].contains(AS_STD_STRING(scriptModule.scriptUID)))
                     {
-                        if (AS_STD_STRING(scriptModule.scriptHash) == buildCacheDatabase["Modules"][AS_STD_STRING(scriptModule.scriptUID)].get<std::string>()) continue;
+                        matchesBuildCache = AS_STD_STRING(scriptModule.scriptHash) == buildCacheDatabase["Modules"][AS_STD_STRING(scriptModule.scriptUID)].get<std::string>();
                     }
                 }
 
-                // Generate Command for Each Script Module
-                std::string compilerArgument = AS_STD_STRING(String(compilerSettings["cpp_compiler_binary"]));
-
-                // Compile Without Linking
-                compilerArgument += " -c ";
-
-                // Language Standards
-                if (String(compilerSettings["cpp_language_standards"]) == "cpp20") compilerArgument += "-std=c++20 ";
-                if (String(compilerSettings["cpp_language_standards"]) == "cpp17") compilerArgument += "-std=c++17 ";
-
-                // Debug Symbols
-                if (bool(compilerSettings["cpp_debug_database"])) compilerArgument += "-g ";
-
-                // Dynamic Base
-                if (bool(compilerSettings["cpp_dynamic_base"])) compilerArgument += "-fPIC ";
-
-                // Extra Compiler Flags
-                compilerArgument += AS_STD_STRING(String(compilerSettings["cpp_extra_compiler"])) + " ";
-
-                // Preprocessor Definitions
-                compilerArgument += GeneratePreprocessDefinitions(compilerSettings["cpp_definitions"]);
-
-                // Include Paths
-                compilerArgument += "-I./ ";
-                compilerArgument += "-I\"" + this->includePath + "\" ";
-                compilerArgument += "-I\"" + this->jenovaSDKPath + "\" ";
-                compilerArgument += "-I\"" + this->godotSDKPath + "\" ";
-                compilerArgument += GenerateAdditionalIncludeDirectories(compilerSettings["cpp_extra_include_directories"]);
+                // Objects Newer Than Database Come From Speculative Compiles, Their Source May Differ
+                if (matchesBuildCache)
+                {
+                    JenovaBuildService::FileStamp objectStamp = JenovaBuildService::GetFileStamp(AS_STD_STRING(scriptModule.scriptObjectFile));
+                    matchesBuildCache = objectStamp.fileExists && objectStamp.writeTime <= buildCacheStamp.writeTime;
+                }
 
-                // Add Source File
-                compilerArgument += "\"" + AS_STD_STRING(scriptModule.scriptCacheFile) + "\" ";
+                // Skip If Object Is Still Valid [Build Service Knows Objects Compiled This Session, Including Speculative Ones]
+                std::string includeSignature;
+                JenovaBuildService::ObjectState objectState = JenovaBuildService::QueryObjectState(scriptModule, compilerArgument, includeSignature);
+                if (objectState == JenovaBuildService::ObjectState::Current)
+                {
+                    if (!matchesBuildCache) result.scriptsCount++;
+                    continue;
+                }
+                if (objectState == JenovaBuildService::ObjectState::Unknown && matchesBuildCache)
+                {
+                    JenovaBuildService::RecordObjectState(scriptModule, compilerArgument, includeSignature, true);
+                    continue;
+                }
 
-                // Specify Object File Output
-                compilerArgument += "-o \"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
+                // Create Compile Profiler Scope Name
+                const char* compileScopeName = JenovaTinyProfiler::IsTraceRecording() ? JenovaTinyProfiler::InternScopeName("Compile " + AS_STD_STRING(scriptModule.scriptFilename)) : "CompileTranslationUnit";
 
                 // Store Task Index for Results
                 size_t currentTaskIndex = taskIndex++;
-                taskIDs.push_back(JenovaTaskSystem::InitiateTask([compilerArgument, &taskResults, currentTaskIndex, scriptModule]()
+                taskObjects.push_back(std::make_tuple(&scriptModule, compilerArgument, includeSignature));
+                taskIDs.push_back(JenovaTaskSystem::InitiateTask([compilerArgument, compileScopeName, &taskResults, currentTaskIndex, scriptModule]()
                 {
+                    // Create Compile Profiler Scope
+                    JenovaTinyProfiler::ScopedTimer compileScope(compileScopeName);
+
                     // Run the compiler command using a process and capture its output
                     int pipefd[2];
                     if (pipe(pipefd) == -1)
@@ -2267,6 +2241,13 @@ namespace jenova
                 JenovaTaskSystem::ClearTask(taskID);
             }
 
+            // Record Compiled Objects
+            for (size_t i = 0; i < taskObjects.size(); i++)
+            {
+                const auto& [scriptModule, compilerArgument, includeSignature] = taskObjects[i];
+                JenovaBuildService::RecordObjectState(*scriptModule, compilerArgument, includeSignature, taskResults[i] == 0);
+            }
+
             // Aggregate Results
             for (size_t i = 0; i < taskResults.size(); i++)
             {
@@ -2391,6 +2372,15 @@ namespace jenova
             // Strip Symbols
             if (bool(linkerSettings["cpp_strip_symbol"])) linkerArgument += "-Wl,--strip-all ";
 
+            // Symbol Binding [Lazy Modes Must Not Be Overridden by DF_BIND_NOW]
+            bool lazySymbolBinding = jenova::GlobalStorage::ModuleSymbolBinding == jenova::ModuleSymbolBinding::LazyGlobal || jenova::GlobalStorage::ModuleSymbolBinding == jenova::ModuleSymbolBinding::LazyLocal;
+            linkerArgument += lazySymbolBinding ? "-Wl,-z,lazy " : "-Wl,-z,now ";
+            linkerArgument += "-Wl,--hash-style=gnu ";
+
+            // Satellite Modules Bind Their Own Definitions First [Core Module Has Duplicates]
+            bool isSatelliteModule = bool(linkerSettings.get("cpp_satellite_module", false));
+            if (isSatelliteModule) linkerArgument += "-Wl,-Bsymbolic ";
+
             // Add Dependency Path
             linkerArgument += "-Wl,-rpath,./Jenova ";
 
@@ -2405,6 +2395,9 @@ namespace jenova
             // Dump Linker Command If Developer Mode Enabled
             if (jenova::GlobalStorage::DeveloperModeActivated) jenova::WriteStdStringToFile(this->jenovaCachePath + "LinkerCommand.txt", linkerArgument);
 
+            // Create Link Profiler Scope
+            JenovaTinyProfiler::ScopedTimer linkScope("LinkModule");
+
             // Run Linker Command Using Process Management
             int pipefd[2];
             if (pipe(pipefd) == -1)
@@ -2494,7 +2487,7 @@ namespace jenova
 
             // Read Module to Buffer
             std::ifstream moduleReader(outputModule, std::ios::binary);
-            result.builtModuleData = std::vector<uint8_t>(std::istreambuf_iterator<char>(moduleReader), {});
+            result.builtModuleData = jenova::BuildBuffer(std::istreambuf_iterator<char>(moduleReader), {});
 
             // Validate Module Buffer
             if (result.builtModuleData.empty())
@@ -2505,6 +2498,10 @@ namespace jenova
                 return result;
             }
 
+            // Create Extract Symbols Profiler Scope
+            linkScope.Stop();
+            JenovaTinyProfiler::ScopedTimer symbolExtractionScope("ExtractModuleSymbols");
+
             // Generate Function Information
             std::string funcInfoCmd = R"(gdb -q -batch -ex "set logging file "%FUNC_INFO_FILE%"" -ex "set logging on" -ex "info functions" -ex "quit" "%BINARY%" > /dev/null 2>&1)";
             jenova::ReplaceAllMatchesWithString(funcInfoCmd, "%FUNC_INFO_FILE%", AS_STD_STRING(jenova::GetJenovaCacheDirectory()) + std::filesystem::path(outputMap).stem().string() + ".finfo");
@@ -2529,6 +2526,9 @@ namespace jenova
                 return result;
             }
 
+            // Close Extract Symbols Profiler Scope
+            symbolExtractionScope.Stop();
+
             // Generate Metadata
             result.moduleMetaData = JenovaInterpreter::GenerateModuleMetadata(outputMap, scriptModules, result);
             if (result.moduleMetaData.empty())
@@ -2539,6 +2539,9 @@ namespace jenova
                 return result;
             }
 
+            // Satellite Modules Don't Update Build Cache [Full Link Follows]
+            if (isSatelliteModule) return result;
+
             // Generate Build Cache
             if (!jenova::CreateBuildCacheDatabase(this->jenovaCachePath + jenova::GlobalSettings::JenovaBuildCacheDatabaseFile, scriptModules, linkerSettings["CppHeaderFiles"]))
             {
@@ -2551,6 +2554,88 @@ namespace jenova
             // Return Final Result
             return result;
         }
+        std::string GenerateCompileCommand(const ScriptModule& scriptModule, const Dictionary& compilerSettings)
+        {
+            // Utilities
+            auto GeneratePreprocessDefinitions = [](const godot::String& defsSetting) -> std::string
+            {
+                std::string defs = AS_STD_STRING(defsSetting);
+                if (defs.empty()) return "";
+                if (defs.back() == ';') defs.pop_back();
+                std::vector<std::string> defsArray;
+                size_t start = 0;
+                size_t end = defs.find(';');
+                while (end != std::string::npos) {
+                    defsArray.push_back(defs.substr(start, end - start));
+                    start = end + 1;
+                    end = defs.find(';', start);
+                }
+                defsArray.push_back(defs.substr(start));
+                std::string result;
+                for (const auto& def : defsArray) result += "-D" + def + " ";
+                return result;
+            };
+            auto GenerateAdditionalIncludeDirectories = [](const godot::String& additionalDirs) -> std::string
+            {
+                std::string dirs = AS_STD_STRING(additionalDirs);
+                if (dirs.empty()) return "";
+                if (dirs.back() == ';') dirs.pop_back();
+                std::vector<std::string> dirArray;
+                size_t start = 0;
+                size_t end = dirs.find(';');
+                while (end != std::string::npos)
+                {
+                    dirArray.push_back(dirs.substr(start, end - start));
+                    start = end + 1;
+                    end = dirs.find(';', start);
+                }
+                dirArray.push_back(dirs.substr(start));
+                std::string result;
+                for (const auto& dir : dirArray) result += "-I" + dir + " ";
+                return result;
+            };
+
+            // Compiler Binary
+            std::string compilerArgument = AS_STD_STRING(String(compilerSettings["cpp_compiler_binary"]));
+
+            // Compile Without Linking
+            compilerArgument += " -c ";
+
+            // Language Standards
+            if (String(compilerSettings["cpp_language_standards"]) == "cpp20") compilerArgument += "-std=c++20 ";
+            if (String(compilerSettings["cpp_language_standards"]) == "cpp17") compilerArgument += "-std=c++17 ";
+
+            // Debug Symbols
+            if (bool(compilerSettings["cpp_debug_database"])) compilerArgument += "-g ";
+
+            // Dynamic Base
+            if (bool(compilerSettings["cpp_dynamic_base"])) compilerArgument += "-fPIC ";
+
+            // Keep Frame Pointers For Native Sampling Profiler
+            if (jenova::GlobalStorage::UseNativeSamplingProfiler) compilerArgument += "-fno-omit-frame-pointer ";
+
+            // Extra Compiler Flags
+            compilerArgument += AS_STD_STRING(String(compilerSettings["cpp_extra_compiler"])) + " ";
+
+            // Preprocessor Definitions
+            compilerArgument += GeneratePreprocessDefinitions(compilerSettings["cpp_definitions"]);
+
+            // Include Paths
+            compilerArgument += "-I./ ";
+            compilerArgument += "-I\"" + this->includePath + "\" ";
+            compilerArgument += "-I\"" + this->jenovaSDKPath + "\" ";
+            compilerArgument += "-I\"" + this->godotSDKPath + "\" ";
+            compilerArgument += GenerateAdditionalIncludeDirectories(compilerSettings["cpp_extra_include_directories"]);
+
+            // Add Source File
+            compilerArgument += "\"" + AS_STD_STRING(scriptModule.scriptCacheFile) + "\" ";
+
+            // Specify Object File Output
+            compilerArgument += "-o \"" + AS_STD_STRING(scriptModule.scriptObjectFile) + "\" ";
+
+            // Return Command
+            return compilerArgument;
+        }
         bool SetCompilerOption(const String& optName, const Variant& optValue)
         {
             internalDefaultSettings[optName] = optValue;
@@ -2568,6 +2653,14 @@ namespace jenova
             {
                 return SolveCompilerSettings(internalDefaultSettings);
             }
+            if (commandName == "Generate-Compile-Command")
+            {
+                if (!SolveCompilerSettings(internalDefaultSettings)) return Variant::NIL;
+                ScriptModule scriptModule;
+                scriptModule.scriptCacheFile = commandSettings["ScriptCacheFile"];
+                scriptModule.scriptObjectFile = commandSettings["ScriptObjectFile"];
+                return String(GenerateCompileCommand(scriptModule, internalDefaultSettings).c_str());
+            }
 
             // Invalid Command
             return Variant::NIL;
@@ -2662,15 +2755,15 @@ namespace jenova
         }
         String PreprocessScript(Ref<CPPScript> cppScript, const Dictionary& preprocessorSettings) override
         {
-           // Get Original Source Code
-            String scriptSourceCode = cppScript->get_source_code();
+           // Get Original Source Code [Speculative Compiles Pass Unsaved Editor Text]
+            String scriptSourceCode = preprocessorSettings.has("ScriptSourceCode") ? String(preprocessorSettings["ScriptSourceCode"]) : cppScript->get_source_code();
 
             // Reset Line Number
             scriptSourceCode = scriptSourceCode.insert(0, "#line 1\n");
 
             // Process And Extract Properties
             jenova::SerializedData propertiesMetadata = jenova::ProcessAndExtractPropertiesFromScript(scriptSourceCode, cppScript->GetScriptIdentity());
-            if (!propertiesMetadata.empty() && propertiesMetadata != "null") jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
+            if (!propertiesMetadata.empty() && propertiesMetadata != "null" && !preprocessorSettings.has("SpeculativeCompile")) jenova::WriteStdStringToFile(AS_STD_STRING(String(preprocessorSettings["PropertyMetadata"])), propertiesMetadata);
 
             // Preprocessor Definitions [Header]
             String preprocessorDefinitions = "// Jenova Preprocessor Definitions\n";
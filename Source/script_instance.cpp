@@ -115,7 +115,7 @@ static const jenova::FunctionList godot_functions =
 bool CPPScriptInstance::set(const StringName &p_name, const Variant &p_value) 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "Setting Property (%s)...", AS_C_STRING(p_name));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "Setting Property (%s)...", AS_C_STRING(p_name));
 
 	// Set Embedded Source [Internal]
 	if (p_name == StringName("cpp/source_code") && script.is_valid() && script->is_built_in())
@@ -149,7 +149,7 @@ bool CPPScriptInstance::set(const StringName &p_name, const Variant &p_value)
 bool CPPScriptInstance::get(const StringName &p_name, Variant &r_ret) const
  {
 	// Remove
-	jenova::VerboseByID(__LINE__, "Getting Property (%s)...", AS_C_STRING(p_name));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "Getting Property (%s)...", AS_C_STRING(p_name));
 
 	// Get Script
 	if (p_name == StringName("script")) 
@@ -189,7 +189,7 @@ bool CPPScriptInstance::get(const StringName &p_name, Variant &r_ret) const
 }
 godot::String CPPScriptInstance::to_string(bool *r_is_valid) 
 {
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::to_string");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::to_string");
 	*r_is_valid = true;
 	return String(jenova::Format("<JenovaScript:%s>", AS_C_STRING(get_identity())).c_str());
 }
@@ -206,11 +206,10 @@ Variant CPPScriptInstance::callp(const StringName &p_method, const Variant **p_a
 		return Variant();
 	}
 
-	// Verbose Call
-	String script_name = this->script->get_path().get_file();
-	String owner_name = godot::Object::cast_to<godot::Node>(this->owner)->get_name();
-	jenova::VerboseByID(__LINE__, "Executing Script (%s | %s)[%s][%d] from (%s | %p) ...", 
-		AS_C_STRING(script_name), AS_C_STRING(scriptInstanceIdentity), AS_C_STRING(p_method), p_argument_count,AS_C_STRING(owner_name), this->instance);
+	// Verbose Call [Arguments Are Only Evaluated When Verbose Is Enabled, Owner May Not Be a Node]
+	JENOVA_VERBOSE_BY_ID(__LINE__, "Executing Script (%s | %s)[%s][%d] from (%s | %p) ...", 
+		AS_C_STRING(this->script->get_path().get_file()), AS_C_STRING(scriptInstanceIdentity), AS_C_STRING(p_method), p_argument_count,
+		godot::Object::cast_to<godot::Node>(this->owner) ? AS_C_STRING(godot::Object::cast_to<godot::Node>(this->owner)->get_name()) : "Unknown", this->instance);
 
 	// Handle Internal Methods
 	if (p_method == StringName("_get_editor_name"))
@@ -253,8 +252,7 @@ Variant CPPScriptInstance::callp(const StringName &p_method, const Variant **p_a
 
 	// Call to Interpreter
 	bool hasMethod = false;
-	jenova::FunctionList jenovaMethods = JenovaInterpreter::GetFunctionsList(AS_STD_STRING(scriptInstanceIdentity));
-	for (auto& function : jenovaMethods)
+	for (auto& function : instanceMethods)
 	{
 		if (p_method == StringName(function.c_str()))
 		{
@@ -285,6 +283,7 @@ Variant CPPScriptInstance::callp(const StringName &p_method, const Variant **p_a
 						return Variant();
 					}
 					instanceProperties[instancePropertiesKeys[i]] = variantValue;
+					JenovaRuntimeCounters::Increment(JenovaRuntimeCounters::Counter::PropertiesMarshalled);
 				}
 			}
 		}
@@ -301,7 +300,7 @@ Variant CPPScriptInstance::callp(const StringName &p_method, const Variant **p_a
 void CPPScriptInstance::update_methods() const 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::update_methods (%s)", AS_C_STRING(scriptInstanceIdentity));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::update_methods (%s)", AS_C_STRING(scriptInstanceIdentity));
 
 	// Validate Script
 	if (script.is_null()) return;
@@ -317,7 +316,7 @@ void CPPScriptInstance::update_methods() const
 const GDExtensionMethodInfo* CPPScriptInstance::get_method_list(uint32_t *r_count) const 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::get_method_list (%s)", AS_C_STRING(scriptInstanceIdentity));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::get_method_list (%s)", AS_C_STRING(scriptInstanceIdentity));
 
 	// Validate Script
 	if (script.is_null()) 
@@ -339,7 +338,7 @@ const GDExtensionMethodInfo* CPPScriptInstance::get_method_list(uint32_t *r_coun
 	}
 
 	// Remove
-	jenova::VerboseByID(__LINE__, "Method List returned %d functions", size);
+	JENOVA_VERBOSE_BY_ID(__LINE__, "Method List returned %d functions", size);
 
 	// Return Methods
 	*r_count = size;
@@ -348,7 +347,7 @@ const GDExtensionMethodInfo* CPPScriptInstance::get_method_list(uint32_t *r_coun
 void CPPScriptInstance::free_method_list(const GDExtensionMethodInfo* p_list, uint32_t p_count) const
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::free_method_list");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::free_method_list");
 
 	if (p_list) memdelete_arr(p_list);
 }
@@ -397,7 +396,7 @@ const GDExtensionPropertyInfo* CPPScriptInstance::get_property_list(uint32_t *r_
 }
 void CPPScriptInstance::free_property_list(const GDExtensionPropertyInfo *p_list, uint32_t p_count) const 
 {
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::free_property_list");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::free_property_list");
 	if (p_list)
 	{
 		int size = memnew_ptr_size<GDExtensionPropertyInfo>(p_list);
@@ -407,7 +406,7 @@ void CPPScriptInstance::free_property_list(const GDExtensionPropertyInfo *p_list
 }
 Variant::Type CPPScriptInstance::get_property_type(const StringName &p_name, bool *r_is_valid) const 
 {
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::get_property_type");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::get_property_type");
 
 	// Handle Internal Properties
 	if (p_name == StringName("cpp/source_code"))
@@ -434,14 +433,14 @@ Variant::Type CPPScriptInstance::get_property_type(const StringName &p_name, boo
 void CPPScriptInstance::get_property_state(GDExtensionScriptInstancePropertyStateAdd p_add_func, void *p_userdata) 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::get_property_state");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::get_property_state");
 
 	p_add_func = AddState; // Needs Investigation
 }
 bool CPPScriptInstance::validate_property(GDExtensionPropertyInfo &p_property) const 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::validate_property %s", AS_C_STRING(*(StringName*)p_property.name));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::validate_property %s", AS_C_STRING(*(StringName*)p_property.name));
 
 	// Verify & Get Property Name
 	if (!p_property.name) return false;
@@ -467,7 +466,7 @@ bool CPPScriptInstance::validate_property(GDExtensionPropertyInfo &p_property) c
 bool CPPScriptInstance::has_method(const StringName &p_name) const 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::has_method (%s) [%s]", AS_C_STRING(scriptInstanceIdentity), AS_C_STRING(p_name));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::has_method (%s) [%s]", AS_C_STRING(scriptInstanceIdentity), AS_C_STRING(p_name));
 
 	// Validate Script
 	if (!script.is_valid()) return false;
@@ -503,20 +502,20 @@ bool CPPScriptInstance::has_method(const StringName &p_name) const
 	}
 
 	// Temp Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::has_method (%s) [%s] returned %s", AS_C_STRING(scriptInstanceIdentity), AS_C_STRING(p_name), result ? "TRUE" : "FALSE");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::has_method (%s) [%s] returned %s", AS_C_STRING(scriptInstanceIdentity), AS_C_STRING(p_name), result ? "TRUE" : "FALSE");
 	return result;
 }
 int CPPScriptInstance::get_method_argument_count(const StringName& p_method, bool* r_is_valid) const
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::get_method_argument_count");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::get_method_argument_count");
 	*r_is_valid = false;
 	return 0;
 }
 bool CPPScriptInstance::property_can_revert(const StringName &p_name) const 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::property_can_revert");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::property_can_revert");
 
 	// Handle Interpreted Properties
 	auto propContainer = JenovaInterpreter::GetPropertyContainer(AS_STD_STRING(this->scriptInstanceIdentity));
@@ -531,7 +530,7 @@ bool CPPScriptInstance::property_can_revert(const StringName &p_name) const
 bool CPPScriptInstance::property_get_revert(const StringName &p_name, Variant &r_ret) const 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::property_get_revert");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::property_get_revert");
 
 	// Handle Interpreted Properties
 	auto propContainer = JenovaInterpreter::GetPropertyContainer(AS_STD_STRING(this->scriptInstanceIdentity));
@@ -550,14 +549,14 @@ bool CPPScriptInstance::property_get_revert(const StringName &p_name, Variant &r
 void CPPScriptInstance::refcount_incremented() 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::refcount_incremented");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::refcount_incremented");
 
 	refCount++;
 }
 bool CPPScriptInstance::refcount_decremented() 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::refcount_decremented");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::refcount_decremented");
 
 	refCount--;
 	return false;
@@ -565,34 +564,34 @@ bool CPPScriptInstance::refcount_decremented()
 Object* CPPScriptInstance::get_owner() 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::get_owner");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::get_owner");
 
 	return owner;
 }
 Ref<Script> CPPScriptInstance::get_script() const 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::get_script");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::get_script");
 	return script;
 }
 bool CPPScriptInstance::is_placeholder() const 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::is_placeholder");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::is_placeholder");
 
 	return false;
 }
 void CPPScriptInstance::property_set_fallback(const StringName &p_name, const Variant &p_value, bool *r_valid) 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::property_set_fallback");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::property_set_fallback");
 
 	*r_valid = false;
 }
 Variant CPPScriptInstance::property_get_fallback(const StringName &p_name, bool *r_valid) 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::property_get_fallback");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::property_get_fallback");
 
 	*r_valid = false;
 	return Variant::NIL;
@@ -600,7 +599,7 @@ Variant CPPScriptInstance::property_get_fallback(const StringName &p_name, bool
 ScriptLanguage* CPPScriptInstance::_get_language() 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::_get_language");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::_get_language");
 
 	return CPPScriptLanguage::get_singleton();
 }
@@ -608,36 +607,74 @@ String CPPScriptInstance::get_identity()
 {
 	return scriptInstanceIdentity;
 }
+void CPPScriptInstance::migrate_module_generation()
+{
+	// Move Generation Pin to Active Module
+	jenova::ModuleGenerationRef previousGeneration = moduleGeneration;
+	moduleGeneration = JenovaInterpreter::AcquireModuleGeneration(AS_STD_STRING(scriptInstanceIdentity));
+	JenovaInterpreter::ReleaseModuleGeneration(previousGeneration);
+
+	// Migrate Property Values by Name and Type
+	auto propContainer = JenovaInterpreter::GetPropertyContainer(AS_STD_STRING(this->scriptInstanceIdentity));
+	Array instancePropertiesKeys = instanceProperties.keys();
+	for (size_t i = 0; i < instancePropertiesKeys.size(); i++)
+	{
+		bool isMigrated = false;
+		for (size_t p = 0; p < propContainer.scriptProperties.size(); p++)
+		{
+			const jenova::ScriptProperty& scriptProperty = propContainer.scriptProperties[p];
+			if (StringName(instancePropertiesKeys[i]) != scriptProperty.propertyInfo.name) continue;
+			if (instanceProperties[instancePropertiesKeys[i]].get_type() != scriptProperty.propertyInfo.type)
+			{
+				instanceProperties[instancePropertiesKeys[i]] = scriptProperty.defaultValue;
+			}
+			isMigrated = true;
+			break;
+		}
+		if (!isMigrated) instanceProperties.erase(instancePropertiesKeys[i]);
+	}
+
+	// Re-Point Method Cache
+	instanceMethods = JenovaInterpreter::GetFunctionsList(AS_STD_STRING(scriptInstanceIdentity));
+	update_methods();
+}
 
 // C++ Script Instance Initializer/Destructor
 CPPScriptInstance::CPPScriptInstance(Object *p_owner, const Ref<CPPScript> p_script) :
 		owner(p_owner), script(p_script) 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::CPPScriptInstance");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::CPPScriptInstance");
 
 	// Validate Script Object
 	if (p_script.is_null() || !p_script.is_valid())
 	{
-		jenova::VerboseByID(__LINE__, "ERROR : Null Script Passed to Instance.");
+		JENOVA_VERBOSE_BY_ID(__LINE__, "ERROR : Null Script Passed to Instance.");
 		return;
 	}
 
 	// Verbose Creation
 	godot::Node* parentNode = godot::Object::cast_to<godot::Node>(p_owner);
-	jenova::VerboseByID(__LINE__, "Creating Script Instance from (%s) Owner : %s", AS_C_STRING(p_script.ptr()->get_name()), AS_C_STRING(parentNode->get_name()));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "Creating Script Instance from (%s) Owner : %s", AS_C_STRING(p_script.ptr()->get_name()), AS_C_STRING(parentNode->get_name()));
 
 	// Generate Script Identifier Hash
 	scriptInstanceIdentity = jenova::GenerateStandardUIDFromPath(p_script.ptr());
 
 	// Register Script Instance to Manager
 	JenovaScriptManager::get_singleton()->add_script_instance(this);
+
+	// Keep Current Module Generation Alive While Instance Exists
+	moduleGeneration = JenovaInterpreter::AcquireModuleGeneration(AS_STD_STRING(scriptInstanceIdentity));
+	instanceMethods = JenovaInterpreter::GetFunctionsList(AS_STD_STRING(scriptInstanceIdentity));
 }
 CPPScriptInstance::~CPPScriptInstance() 
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "CPPScriptInstance::~CPPScriptInstance (%s)", AS_C_STRING(this->get_identity()));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScriptInstance::~CPPScriptInstance (%s)", AS_C_STRING(this->get_identity()));
 
 	// Register Script Instance to Manager
 	JenovaScriptManager::get_singleton()->remove_script_instance(this);
+
+	// Release Module Generation
+	JenovaInterpreter::ReleaseModuleGeneration(moduleGeneration);
 }
\ No newline at end of file
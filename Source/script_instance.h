@@ -26,6 +26,8 @@ protected:
 	mutable List<MethodInfo> methodsInfo;
 	size_t refCount = 0;
 	String scriptInstanceIdentity = "";
+	jenova::ModuleGenerationRef moduleGeneration = nullptr;
+	jenova::FunctionList instanceMethods;
 	bool isDeleting = false;
 
 private:
@@ -61,6 +63,7 @@ public:
 public:
 	// Methods
 	String get_identity();
+	void migrate_module_generation();
 
 	// Initializer/Destructor
 	CPPScriptInstance(Object* p_owner, const Ref<CPPScript> p_script);
@@ -94,6 +94,9 @@ bool JenovaInterpreter::LoadModule(const uint8_t* moduleDataPtr, const size_t mo
     // Check If A Module Is Already Loaded
     if (moduleBaseAddress) return false;
 
+    // Create Profiler Scope
+    JENOVA_PROFILE_SCOPE("ModuleLoad");
+
     // Update Metadata And Configuration
     if (!JenovaInterpreter::UpdateConfigurationsFromMetaData(metaData))
     {
@@ -104,12 +107,24 @@ bool JenovaInterpreter::LoadModule(const uint8_t* moduleDataPtr, const size_t mo
     // Create Loader Flags
     jenova::LoaderFlags loaderFlags = 0;
     if (executeInDebugMode && !QUERY_ENGINE_MODE(Editor)) loaderFlags |= jenova::LoaderFlag::LoadInDebugMode;
+    if (moduleSymbolBinding == jenova::ModuleSymbolBinding::LazyGlobal || moduleSymbolBinding == jenova::ModuleSymbolBinding::LazyLocal) loaderFlags |= jenova::LoaderFlag::LazySymbolBinding;
+    if (moduleSymbolBinding == jenova::ModuleSymbolBinding::ImmediateLocal || moduleSymbolBinding == jenova::ModuleSymbolBinding::LazyLocal) loaderFlags |= jenova::LoaderFlag::LocalSymbolScope;
+
+    // Attach Native Sampling Profiler And Publish Symbols to Perf Map [Runs Before Loader Unmaps Image Decoded In Place]
+    auto inspectModuleImage = [&](jenova::ModuleHandle loadedModuleHandle)
+    {
+        jenova::ModuleAddress loadedBaseAddress = JenovaLoader::GetModuleBaseAddress(loadedModuleHandle);
+        if (jenova::GlobalStorage::UseNativeSamplingProfiler) JenovaSamplingProfiler::AttachModule(moduleDataPtr, moduleSize, loadedBaseAddress, moduleMetaData);
+        if (JenovaPerfMap::IsOpen()) JenovaPerfMap::WriteModuleSymbols(moduleDataPtr, moduleSize, loadedBaseAddress, moduleMetaData);
+    };
 
     // Load And Map Module to Memory
+    JenovaTinyProfiler::CreateCheckpoint("JenovaModuleBoot");
+    JenovaTinyProfiler::CreateCheckpoint("JenovaModuleBootStage");
     if (hasDebugInformation)
     {
         // Load Module As Virtual
-        moduleHandle = JenovaLoader::LoadModuleAsVirtual((void*)moduleDataPtr, moduleSize, "Jenova.Module.dll", moduleDiskPath.c_str(), loaderFlags);
+        moduleHandle = JenovaLoader::LoadModuleAsVirtual((void*)moduleDataPtr, moduleSize, "Jenova.Module.dll", moduleDiskPath.c_str(), loaderFlags, inspectModuleImage);
 
         // Load Debug Symbol If MSE Disabled
         if (!jenova::GlobalStorage::UseManagedSafeExecution)
@@ -120,13 +135,16 @@ bool JenovaInterpreter::LoadModule(const uint8_t* moduleDataPtr, const size_t mo
     else
     {
         // Load Module As Regular
-        moduleHandle = JenovaLoader::LoadModule((void*)moduleDataPtr, moduleSize, loaderFlags);
+        moduleHandle = JenovaLoader::LoadModule((void*)moduleDataPtr, moduleSize, loaderFlags, inspectModuleImage);
     }
     if (!moduleHandle) return false;
 
     // Get Module Base Address
     moduleBaseAddress = JenovaLoader::GetModuleBaseAddress(moduleHandle);
     if (!moduleBaseAddress) return false;
+    moduleGeneration = JenovaLoader::GetModuleGeneration(moduleHandle);
+    JenovaMemoryTracker::TrackPointer(jenova::MemoryTag::ModuleImages, moduleHandle, moduleSize);
+    moduleBootStatistics.loaderTime = JenovaTinyProfiler::GetCheckpointTimeAndRestart("JenovaModuleBootStage");
 
     // Update Property Storage From Metadata
     if (!JenovaInterpreter::UpdatePropertyStorageFromMetaData())
@@ -141,6 +159,7 @@ bool JenovaInterpreter::LoadModule(const uint8_t* moduleDataPtr, const size_t mo
         jenova::Error("Jenova Interpreter", "Failed to Resolve and Load Addon Modules.");
         return false;
     }
+    moduleBootStatistics.addonsTime = JenovaTinyProfiler::GetCheckpointTimeAndRestart("JenovaModuleBootStage");
 
     // Solve Functions Inside Module
     if(!jenova::InitializeExtensionModule("InitializeJenovaModule", moduleHandle, jenova::ModuleCallMode::Virtual))
@@ -148,12 +167,22 @@ bool JenovaInterpreter::LoadModule(const uint8_t* moduleDataPtr, const size_t mo
         jenova::Error("Jenova Interpreter", "Failed to Initialize Jenova Module API Solver.");
         return false;
     }
+    moduleBootStatistics.initializerTime = JenovaTinyProfiler::GetCheckpointTimeAndRestart("JenovaModuleBootStage");
 
     // Call Module Boot Event If Exists
-    if (!jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleBootEventName, moduleHandle, jenova::ModuleCallMode::Virtual))
+    bool bootEventResult = false;
     {
-        jenova::Warning("Jenova Interpreter", "Module Boot Event Failed. Unexpected Behaviors May Occur.");
+        JENOVA_PROFILE_SCOPE("JenovaBoot");
+        bootEventResult = jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleBootEventName, moduleHandle, jenova::ModuleCallMode::Virtual);
     }
+    if (!bootEventResult) jenova::Warning("Jenova Interpreter", "Module Boot Event Failed. Unexpected Behaviors May Occur.");
+    moduleBootStatistics.bootEventTime = JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaModuleBootStage");
+    moduleBootStatistics.totalTime = JenovaTinyProfiler::GetCheckpointTimeAndDispose("JenovaModuleBoot");
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Jenova Module Booted In %.3f ms (Loader : %.3f ms | Addons : %.3f ms | Initializer : %.3f ms | Boot Event : %.3f ms)",
+        moduleBootStatistics.totalTime, moduleBootStatistics.loaderTime, moduleBootStatistics.addonsTime, moduleBootStatistics.initializerTime, moduleBootStatistics.bootEventTime);
+
+    // Migrate Live Script Instances to New Generation
+    JenovaInterpreter::MigrateScriptInstances();
 
     // Enable Execution
     allowExecution = true;
@@ -170,11 +199,59 @@ bool JenovaInterpreter::ReloadModule(const uint8_t* moduleDataPtr, const size_t
     // Reload Not Supported In Debug Mode
     if (executeInDebugMode) return false;
 
-    // Unload Module
-    if (!UnloadModule(jenova::ModuleUnloadStage::UnloadModuleToReload)) return false;
+    // Start Measuring Reload Latency
+    auto reloadStartTime = std::chrono::steady_clock::now();
+
+    // Shutdown Active Generation But Keep Its Image Mapped
+    if (!UnloadModule(jenova::ModuleUnloadStage::UnloadModuleToMigrate)) return false;
+    jenova::ModuleHandle previousModuleHandle = moduleHandle;
+    jenova::ModuleAddress previousModuleBaseAddress = moduleBaseAddress;
+    jenova::ModuleGenerationRef previousModuleGeneration = moduleGeneration;
+    jenova::SerializedData previousMetaData = moduleMetaData.dump();
+    moduleHandle = nullptr;
+    moduleBaseAddress = 0;
+    moduleGeneration = nullptr;
+
+    // Load New Generation Alongside Previous One
+    if (!LoadModule(moduleDataPtr, moduleSize, metaData))
+    {
+        // Release Partially Loaded Generation
+        if (moduleHandle)
+        {
+            JenovaLoader::ReleaseModule(moduleHandle);
+            JenovaMemoryTracker::UntrackPointer(jenova::MemoryTag::ModuleImages, moduleHandle);
+        }
+
+        // Roll Back to Previous Generation
+        moduleHandle = previousModuleHandle;
+        moduleBaseAddress = previousModuleBaseAddress;
+        moduleGeneration = previousModuleGeneration;
+        JenovaInterpreter::UpdateConfigurationsFromMetaData(previousMetaData);
+        JenovaInterpreter::UpdatePropertyStorageFromMetaData();
+        jenova::CallModuleEvent(jenova::GlobalSettings::JenovaModuleBootEventName, moduleHandle, jenova::ModuleCallMode::Virtual);
+        allowExecution = true;
+        jenova::Error("Jenova Interpreter", "Failed to Load New Module Generation, Previous Generation Restored.");
+        return false;
+    }
 
-    // Load Module
-    return LoadModule(moduleDataPtr, moduleSize, metaData);
+    // Retire Previous Generation [Unloaded Once No Call Frame or Instance References It]
+    JenovaLoader::ReleaseModule(previousModuleHandle);
+    JenovaMemoryTracker::UntrackPointer(jenova::MemoryTag::ModuleImages, previousModuleHandle);
+
+    // Record Reload Statistics
+    JenovaRuntimeCounters::Increment(JenovaRuntimeCounters::Counter::ModuleReloads);
+    auto reloadEndTime = std::chrono::steady_clock::now();
+    lastReloadLatency = std::chrono::duration<double, std::milli>(reloadEndTime - reloadStartTime).count();
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Jenova Module Reloaded In %.3f ms", lastReloadLatency);
+
+    // Dropped Frames Are Counted On Presented Frames Overlapping The Reload [See CollectReloadFrame]
+    lastReloadDroppedFrames = 0;
+    reloadWindowStart = reloadStartTime;
+    reloadWindowEnd = reloadEndTime;
+    isCountingReloadFrames = true;
+
+    // All Good
+    return true;
 }
 bool JenovaInterpreter::ReloadModule(const jenova::BuildResult& buildResult)
 {
@@ -185,6 +262,13 @@ bool JenovaInterpreter::UnloadModule(const jenova::ModuleUnloadStage& unloadStag
     // Adjust Agressive Mode [Disable For All For Now]
     JenovaLoader::SetAgressiveMode(!(QUERY_ENGINE_MODE(Editor) || QUERY_ENGINE_MODE(Debug) || QUERY_ENGINE_MODE(Runtime)));
 
+    // Detach Native Sampling Profiler And Write Profile
+    if (JenovaSamplingProfiler::IsSampling())
+    {
+        std::string nativeProfileDirectory = AS_STD_STRING(jenova::GetJenovaCacheDirectory());
+        if (JenovaSamplingProfiler::DetachModule(nativeProfileDirectory)) jenova::Output("Native Profile Recorded : [color=#70a9d4]%s%s[/color]", nativeProfileDirectory.c_str(), jenova::GlobalSettings::JenovaNativeProfileFlameGraphFile);
+    }
+
     // Flush Property Storage
     if (!JenovaInterpreter::FlushPropertyStorage())
     {
@@ -198,8 +282,25 @@ bool JenovaInterpreter::UnloadModule(const jenova::ModuleUnloadStage& unloadStag
         jenova::Warning("Jenova Interpreter", "Module Shutdown Event Failed. Unexpected Behaviors May Occur.");
     }
 
+    // Release Named Arenas Owned By Unloading Generation
+    JenovaArenaAllocator::ReleaseNamedArenas();
+
+    // Retire Satellite Modules [New Core Module Contains All Scripts]
+    if (unloadStage != jenova::ModuleUnloadStage::UnloadModuleToShutdown) JenovaInterpreter::ReleaseSatelliteModules();
+
     // If Debug Mode is Activated Unload Module Loaded From Disk
-    if (executeInDebugMode) return jenova::ReleaseTemporaryModuleCache();
+    if (executeInDebugMode)
+    {
+        JenovaMemoryTracker::UntrackPointer(jenova::MemoryTag::ModuleImages, moduleHandle);
+        return jenova::ReleaseTemporaryModuleCache();
+    }
+
+    // If Unload Stage is Migration Keep Module Mapped for Reload
+    if (unloadStage == jenova::ModuleUnloadStage::UnloadModuleToMigrate)
+    {
+        allowExecution = false;
+        return true;
+    }
 
     // If Unload Stage is at Shutdown Leave Unloading to the OS
     if (unloadStage == jenova::ModuleUnloadStage::UnloadModuleToShutdown) return true;
@@ -208,13 +309,227 @@ bool JenovaInterpreter::UnloadModule(const jenova::ModuleUnloadStage& unloadStag
 	if (!moduleHandle) return false;
 	if (!moduleBaseAddress) return false;
     if (!JenovaLoader::ReleaseModule(moduleHandle)) return false;
+    JenovaMemoryTracker::UntrackPointer(jenova::MemoryTag::ModuleImages, moduleHandle);
     moduleHandle = nullptr;
 	moduleBaseAddress = 0;
+    moduleGeneration = nullptr;
     moduleMetaData = "{}";
 
     // All Good
 	return true;
 }
+bool JenovaInterpreter::MigrateScriptInstances()
+{
+    // Re-Point Every Live Instance to Active Generation
+    JenovaScriptManager* scriptManager = JenovaScriptManager::get_singleton();
+    if (!scriptManager) return false;
+    for (size_t i = 0; i < scriptManager->get_script_instance_count(); i++)
+    {
+        scriptManager->get_script_instance(i)->migrate_module_generation();
+    }
+
+    // All Good
+    return true;
+}
+bool JenovaInterpreter::MigrateScriptInstances(const jenova::IdentityList& scriptUIDs)
+{
+    // Re-Point Only Instances of Reloaded Scripts
+    JenovaScriptManager* scriptManager = JenovaScriptManager::get_singleton();
+    if (!scriptManager) return false;
+    for (size_t i = 0; i < scriptManager->get_script_instance_count(); i++)
+    {
+        CPPScriptInstance* scriptInstance = scriptManager->get_script_instance(i);
+        if (std::find(scriptUIDs.begin(), scriptUIDs.end(), AS_STD_STRING(scriptInstance->get_identity())) == scriptUIDs.end()) continue;
+        scriptInstance->migrate_module_generation();
+    }
+
+    // All Good
+    return true;
+}
+double JenovaInterpreter::GetLastReloadLatency()
+{
+    return lastReloadLatency;
+}
+size_t JenovaInterpreter::GetLastReloadDroppedFrames()
+{
+    return lastReloadDroppedFrames;
+}
+void JenovaInterpreter::CollectReloadFrame()
+{
+    // Called Once Per Presented Frame, Frame Spans Previous Present To This One
+    auto framePresentTime = std::chrono::steady_clock::now();
+    if (isCountingReloadFrames && lastFramePresentTime != std::chrono::steady_clock::time_point())
+    {
+        if (lastFramePresentTime < reloadWindowEnd && framePresentTime > reloadWindowStart)
+        {
+            double frameTime = std::chrono::duration<double, std::milli>(framePresentTime - lastFramePresentTime).count();
+            if (frameTime > jenova::GlobalSettings::ModuleReloadFrameBudget) lastReloadDroppedFrames++;
+        }
+        if (framePresentTime > reloadWindowEnd)
+        {
+            isCountingReloadFrames = false;
+            JENOVA_VERBOSE_BY_ID(__LINE__, "Jenova Module Reload Dropped %zu Frames (Budget : %.3f ms)", lastReloadDroppedFrames, jenova::GlobalSettings::ModuleReloadFrameBudget);
+        }
+    }
+    lastFramePresentTime = framePresentTime;
+}
+size_t JenovaInterpreter::GetModuleMemoryFootprint()
+{
+    // Core Module Image Plus Each Unique Satellite Image
+    size_t moduleMemoryFootprint = moduleBaseAddress ? moduleBinarySize : 0;
+    std::unordered_set<jenova::ModuleHandle> satelliteHandles;
+    for (const auto& satelliteModule : satelliteModules)
+    {
+        if (satelliteHandles.insert(satelliteModule.second.moduleHandle).second) moduleMemoryFootprint += satelliteModule.second.moduleSize;
+    }
+    return moduleMemoryFootprint;
+}
+jenova::ModuleBootStatistics JenovaInterpreter::GetModuleBootStatistics()
+{
+    return moduleBootStatistics;
+}
+bool JenovaInterpreter::LoadSatelliteModule(const jenova::BuildResult& buildResult, const jenova::SymbolList& reboundSymbols)
+{
+    // Satellites Extend A Loaded Core Module
+    if (!moduleHandle || !moduleBaseAddress) return false;
+
+    try
+    {
+        // Parse Satellite Metadata
+        jenova::json_t satelliteMetaData = jenova::json_t::parse(buildResult.moduleMetaData);
+        if (!satelliteMetaData.contains("Scripts")) return false;
+
+        // Load Satellite in Local Scope [Core Module Exports Same Symbols]
+        jenova::LoaderFlags loaderFlags = jenova::LoaderFlag::LocalSymbolScope;
+        if (moduleSymbolBinding == jenova::ModuleSymbolBinding::LazyGlobal || moduleSymbolBinding == jenova::ModuleSymbolBinding::LazyLocal) loaderFlags |= jenova::LoaderFlag::LazySymbolBinding;
+        jenova::SatelliteModule satelliteModule;
+        auto inspectSatelliteImage = [&](jenova::ModuleHandle loadedModuleHandle)
+        {
+            if (JenovaPerfMap::IsOpen()) JenovaPerfMap::WriteModuleSymbols(buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), JenovaLoader::GetModuleBaseAddress(loadedModuleHandle), satelliteMetaData);
+        };
+        satelliteModule.moduleHandle = JenovaLoader::LoadModule((void*)buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), loaderFlags, inspectSatelliteImage);
+        if (!satelliteModule.moduleHandle) return false;
+        satelliteModule.moduleBaseAddress = JenovaLoader::GetModuleBaseAddress(satelliteModule.moduleHandle);
+        satelliteModule.moduleGeneration = JenovaLoader::GetModuleGeneration(satelliteModule.moduleHandle);
+        satelliteModule.moduleSize = buildResult.builtModuleData.size();
+        satelliteModule.reboundSymbols = reboundSymbols;
+        JenovaMemoryTracker::TrackPointer(jenova::MemoryTag::ModuleImages, satelliteModule.moduleHandle, satelliteModule.moduleSize);
+
+        // Solve Functions Inside Satellite
+        if (!jenova::InitializeExtensionModule("InitializeJenovaModule", satelliteModule.moduleHandle, jenova::ModuleCallMode::Virtual))
+        {
+            jenova::Error("Jenova Interpreter", "Failed to Initialize Jenova Satellite Module API Solver.");
+            JenovaLoader::ReleaseModule(satelliteModule.moduleHandle);
+            JenovaMemoryTracker::UntrackPointer(jenova::MemoryTag::ModuleImages, satelliteModule.moduleHandle);
+            return false;
+        }
+
+        // Re-Point Scripts to Satellite And Retire Previous Satellites
+        jenova::IdentityList satelliteScriptUIDs;
+        std::vector<jenova::ModuleHandle> retiredSatellites;
+        for (const auto& satelliteScript : satelliteMetaData["Scripts"].items())
+        {
+            if (satelliteModules.contains(satelliteScript.key())) retiredSatellites.push_back(satelliteModules[satelliteScript.key()].moduleHandle);
+            satelliteModules[satelliteScript.key()] = satelliteModule;
+            moduleMetaData["Scripts"][satelliteScript.key()] = satelliteScript.value();
+            satelliteScriptUIDs.push_back(satelliteScript.key());
+        }
+
+        // Rebind Cross-Script Calls to Satellite Definitions Before Previous Satellites Go Away
+        size_t reboundSlots = JenovaInterpreter::RebindSatelliteSymbols(satelliteModule.moduleHandle);
+        JENOVA_VERBOSE("Satellite Module Loaded, %zu Import Slots Rebound to Reloaded Scripts.", reboundSlots);
+        for (auto retiredSatellite : retiredSatellites)
+        {
+            JenovaLoader::ReleaseModule(retiredSatellite);
+            JenovaMemoryTracker::UntrackPointer(jenova::MemoryTag::ModuleImages, retiredSatellite);
+        }
+
+        // Update Profiler Method Table for Satellite Scripts
+        JenovaInterpreter::UpdateProfilerMethodTable();
+        JenovaRuntimeCounters::Increment(JenovaRuntimeCounters::Counter::ModuleReloads);
+
+        // Rebuild Property Storage of Reloaded Scripts Only
+        for (const auto& satelliteScriptUID : satelliteScriptUIDs)
+        {
+            JenovaInterpreter::FlushScriptPropertyStorage(satelliteScriptUID);
+            if (!JenovaInterpreter::AllocateScriptProperties(satelliteScriptUID, satelliteMetaData["Scripts"][satelliteScriptUID])) return false;
+        }
+
+        // Migrate Live Instances of Reloaded Scripts
+        JenovaInterpreter::MigrateScriptInstances(satelliteScriptUIDs);
+
+        // All Good
+        return true;
+    }
+    catch (const std::exception& err)
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Load Satellite Module, Error : %s", err.what());
+        return false;
+    }
+}
+size_t JenovaInterpreter::RebindSatelliteSymbols(jenova::ModuleHandle newSatelliteHandle)
+{
+    // Collect Unique Satellites, Several Scripts May Share One Satellite
+    std::unordered_map<jenova::ModuleHandle, const jenova::SymbolList*> satelliteProviders;
+    for (const auto& satelliteModule : satelliteModules) satelliteProviders.emplace(satelliteModule.second.moduleHandle, &satelliteModule.second.reboundSymbols);
+    if (!satelliteProviders.contains(newSatelliteHandle)) return 0;
+    const jenova::SymbolList& newSymbols = *satelliteProviders[newSatelliteHandle];
+
+    // Point Core And Older Satellites at Definitions of Newly Reloaded Scripts
+    size_t reboundSlots = JenovaLoader::RebindModuleSymbols(moduleHandle, newSatelliteHandle, newSymbols);
+    for (const auto& olderSatellite : satelliteProviders)
+    {
+        if (olderSatellite.first == newSatelliteHandle) continue;
+        reboundSlots += JenovaLoader::RebindModuleSymbols(olderSatellite.first, newSatelliteHandle, newSymbols);
+
+        // Bind New Satellite Imports to Scripts Still Living in Older Satellites, Never Its Own Definitions
+        jenova::SymbolList olderSymbols;
+        for (const auto& olderSymbol : *olderSatellite.second)
+        {
+            if (std::find(newSymbols.begin(), newSymbols.end(), olderSymbol) == newSymbols.end()) olderSymbols.push_back(olderSymbol);
+        }
+        reboundSlots += JenovaLoader::RebindModuleSymbols(newSatelliteHandle, olderSatellite.first, olderSymbols);
+    }
+    return reboundSlots;
+}
+void JenovaInterpreter::ReleaseSatelliteModules()
+{
+    // Collect Unique Satellite Handles
+    std::unordered_set<jenova::ModuleHandle> satelliteHandles;
+    for (const auto& satelliteModule : satelliteModules) satelliteHandles.insert(satelliteModule.second.moduleHandle);
+
+    // Retire Satellites
+    for (auto satelliteHandle : satelliteHandles)
+    {
+        JenovaLoader::ReleaseModule(satelliteHandle);
+        JenovaMemoryTracker::UntrackPointer(jenova::MemoryTag::ModuleImages, satelliteHandle);
+    }
+    satelliteModules.clear();
+}
+bool JenovaInterpreter::HasScript(const std::string& scriptUID)
+{
+    return moduleMetaData.contains("Scripts") && moduleMetaData["Scripts"].contains(scriptUID);
+}
+jenova::ModuleAddress JenovaInterpreter::GetScriptBaseAddress(const std::string& scriptUID)
+{
+    // Satellite Modules Override Core Module Per Script
+    if (!satelliteModules.empty())
+    {
+        auto satelliteModule = satelliteModules.find(scriptUID);
+        if (satelliteModule != satelliteModules.end()) return satelliteModule->second.moduleBaseAddress;
+    }
+    return moduleBaseAddress;
+}
+jenova::ModuleGenerationRef JenovaInterpreter::GetScriptModuleGeneration(const std::string& scriptUID)
+{
+    // Generation Owning Script Code, Satellite If Script Was Reloaded Into One
+    if (!satelliteModules.empty())
+    {
+        auto satelliteModule = satelliteModules.find(scriptUID);
+        if (satelliteModule != satelliteModules.end()) return satelliteModule->second.moduleGeneration;
+    }
+    return moduleGeneration;
+}
 bool JenovaInterpreter::LoadDebugSymbol(const std::string symbolFilePath)
 {
     return jenova::LoadSymbolForModule(jenova::GetCurrentProcessHandle(), moduleBaseAddress, symbolFilePath.c_str(), moduleBinarySize);
@@ -244,6 +559,38 @@ jenova::FunctionList JenovaInterpreter::GetFunctionsList(const std::string& scri
         return jenova::FunctionList();
     }
 }
+void JenovaInterpreter::UpdateProfilerMethodTable()
+{
+    // Assign Profiler Method IDs to Every Script Method In Metadata
+    if (!moduleMetaData.contains("Scripts")) return;
+    for (auto& moduleScript : moduleMetaData["Scripts"].items())
+    {
+        if (!moduleScript.value().contains("methods")) continue;
+        // Prefer Script File Over UID, Metadata From Older Builds Has No Script File
+        std::string scriptName = moduleScript.value().contains("ScriptFile") ? moduleScript.value()["ScriptFile"].get<std::string>() : moduleScript.key();
+        for (auto& scriptMethod : moduleScript.value()["methods"].items())
+        {
+            std::string methodSignature = scriptName + "::0::" + scriptMethod.key();
+            scriptMethod.value()["MethodID"] = JenovaScriptProfiler::RegisterMethod(methodSignature);
+        }
+    }
+}
+JenovaScriptProfiler::MethodID JenovaInterpreter::GetFunctionMethodID(const std::string& functionName, const std::string& scriptUID)
+{
+    // Lookup Without Copying Or Inserting Into Script Metadata
+    const jenova::json_t& moduleMetaDataView = moduleMetaData;
+    auto scriptsIterator = moduleMetaDataView.find("Scripts");
+    if (scriptsIterator == moduleMetaDataView.end()) return JenovaScriptProfiler::InvalidMethodID;
+    auto scriptIterator = scriptsIterator->find(scriptUID);
+    if (scriptIterator == scriptsIterator->end()) return JenovaScriptProfiler::InvalidMethodID;
+    auto methodsIterator = scriptIterator->find("methods");
+    if (methodsIterator == scriptIterator->end()) return JenovaScriptProfiler::InvalidMethodID;
+    auto methodIterator = methodsIterator->find(functionName);
+    if (methodIterator == methodsIterator->end()) return JenovaScriptProfiler::InvalidMethodID;
+    auto methodIDIterator = methodIterator->find("MethodID");
+    if (methodIDIterator == methodIterator->end()) return JenovaScriptProfiler::InvalidMethodID;
+    return methodIDIterator->get<JenovaScriptProfiler::MethodID>();
+}
 jenova::FunctionAddress JenovaInterpreter::GetFunctionAddress(const std::string& functionName, const std::string& scriptUID)
 {
     try
@@ -261,7 +608,7 @@ jenova::FunctionAddress JenovaInterpreter::GetFunctionAddress(const std::string&
             {
                 // Calculate Offset + BaseAddress And Return
                 jenova::FunctionAddress functionOffset = funcName.value()["Offset"].get<jenova::FunctionAddress>();
-                return moduleBaseAddress + functionOffset;
+                return GetScriptBaseAddress(scriptUID) + functionOffset;
             }
         }
     }
@@ -420,15 +767,31 @@ jenova::ScriptPropertyContainer JenovaInterpreter::GetPropertyContainer(const st
 }
 Variant JenovaInterpreter::CallFunction(const godot::Object* objectPtr, const std::string& functionName, std::string& scriptUID, const Variant** functionParameters, const int functionParametersCount)
 {
+    // Record Call In Runtime Counters [Failed Unless Marked Succeeded]
+    JenovaRuntimeCounters::ScopedCallTimer callTimer;
+
     // Validate Module
     if (!allowExecution) return Variant("ERROR::EXECUTION_DENIED");
     if (!moduleHandle || !moduleBaseAddress) return Variant("ERROR::INVALID_MODULE");
 
-    // Create Profiler Checkpoint [Not Required For Now]
-    /* JenovaTinyProfiler::CreateCheckpoint("InterpreterCallFunction"); */
+    // Pin Generation Owning Script Code for This Call Frame
+    struct CallFrameGuard
+    {
+        jenova::ModuleGenerationRef moduleGeneration = nullptr;
+        ~CallFrameGuard() { JenovaLoader::ReleaseModuleInstance(moduleGeneration); }
+    } callFrameGuard;
+    jenova::ModuleGenerationRef scriptGeneration = JenovaInterpreter::GetScriptModuleGeneration(scriptUID);
+    if (scriptGeneration)
+    {
+        if (!JenovaLoader::AcquireModuleInstance(scriptGeneration)) return Variant("ERROR::MODULE_UNLOADED");
+        callFrameGuard.moduleGeneration = scriptGeneration;
+    }
+
+    // Create Profiler Scope
+    JENOVA_PROFILE_SCOPE("InterpreterCallFunction");
 
     // Verbose
-    jenova::VerboseByID(__LINE__, "Interpreter Calling Function [%s] From Script [%s] On Object [%p]", functionName.c_str(), scriptUID.c_str(), objectPtr);
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Interpreter Calling Function [%s] From Script [%s] On Object [%p]", functionName.c_str(), scriptUID.c_str(), objectPtr);
 
     // Get Function Address Offset
     jenova::FunctionAddress functionAddress = JenovaInterpreter::GetFunctionAddress(functionName, scriptUID);
@@ -465,6 +828,12 @@ Variant JenovaInterpreter::CallFunction(const godot::Object* objectPtr, const st
     // Calculate Final Size
     int resolvedParametersCount = callHasParameters ? resolvedParameters.size() : 0;
 
+    // Record Call In Script Profiler And Frame Budget [Includes Backend Caller Generation]
+    bool isMethodTracked = JenovaScriptProfiler::IsProfiling() || JenovaFrameBudget::IsEnabled();
+    JenovaScriptProfiler::MethodID methodID = isMethodTracked ? JenovaInterpreter::GetFunctionMethodID(functionName, scriptUID) : JenovaScriptProfiler::InvalidMethodID;
+    JenovaScriptProfiler::ScopedCall profiledCall(methodID);
+    JenovaFrameBudget::ScopedMethodTimer budgetedCall(methodID);
+
     // Generate Code And Call Using Backends
     if (interpreterBackend == jenova::InterpreterBackend::AsmJIT)
     {
@@ -547,14 +916,19 @@ Variant JenovaInterpreter::CallFunction(const godot::Object* objectPtr, const st
                 // Allocate and Run Generated Code
                 CallerFunction callerFunction = nullptr;
                 jitRuntime.add(&callerFunction, &code);
+                JenovaPerfMap::WriteThunk(reinterpret_cast<const void*>(callerFunction), assembler.offset(), "AsmJIT", scriptUID, functionName);
+                JenovaMemoryTracker::TrackAllocation(jenova::MemoryTag::JITCode, code.codeSize());
 
                 // Call the JIT-generated Function
+                JenovaRuntimeCounters::Increment(JenovaRuntimeCounters::Counter::ThunksCompiled);
                 Variant result = callerFunction();
 
                 // Release Generated Code When Done
                 jitRuntime.release(callerFunction);
+                JenovaMemoryTracker::TrackRelease(jenova::MemoryTag::JITCode, code.codeSize());
 
                 // Return the Result as a Variant
+                callTimer.MarkSucceeded();
                 if (result.get_type() == Variant::NIL) return Variant("RESULT::VOID");
                 return result;
             }
@@ -564,8 +938,13 @@ Variant JenovaInterpreter::CallFunction(const godot::Object* objectPtr, const st
                 typedef void(*CallerFunction)();
                 CallerFunction callerFunction = nullptr;
                 jitRuntime.add(&callerFunction, &code);
+                JenovaPerfMap::WriteThunk(reinterpret_cast<const void*>(callerFunction), assembler.offset(), "AsmJIT", scriptUID, functionName);
+                JenovaMemoryTracker::TrackAllocation(jenova::MemoryTag::JITCode, code.codeSize());
+                JenovaRuntimeCounters::Increment(JenovaRuntimeCounters::Counter::ThunksCompiled);
                 callerFunction();
                 jitRuntime.release(callerFunction);
+                JenovaMemoryTracker::TrackRelease(jenova::MemoryTag::JITCode, code.codeSize());
+                callTimer.MarkSucceeded();
                 return Variant(true);
             }
         }
@@ -622,7 +1001,7 @@ Variant JenovaInterpreter::CallFunction(const godot::Object* objectPtr, const st
         // Create Error/Warning Reporter 
         if (jenova::GlobalStorage::DeveloperModeActivated)
         {
-            jenova::VerboseByID(__LINE__, "JIT Execution Code : \n%s", interpreterCallerCode.c_str());
+            JENOVA_VERBOSE_BY_ID(__LINE__, "JIT Execution Code : \n%s", interpreterCallerCode.c_str());
             auto tcc_error_handler = [](void* opaque, const char* msg) -> void
             {
                 jenova::Error("Interpreter Backend", "%s", msg);
@@ -647,6 +1026,9 @@ Variant JenovaInterpreter::CallFunction(const godot::Object* objectPtr, const st
             return Variant(false);
         }
 
+        // Measure Relocated Image For Perf Map Once Per Thunk [Memory Tracker Counts Unmeasured Images Without Size]
+        size_t relocatedImageSize = JenovaPerfMap::GetThunkSize("TinyCC", scriptUID, functionName, [tcc]() { return size_t(std::max(tcc_relocate(tcc, nullptr), 0)); });
+
         // Prepare For Execution
         if (tcc_relocate(tcc, TCC_RELOCATE_AUTO) < 0) {
             jenova::Error("Interpreter Backend", "Failed to Resolve Interpreter Code.");
@@ -667,6 +1049,9 @@ Variant JenovaInterpreter::CallFunction(const godot::Object* objectPtr, const st
         }
 
         // Execute Caller
+        if (relocatedImageSize > 0) JenovaPerfMap::WriteThunk(reinterpret_cast<const void*>(interpreterCaller), relocatedImageSize, "TinyCC", scriptUID, functionName);
+        JenovaMemoryTracker::TrackAllocation(jenova::MemoryTag::JITCode, relocatedImageSize);
+        JenovaRuntimeCounters::Increment(JenovaRuntimeCounters::Counter::ThunksCompiled);
         Variant* result = interpreterCaller();
 
         // Release Allocated Values
@@ -675,8 +1060,10 @@ Variant JenovaInterpreter::CallFunction(const godot::Object* objectPtr, const st
 
         // Clean up
         tcc_delete(tcc);
+        JenovaMemoryTracker::TrackRelease(jenova::MemoryTag::JITCode, relocatedImageSize);
 
         // Process Result
+        callTimer.MarkSucceeded();
         if (callMustReturn)
         {
             if (result)
@@ -707,6 +1094,9 @@ void JenovaInterpreter::SetExecutionState(bool executionState)
 }
 jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::string& mapFilePath, const jenova::ModuleList& scriptModules, const jenova::BuildResult& buildResult)
 {
+    // Create Profiler Scope
+    JENOVA_PROFILE_SCOPE("GenerateModuleMetadata");
+
     // Windows Compilers
     #ifdef TARGET_PLATFORM_WINDOWS
 
@@ -809,20 +1199,20 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                                 return jenova::SerializedData();
                             }
                             funcSerializer["ReturnType"] = returnType;
-                            jenova::VerboseByID(__LINE__, "Extracted Return Type [%s]", returnType.c_str());
+                            JENOVA_VERBOSE_BY_ID(__LINE__, "Extracted Return Type [%s]", returnType.c_str());
 
                             // Extract Parameter Types
                             jenova::ParameterTypeList parameterTypes = jenova::ExtractParameterTypesFromSignature(cleanedFunctionSignature, buildResult.compilerModel);
                             funcSerializer["ParamCount"] = parameterTypes.size();
-                            jenova::VerboseByID(__LINE__, "Extracted Parameters Count [%d]", parameterTypes.size());
+                            JENOVA_VERBOSE_BY_ID(__LINE__, "Extracted Parameters Count [%d]", parameterTypes.size());
                             for (size_t i = 0; i < parameterTypes.size(); ++i)
                             {
                                 funcSerializer[jenova::Format("Param%02d", i + 1)] = parameterTypes[i];
-                                jenova::VerboseByID(__LINE__, "Extracted Parameter Type [%s]", parameterTypes[i].c_str());
+                                JENOVA_VERBOSE_BY_ID(__LINE__, "Extracted Parameter Type [%s]", parameterTypes[i].c_str());
                             }
 
                             // Verbose
-                            jenova::VerboseByID(__LINE__, "[Map-Parser] Demangled Function Name: [%s], UID: [%s]", demangledFunctionSignature.c_str(), scriptUID.c_str());
+                            JENOVA_VERBOSE_BY_ID(__LINE__, "[Map-Parser] Demangled Function Name: [%s], UID: [%s]", demangledFunctionSignature.c_str(), scriptUID.c_str());
                         }
 
                         // Store function name and metadata in the serializer
@@ -836,7 +1226,7 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                         }
 
                         // Verbose
-                        jenova::VerboseByID(__LINE__, "[Map-Parser] Function Name & Offset Extracted > Name: %s, UID: %s, Offset: %llx", functionName.c_str(), scriptUID.c_str(), actualOffset);
+                        JENOVA_VERBOSE_BY_ID(__LINE__, "[Map-Parser] Function Name & Offset Extracted > Name: %s, UID: %s, Offset: %llx", functionName.c_str(), scriptUID.c_str(), actualOffset);
                     }
 
                     // Parse Properties Name and Offsets
@@ -893,10 +1283,10 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                                 return jenova::SerializedData();
                             }
                             propSerializer["Type"] = propertyType;
-                            jenova::VerboseByID(__LINE__, "Extracted Property Type [%s]", propertyType.c_str());
+                            JENOVA_VERBOSE_BY_ID(__LINE__, "Extracted Property Type [%s]", propertyType.c_str());
 
                             // Verbose
-                            jenova::VerboseByID(__LINE__, "[Map-Parser] Demangled Property Name: [%s], UID: [%s]", demangledPropertySignature.c_str(), scriptUID.c_str());
+                            JENOVA_VERBOSE_BY_ID(__LINE__, "[Map-Parser] Demangled Property Name: [%s], UID: [%s]", demangledPropertySignature.c_str(), scriptUID.c_str());
                         }
 
                         // Store property name and metadata in the serializer
@@ -910,7 +1300,7 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                         }
 
                         // Verbose
-                        jenova::VerboseByID(__LINE__, "[Map-Parser] Property Name & Offset Extracted > Name: %s, UID: %s, Offset: %llx", propertyName.c_str(), scriptUID.c_str(), actualOffset);
+                        JENOVA_VERBOSE_BY_ID(__LINE__, "[Map-Parser] Property Name & Offset Extracted > Name: %s, UID: %s, Offset: %llx", propertyName.c_str(), scriptUID.c_str(), actualOffset);
                     }
                 }
             }
@@ -990,10 +1380,10 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                                     return jenova::SerializedData();
                                 }
                                 propSerializer["Type"] = propertyType;
-                                jenova::VerboseByID(__LINE__, "Extracted Property Type [%s]", propertyType.c_str());
+                                JENOVA_VERBOSE_BY_ID(__LINE__, "Extracted Property Type [%s]", propertyType.c_str());
 
                                 // Verbose
-                                jenova::VerboseByID(__LINE__, "[Map-Parser] Demangled Property Name: [%s], UID: [%s]", demangledPropertySignature.c_str(), scriptUID.c_str());
+                                JENOVA_VERBOSE_BY_ID(__LINE__, "[Map-Parser] Demangled Property Name: [%s], UID: [%s]", demangledPropertySignature.c_str(), scriptUID.c_str());
                             }
 
                             // Store property name and metadata in the serializer
@@ -1007,7 +1397,7 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                             }
 
                             // Verbose
-                            jenova::VerboseByID(__LINE__, "[Map-Parser] Property Name & Offset Extracted > Name: %s, UID: %s, Offset: %llx", propertyName.c_str(), scriptUID.c_str(), actualOffset);
+                            JENOVA_VERBOSE_BY_ID(__LINE__, "[Map-Parser] Property Name & Offset Extracted > Name: %s, UID: %s, Offset: %llx", propertyName.c_str(), scriptUID.c_str(), actualOffset);
                         }
                         else
                         {
@@ -1050,7 +1440,7 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                                 // Double-Check If Extracted Symbol is Function
                                 if (jenova::DetectSymbolSignatureType(mangledFunctionSignature, buildResult.compilerModel) != jenova::SymbolSignatureType::FunctionSymbol)
                                 {
-                                    jenova::VerboseByID(__LINE__, "Skipping Symbol Candidate [%s] due to a Non-Standard Signature.", demangledFunctionSignature.c_str());
+                                    JENOVA_VERBOSE_BY_ID(__LINE__, "Skipping Symbol Candidate [%s] due to a Non-Standard Signature.", demangledFunctionSignature.c_str());
                                     continue;
                                 }
 
@@ -1066,20 +1456,20 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                                     return jenova::SerializedData();
                                 }
                                 funcSerializer["ReturnType"] = returnType;
-                                jenova::VerboseByID(__LINE__, "Extracted Return Type [%s]", returnType.c_str());
+                                JENOVA_VERBOSE_BY_ID(__LINE__, "Extracted Return Type [%s]", returnType.c_str());
 
                                 // Extract Parameter Types
                                 jenova::ParameterTypeList parameterTypes = jenova::ExtractParameterTypesFromSignature(cleanedFunctionSignature, buildResult.compilerModel);
                                 funcSerializer["ParamCount"] = parameterTypes.size();
-                                jenova::VerboseByID(__LINE__, "Extracted Parameters Count [%d]", parameterTypes.size());
+                                JENOVA_VERBOSE_BY_ID(__LINE__, "Extracted Parameters Count [%d]", parameterTypes.size());
                                 for (size_t i = 0; i < parameterTypes.size(); ++i)
                                 {
                                     funcSerializer[jenova::Format("Param%02d", i + 1)] = parameterTypes[i];
-                                    jenova::VerboseByID(__LINE__, "Extracted Parameter Type [%s]", parameterTypes[i].c_str());
+                                    JENOVA_VERBOSE_BY_ID(__LINE__, "Extracted Parameter Type [%s]", parameterTypes[i].c_str());
                                 }
 
                                 // Verbose
-                                jenova::VerboseByID(__LINE__, "[Map-Parser] Demangled Function Name: [%s], UID: [%s]", demangledFunctionSignature.c_str(), scriptUID.c_str());
+                                JENOVA_VERBOSE_BY_ID(__LINE__, "[Map-Parser] Demangled Function Name: [%s], UID: [%s]", demangledFunctionSignature.c_str(), scriptUID.c_str());
                             }
 
                             // Store function name and metadata in the serializer
@@ -1093,7 +1483,7 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
                             }
 
                             // Verbose
-                            jenova::VerboseByID(__LINE__, "[Map-Parser] Function Name & Offset Extracted > Name: %s, UID: %s, Offset: %llx", functionName.c_str(), scriptUID.c_str(), actualOffset);
+                            JENOVA_VERBOSE_BY_ID(__LINE__, "[Map-Parser] Function Name & Offset Extracted > Name: %s, UID: %s, Offset: %llx", functionName.c_str(), scriptUID.c_str(), actualOffset);
                         }
                     }
                 }
@@ -1126,7 +1516,17 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
             serializer["ModuleBinarySize"] = buildResult.builtModuleData.size();
             serializer["InterpreterBackend"] = JenovaInterpreter::GetInterpreterBackend();
             serializer["DeveloperMode"] = jenova::GlobalStorage::DeveloperModeActivated;
+            serializer["ModuleSymbolBinding"] = jenova::GlobalStorage::ModuleSymbolBinding;
+            serializer["TraceRecording"] = jenova::GlobalStorage::TraceRecording;
             serializer["ManagedSafeExecution"] = jenova::GlobalStorage::UseManagedSafeExecution;
+            serializer["FrameBudget"] = JenovaFrameBudget::GetFrameBudget();
+
+            // Serialize Script Files [Readable Profiler Signatures]
+            for (const auto& scriptModule : scriptModules)
+            {
+                std::string scriptUID = AS_STD_STRING(scriptModule.scriptUID);
+                if (serializer["Scripts"].contains(scriptUID)) serializer["Scripts"][scriptUID]["ScriptFile"] = AS_STD_STRING(scriptModule.scriptFilename);
+            }
 
             // Dump Metadata If Developer Mode Activated
             if (jenova::GlobalStorage::DeveloperModeActivated)
@@ -1304,7 +1704,17 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
             serializer["ModuleBinarySize"] = buildResult.builtModuleData.size();
             serializer["InterpreterBackend"] = JenovaInterpreter::GetInterpreterBackend();
             serializer["DeveloperMode"] = jenova::GlobalStorage::DeveloperModeActivated;
+            serializer["ModuleSymbolBinding"] = jenova::GlobalStorage::ModuleSymbolBinding;
+            serializer["TraceRecording"] = jenova::GlobalStorage::TraceRecording;
             serializer["ManagedSafeExecution"] = jenova::GlobalStorage::UseManagedSafeExecution;
+            serializer["FrameBudget"] = JenovaFrameBudget::GetFrameBudget();
+
+            // Serialize Script Files [Readable Profiler Signatures]
+            for (const auto& scriptModule : scriptModules)
+            {
+                std::string scriptUID = AS_STD_STRING(scriptModule.scriptUID);
+                if (serializer["Scripts"].contains(scriptUID)) serializer["Scripts"][scriptUID]["ScriptFile"] = AS_STD_STRING(scriptModule.scriptFilename);
+            }
 
             // Dump Metadata If Developer Mode Activated
             if (jenova::GlobalStorage::DeveloperModeActivated)
@@ -1487,6 +1897,15 @@ jenova::SerializedData JenovaInterpreter::GenerateModuleMetadata(const std::stri
             serializer["ModuleBinarySize"] = buildResult.builtModuleData.size();
             serializer["InterpreterBackend"] = JenovaInterpreter::GetInterpreterBackend();
             serializer["DeveloperMode"] = jenova::GlobalStorage::DeveloperModeActivated;
+            serializer["ModuleSymbolBinding"] = jenova::GlobalStorage::ModuleSymbolBinding;
+            serializer["TraceRecording"] = jenova::GlobalStorage::TraceRecording;
+
+            // Serialize Script Files [Readable Profiler Signatures]
+            for (const auto& scriptModule : scriptModules)
+            {
+                std::string scriptUID = AS_STD_STRING(scriptModule.scriptUID);
+                if (serializer["Scripts"].contains(scriptUID)) serializer["Scripts"][scriptUID]["ScriptFile"] = AS_STD_STRING(scriptModule.scriptFilename);
+            }
 
             // Dump Metadata If Developer Mode Activated
             if (jenova::GlobalStorage::DeveloperModeActivated)
@@ -1542,11 +1961,27 @@ bool JenovaInterpreter::UpdateConfigurationsFromMetaData(const jenova::Serialize
         {
             if (moduleMetaData.contains("DeveloperMode")) jenova::GlobalStorage::DeveloperModeActivated = moduleMetaData["DeveloperMode"].get<bool>();
             if (moduleMetaData.contains("ManagedSafeExecution")) jenova::GlobalStorage::UseManagedSafeExecution = moduleMetaData["ManagedSafeExecution"].get<bool>();
+            if (moduleMetaData.contains("FrameBudget") && !JenovaFrameBudget::IsEnabled()) JenovaFrameBudget::SetFrameBudget(moduleMetaData["FrameBudget"].get<double>());
+            if (moduleMetaData.contains("TraceRecording")) jenova::GlobalStorage::TraceRecording = moduleMetaData["TraceRecording"].get<jenova::TraceRecording>();
+
+            // Runtime Trace Is An Editor Opt-In, Exported Games Only Trace With Explicit --Enable-Trace-Recording
+            bool isLaunchedFromEditor = EngineDebugger::get_singleton() && EngineDebugger::get_singleton()->is_active();
+            if (jenova::GlobalStorage::TraceRecording == jenova::TraceRecording::BuildAndRuntime && isLaunchedFromEditor && !JenovaTinyProfiler::IsTraceRecording())
+            {
+                JenovaTinyProfiler::StartTraceRecording(jenova::GlobalSettings::TraceRecorderRuntimeRingEvents);
+            }
         }
 
+        // Set Module Symbol Binding [Modules Built Before Binding Selection Use Immediate Global]
+        moduleSymbolBinding = jenova::ModuleSymbolBinding::ImmediateGlobal;
+        if (moduleMetaData.contains("ModuleSymbolBinding")) moduleSymbolBinding = moduleMetaData["ModuleSymbolBinding"].get<jenova::ModuleSymbolBinding>();
+
         // Update Module Binary Size
         moduleBinarySize = moduleMetaData["ModuleBinarySize"].get<size_t>();
 
+        // Update Profiler Method Table
+        JenovaInterpreter::UpdateProfilerMethodTable();
+
         // All Good
         return true;
     }
@@ -1570,38 +2005,49 @@ bool JenovaInterpreter::UpdatePropertyStorageFromMetaData()
         // Extract Properties from Metadata
         for (const auto& moduleScript : moduleScripts.items())
         {
-            std::string scriptUID = moduleScript.key();
+            if (!AllocateScriptProperties(moduleScript.key(), moduleScript.value())) return false;
+        }
 
-            if (moduleScript.value().contains("database"))
-            {
-                if (moduleScript.value()["database"].contains("properties"))
-                {
-                    for (const auto& scriptProperty : moduleScript.value()["database"]["properties"])
-                    {
-                        // Get Property Name
-                        std::string propertyName = scriptProperty["PropertyName"].get<std::string>();
+        // All Good
+        return true;
+    }
+    catch (const std::exception& err)
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Parse Metadata, Parser Error : %s", err.what());
+        return false;
+    }
+}
+bool JenovaInterpreter::AllocateScriptProperties(const std::string& scriptUID, const jenova::json_t& scriptMetadata)
+{
+    try
+    {
+        // Check If Script has Properties
+        if (!scriptMetadata.contains("database") || !scriptMetadata["database"].contains("properties")) return true;
 
-                        // Allocate Property
-                        void* propertyPtr = jenova::AllocateVariantBasedProperty(scriptProperty["PropertyType"].get<std::string>());
+        // Allocate Script Properties
+        for (const auto& scriptProperty : scriptMetadata["database"]["properties"])
+        {
+            // Get Property Name
+            std::string propertyName = scriptProperty["PropertyName"].get<std::string>();
 
-                        // Validate Property Pointer
-                        if (!propertyPtr)
-                        {
-                            jenova::Error("Jenova Interpreter", "Failed to Allocate Property %s From Script %s", propertyName.c_str(), scriptUID.c_str());
-                            return false;
-                        }
+            // Allocate Property
+            void* propertyPtr = jenova::AllocateVariantBasedProperty(scriptProperty["PropertyType"].get<std::string>());
 
-                        // Create Property Key
-                        std::string propertyKey = scriptUID + "_" + propertyName;
+            // Validate Property Pointer
+            if (!propertyPtr)
+            {
+                jenova::Error("Jenova Interpreter", "Failed to Allocate Property %s From Script %s", propertyName.c_str(), scriptUID.c_str());
+                return false;
+            }
 
-                        // Add Allocated Property
-                        propertyStorage.insert(std::make_pair(propertyKey, propertyPtr));
+            // Create Property Key
+            std::string propertyKey = scriptUID + "_" + propertyName;
 
-                        // Verbose
-                        jenova::VerboseByID(__LINE__, "Allocating Script [%s] Property [%s]", scriptUID.c_str(), propertyName.c_str());
-                    }
-                }
-            }
+            // Add Allocated Property
+            propertyStorage.insert(std::make_pair(propertyKey, propertyPtr));
+
+            // Verbose
+            JENOVA_VERBOSE_BY_ID(__LINE__, "Allocating Script [%s] Property [%s]", scriptUID.c_str(), propertyName.c_str());
         }
 
         // All Good
@@ -1609,7 +2055,7 @@ bool JenovaInterpreter::UpdatePropertyStorageFromMetaData()
     }
     catch (const std::exception& err)
     {
-        jenova::Error("Jenova Interpreter", "Failed to Parse Metadata, Parser Error : %s", err.what());
+        jenova::Error("Jenova Interpreter", "Failed to Parse Script Properties, Parser Error : %s", err.what());
         return false;
     }
 }
@@ -1617,11 +2063,29 @@ bool JenovaInterpreter::FlushPropertyStorage()
 {
     for (auto scriptProperty : propertyStorage)
     {
+        JenovaMemoryTracker::UntrackPointer(jenova::MemoryTag::ScriptProperties, scriptProperty.second);
         if (scriptProperty.second) delete scriptProperty.second;
     }
     propertyStorage.clear();
     return true;
 }
+bool JenovaInterpreter::FlushScriptPropertyStorage(const std::string& scriptUID)
+{
+    // Property Keys Are Prefixed With Owning Script UID
+    std::string propertyKeyPrefix = scriptUID + "_";
+    for (auto scriptProperty = propertyStorage.begin(); scriptProperty != propertyStorage.end();)
+    {
+        if (scriptProperty->first.compare(0, propertyKeyPrefix.size(), propertyKeyPrefix) != 0)
+        {
+            ++scriptProperty;
+            continue;
+        }
+        JenovaMemoryTracker::UntrackPointer(jenova::MemoryTag::ScriptProperties, scriptProperty->second);
+        if (scriptProperty->second) delete scriptProperty->second;
+        scriptProperty = propertyStorage.erase(scriptProperty);
+    }
+    return true;
+}
 jenova::PropertyList JenovaInterpreter::GetPropertiesList(std::string& scriptUID)
 {
     try
@@ -1684,7 +2148,7 @@ jenova::PropertyAddress JenovaInterpreter::GetPropertyAddress(const std::string&
             {
                 // Calculate Offset + BaseAddress and Return the Address
                 jenova::PropertyAddress propertyOffset = prop.value()["Offset"].get<jenova::PropertyAddress>();
-                return moduleBaseAddress + propertyOffset;
+                return GetScriptBaseAddress(scriptUID) + propertyOffset;
             }
         }
     }
@@ -1701,14 +2165,17 @@ jenova::PropertyPointer JenovaInterpreter::GetPropertyPointer(const String& prop
     // Create Property Key
     std::string propertyKey = AS_STD_STRING(scriptUID + String("_") + propertyName.get_file());
 
-    // Validate Property
-    if (!propertyStorage.contains(propertyKey)) return nullptr;
-
     // Get Property Pointer from Storage
-    jenova::PropertyPointer propertyPtr = propertyStorage[propertyKey];
+    auto propertyIterator = propertyStorage.find(propertyKey);
+    if (propertyIterator == propertyStorage.end())
+    {
+        JenovaRuntimeCounters::Increment(JenovaRuntimeCounters::Counter::PropertyCacheMisses);
+        return nullptr;
+    }
+    JenovaRuntimeCounters::Increment(JenovaRuntimeCounters::Counter::PropertyCacheHits);
 
     // Return Property Pointer
-    return propertyPtr;
+    return propertyIterator->second;
 }
 bool JenovaInterpreter::SetPropertyValueFromVariant(const String& propertyName, const Variant& propertyValue, const String& scriptUID)
 {
@@ -1728,6 +2195,7 @@ bool JenovaInterpreter::SetPropertyValueFromVariant(const String& propertyName,
     // Set Property Pointer
     if (propertySetMethod == jenova::PropertySetMethod::DirectAssign) *(void**)propertyAddress = propertyPtr;
     if (propertySetMethod == jenova::PropertySetMethod::MemoryCopy) memcpy((void*)propertyAddress, &propertyPtr, sizeof(propertyPtr));
+    JenovaRuntimeCounters::Increment(JenovaRuntimeCounters::Counter::PropertiesMarshalled);
 
     // All Good
     return true;
@@ -1752,12 +2220,23 @@ jenova::ModuleHandle JenovaInterpreter::LoadShellModule(const uint8_t* moduleDat
 {
     return JenovaLoader::LoadModule((void*)moduleDataPtr, moduleSize);
 }
+jenova::ModuleGenerationRef JenovaInterpreter::AcquireModuleGeneration(const std::string& scriptUID)
+{
+    jenova::ModuleGenerationRef scriptGeneration = GetScriptModuleGeneration(scriptUID);
+    return JenovaLoader::AcquireModuleInstance(scriptGeneration) ? scriptGeneration : nullptr;
+}
+void JenovaInterpreter::ReleaseModuleGeneration(const jenova::ModuleGenerationRef& moduleGeneration)
+{
+    JenovaLoader::ReleaseModuleInstance(moduleGeneration);
+}
 
 // Jenova Interpreter Implementation :: Module Database
-bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData)
+bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData,
+    jenova::CompressionCodec compressionCodec, int compressionLevel)
 {
     // Verbose
-    jenova::VerboseByID(__LINE__, "Caching Jenova Compiled Module In Database...");
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Caching Jenova Compiled Module In Database...");
+    JENOVA_PROFILE_SCOPE("CreateModuleDatabase");
 
     // Validate Inputs
     if (moduleDatabaseName.empty()) return false;
@@ -1773,11 +2252,20 @@ bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseNa
     const unsigned char appVersionData[4] = { APP_VERSION_DATA };
     std::memcpy(moduleDatabaseHeader.databaseVersion, appVersionData, sizeof(appVersionData));
 
+    // Set Compression Codec
+    moduleDatabaseHeader.compressionCodec = compressionCodec;
+    moduleDatabaseHeader.compressionLevel = uint8_t(std::clamp(compressionLevel, 0, 255));
+
     // Compress Module Data
-    jenova::MemoryBuffer databaseRawBuffer;
-    databaseRawBuffer.insert(databaseRawBuffer.end(), moduleDataPtr, moduleDataPtr + moduleSize);
-    databaseRawBuffer.insert(databaseRawBuffer.end(), metaData.begin(), metaData.end());
-    jenova::MemoryBuffer compressedData = jenova::CompressBuffer(databaseRawBuffer.data(), databaseRawBuffer.size());
+    jenova::MemoryBuffer databaseRawBuffer(moduleSize + metaData.size());
+    memcpy(databaseRawBuffer.data(), moduleDataPtr, moduleSize);
+    memcpy(databaseRawBuffer.data() + moduleSize, metaData.data(), metaData.size());
+    jenova::MemoryBuffer compressedData = jenova::CompressBuffer(databaseRawBuffer.data(), databaseRawBuffer.size(), compressionCodec, compressionLevel);
+    if (compressedData.size() == 0)
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Compress Module Database Using %s Codec.", jenova::GetCompressionCodecName(compressionCodec).c_str());
+        return false;
+    }
 
     // Update Compression Ratio
     moduleDatabaseHeader.compressionRatio = jenova::CalculateCompressionRatio(databaseRawBuffer.size(), compressedData.size());
@@ -1798,8 +2286,8 @@ bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseNa
     jenova::MemoryBuffer().swap(compressedData);
 
     // Verbose
-    jenova::VerboseByID(__LINE__, "Code Compression Ratio : %02f%%", moduleDatabaseHeader.compressionRatio);
-    jenova::VerboseByID(__LINE__, "Jenova Compiled Module Database Cached At (%s)", defaultModuleDatabasePath.c_str());
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Code Compression Ratio : %02f%% (%s)", moduleDatabaseHeader.compressionRatio, jenova::GetCompressionCodecName(compressionCodec).c_str());
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Jenova Compiled Module Database Cached At (%s)", defaultModuleDatabasePath.c_str());
 
     // All Good
     return true;
@@ -1808,10 +2296,42 @@ bool JenovaInterpreter::CreateModuleDatabase(const std::string& moduleDatabaseNa
 {
     return CreateModuleDatabase(moduleDatabaseName, buildResult.builtModuleData.data(), buildResult.builtModuleData.size(), buildResult.moduleMetaData);
 }
+jenova::MemoryBuffer JenovaInterpreter::RecompressModuleDatabase(const jenova::MemoryBuffer& databaseData, jenova::CompressionCodec compressionCodec, int compressionLevel)
+{
+    // Validate Header
+    if (databaseData.size() < sizeof(jenova::ModuleDatabaseHeader)) return jenova::MemoryBuffer();
+    jenova::ModuleDatabaseHeader databaseHeader;
+    memcpy(&databaseHeader, databaseData.data(), sizeof(jenova::ModuleDatabaseHeader));
+    if (databaseData.size() < sizeof(jenova::ModuleDatabaseHeader) + databaseHeader.encodedDataSize) return jenova::MemoryBuffer();
+
+    // Already Encoded With Requested Codec
+    if (databaseHeader.compressionCodec == compressionCodec && databaseHeader.compressionLevel == uint8_t(compressionLevel)) return databaseData;
+
+    // Decode Using Original Codec
+    jenova::MemoryBuffer decompressedData = jenova::DecompressBuffer((void*)&databaseData[sizeof(jenova::ModuleDatabaseHeader)], databaseHeader.encodedDataSize,
+        databaseHeader.compressionCodec, databaseHeader.moduleSize + databaseHeader.metaDataSize);
+    if (decompressedData.size() == 0) return jenova::MemoryBuffer();
+
+    // Encode Using Requested Codec
+    jenova::MemoryBuffer compressedData = jenova::CompressBuffer(decompressedData.data(), decompressedData.size(), compressionCodec, compressionLevel);
+    if (compressedData.size() == 0) return jenova::MemoryBuffer();
+
+    // Update Header
+    databaseHeader.compressionCodec = compressionCodec;
+    databaseHeader.compressionLevel = uint8_t(std::clamp(compressionLevel, 0, 255));
+    databaseHeader.encodedDataSize = compressedData.size();
+    databaseHeader.compressionRatio = jenova::CalculateCompressionRatio(decompressedData.size(), compressedData.size());
+
+    // Create Database Buffer
+    jenova::MemoryBuffer recompressedDatabase(sizeof(jenova::ModuleDatabaseHeader) + compressedData.size());
+    memcpy(recompressedDatabase.data(), &databaseHeader, sizeof(jenova::ModuleDatabaseHeader));
+    memcpy(recompressedDatabase.data() + sizeof(jenova::ModuleDatabaseHeader), compressedData.data(), compressedData.size());
+    return recompressedDatabase;
+}
 bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName)
 {
     // Verbose
-    jenova::VerboseByID(__LINE__, "Loading Jenova Compiled Module Database...");
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Loading Jenova Compiled Module Database...");
 
     // Database Raw Data
     jenova::MemoryBuffer databaseRawData;
@@ -1871,47 +2391,57 @@ bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName
             databaseHeader->databaseVersion[0], databaseHeader->databaseVersion[1], databaseHeader->databaseVersion[2], databaseHeader->databaseVersion[3]);
     }
 
-    // Decompress Data
-    const uint8_t* databaseEncodedDataPtr = (const uint8_t*)&databaseRawData[sizeof(jenova::ModuleDatabaseHeader)];
-    jenova::MemoryBuffer encodedRawBuffer;
-    encodedRawBuffer.insert(encodedRawBuffer.end(), databaseEncodedDataPtr, databaseEncodedDataPtr + databaseHeader->encodedDataSize);
-    jenova::MemoryBuffer decompressedData = jenova::DecompressBuffer(encodedRawBuffer.data(), encodedRawBuffer.size());
-    if (decompressedData.size() == 0) return false;
-
-    // Get Data Pointers
-    const uint8_t* moduleDataPtr = decompressedData.data();
+    // Validate Encoded Data Size
+    if (databaseRawData.size() < sizeof(jenova::ModuleDatabaseHeader) + databaseHeader->encodedDataSize)
+    {
+        jenova::Error("Jenova Interpreter", "Jenova Module Database is Truncated!");
+        return false;
+    }
+
+    // Allocate Module Image [Decompressed Directly Into Loader Memory, Metadata Trails Module]
     const size_t moduleSize = databaseHeader->moduleSize;
-    const char* metaDataDataPtr = (const char*)&decompressedData[databaseHeader->moduleSize];
-    const jenova::SerializedData metaData(metaDataDataPtr, databaseHeader->metaDataSize);
+    const size_t imageSize = databaseHeader->moduleSize + databaseHeader->metaDataSize;
+    uint8_t* moduleImagePtr = (uint8_t*)JenovaLoader::AllocateModuleImage(imageSize);
+    if (!moduleImagePtr)
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Allocate Jenova Module Image.");
+        return false;
+    }
+
+    // Decompress Data
+    uint8_t* databaseEncodedDataPtr = &databaseRawData[sizeof(jenova::ModuleDatabaseHeader)];
+    if (!jenova::DecompressBufferTo(databaseEncodedDataPtr, databaseHeader->encodedDataSize, databaseHeader->compressionCodec, moduleImagePtr, imageSize))
+    {
+        jenova::Error("Jenova Interpreter", "Failed to Decompress Jenova Module Database Using %s Codec.", jenova::GetCompressionCodecName(databaseHeader->compressionCodec).c_str());
+        JenovaLoader::DiscardModuleImage(moduleImagePtr);
+        return false;
+    }
+
+    // Extract Metadata [Image Is Trimmed to Module Size by Loader]
+    const jenova::SerializedData metaData((const char*)&moduleImagePtr[moduleSize], databaseHeader->metaDataSize);
+    jenova::MemoryBuffer().swap(databaseRawData);
 
     // Check If Module Is Already Loaded
+    bool deployResult = true;
     if (GetModuleBaseAddress() == 0)
     {
         // Load Module
-        if (!LoadModule(moduleDataPtr, moduleSize, metaData))
-        {
-            jenova::Error("Jenova Interpreter", "Unable to Deploy and Load Compiled Jenova Module From Database.");
-            std::vector<uint8_t>().swap(databaseRawData);
-            return false;
-        }
+        deployResult = LoadModule(moduleImagePtr, moduleSize, metaData);
+        if (!deployResult) jenova::Error("Jenova Interpreter", "Unable to Deploy and Load Compiled Jenova Module From Database.");
     }
     else
     {
         // Reload Module
-        if (!JenovaInterpreter::ReloadModule(moduleDataPtr, moduleSize, metaData))
-        {
-            jenova::Error("Jenova Interpreter", "Unable to Deploy and Reload Compiled Jenova Module From Database.");
-            return false;
-        }
+        deployResult = JenovaInterpreter::ReloadModule(moduleImagePtr, moduleSize, metaData);
+        if (!deployResult) jenova::Error("Jenova Interpreter", "Unable to Deploy and Reload Compiled Jenova Module From Database.");
     }
 
-    // Release Buffers
-    jenova::MemoryBuffer().swap(databaseRawData);
-    jenova::MemoryBuffer().swap(encodedRawBuffer);
-    jenova::MemoryBuffer().swap(decompressedData);
+    // Release Module Image If Loader Didn't Consume It
+    JenovaLoader::DiscardModuleImage(moduleImagePtr);
+    if (!deployResult) return false;
 
     // Verbose
-    jenova::VerboseByID(__LINE__, "Jenova Compiled Module Deployed and Loaded from Database Cache.");
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Jenova Compiled Module Deployed and Loaded from Database Cache.");
 
     // All Good
     return true;
@@ -1919,7 +2449,7 @@ bool JenovaInterpreter::DeployFromDatabase(const std::string& moduleDatabaseName
 bool JenovaInterpreter::IsDatabaseAvailable(const std::string& moduleDatabaseName)
 {
     // Verbose
-    jenova::VerboseByID(__LINE__, "Validating Jenova Compiled Module Database...");
+    JENOVA_VERBOSE_BY_ID(__LINE__, "Validating Jenova Compiled Module Database...");
 
     // Create Database File Path
     String defaultModuleDatabasePath = String(jenova::GlobalSettings::DefaultJenovaBootPath) + AS_GD_STRING(moduleDatabaseName);
@@ -30,6 +30,21 @@ public:
     static bool ReloadModule(const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData);
     static bool ReloadModule(const jenova::BuildResult& buildResult);
     static bool UnloadModule(const jenova::ModuleUnloadStage& unloadStage);
+    static bool MigrateScriptInstances();
+    static bool MigrateScriptInstances(const jenova::IdentityList& scriptUIDs);
+    static double GetLastReloadLatency();
+    static size_t GetLastReloadDroppedFrames();
+    static void CollectReloadFrame();
+    static size_t GetModuleMemoryFootprint();
+    static jenova::ModuleBootStatistics GetModuleBootStatistics();
+    static bool LoadSatelliteModule(const jenova::BuildResult& buildResult, const jenova::SymbolList& reboundSymbols);
+    static size_t RebindSatelliteSymbols(jenova::ModuleHandle newSatelliteHandle);
+    static void ReleaseSatelliteModules();
+    static bool HasScript(const std::string& scriptUID);
+    static jenova::ModuleAddress GetScriptBaseAddress(const std::string& scriptUID);
+    static jenova::ModuleGenerationRef GetScriptModuleGeneration(const std::string& scriptUID);
+    static void UpdateProfilerMethodTable();
+    static JenovaScriptProfiler::MethodID GetFunctionMethodID(const std::string& functionName, const std::string& scriptUID);
     static bool LoadDebugSymbol(const std::string symbolFilePath);
     static intptr_t GetModuleBaseAddress();
     static jenova::FunctionList GetFunctionsList(const std::string& scriptUID);
@@ -45,7 +60,9 @@ public:
     static jenova::SerializedData GenerateModuleMetadata(const std::string& mapFilePath, const jenova::ModuleList& scriptModules, const jenova::BuildResult& buildResult);
     static bool UpdateConfigurationsFromMetaData(const jenova::SerializedData& metaData);
     static bool UpdatePropertyStorageFromMetaData();
+    static bool AllocateScriptProperties(const std::string& scriptUID, const jenova::json_t& scriptMetadata);
     static bool FlushPropertyStorage();
+    static bool FlushScriptPropertyStorage(const std::string& scriptUID);
     static jenova::PropertyList GetPropertiesList(std::string& scriptUID);
     static std::string GetPropertyType(const std::string& propertyName, std::string& scriptUID);
     static jenova::PropertyAddress GetPropertyAddress(const std::string& propertyName, std::string& scriptUID);
@@ -56,11 +73,15 @@ public:
     static jenova::FunctionPointer SolveVirtualFunction(jenova::ModuleHandle moduleHandle, const char* functionName);
     static void SetDebugModeExecutionState(bool debugModeState);
     static jenova::ModuleHandle LoadShellModule(const uint8_t* moduleDataPtr, const size_t moduleSize);
+    static jenova::ModuleGenerationRef AcquireModuleGeneration(const std::string& scriptUID);
+    static void ReleaseModuleGeneration(const jenova::ModuleGenerationRef& moduleGeneration);
 
 // Module Database API
 public:
-    static bool CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData);
+    static bool CreateModuleDatabase(const std::string& moduleDatabaseName, const uint8_t* moduleDataPtr, const size_t moduleSize, const jenova::SerializedData& metaData,
+        jenova::CompressionCodec compressionCodec = jenova::GlobalSettings::DatabaseCompressionCodec, int compressionLevel = jenova::GlobalSettings::DatabaseCompressionLevel);
     static bool CreateModuleDatabase(const std::string& moduleDatabaseName, const jenova::BuildResult& buildResult);
+    static jenova::MemoryBuffer RecompressModuleDatabase(const jenova::MemoryBuffer& databaseData, jenova::CompressionCodec compressionCodec, int compressionLevel);
     static bool DeployFromDatabase(const std::string& moduleDatabaseName);
     static bool IsDatabaseAvailable(const std::string& moduleDatabaseName);
 
@@ -70,11 +91,21 @@ private:
     static inline bool                          isExecuting             = false;
     static inline jenova::ModuleHandle          moduleHandle            = nullptr;
     static inline jenova::ModuleAddress         moduleBaseAddress       = 0;
+    static inline jenova::ModuleGenerationRef   moduleGeneration        = nullptr;
     static inline jenova::json_t                moduleMetaData          = "{}";
     static inline size_t                        moduleBinarySize        = 0;
     static inline bool                          hasDebugInformation     = false;
     static inline bool                          executeInDebugMode      = false;
     static inline std::string                   moduleDiskPath          = "";
+    static inline double                        lastReloadLatency       = 0.0;
+    static inline size_t                        lastReloadDroppedFrames = 0;
+    static inline bool                          isCountingReloadFrames  = false;
+    static inline std::chrono::steady_clock::time_point reloadWindowStart;
+    static inline std::chrono::steady_clock::time_point reloadWindowEnd;
+    static inline std::chrono::steady_clock::time_point lastFramePresentTime;
+    static inline jenova::ModuleBootStatistics  moduleBootStatistics;
+    static inline std::unordered_map<std::string, jenova::SatelliteModule> satelliteModules;
+    static inline jenova::ModuleSymbolBinding   moduleSymbolBinding     = jenova::ModuleSymbolBinding::ImmediateGlobal;
     static inline jenova::InterpreterBackend    interpreterBackend      = jenova::InterpreterBackend::TinyCC;
     static inline jenova::PointerStorage        propertyStorage         = jenova::PointerStorage();
     static inline jenova::PropertySetMethod     propertySetMethod       = jenova::PropertySetMethod::DirectAssign;
@@ -141,6 +141,8 @@ bool CPPScriptLanguage::_is_using_templates()
 }
 Dictionary CPPScriptLanguage::_validate(const String& p_script, const String& p_path, bool p_validate_functions, bool p_validate_errors, bool p_validate_warnings, bool p_validate_safe_lines) const
 {
+	// Script Editor Validates Once Typing Settles, Compile Edited Source Ahead
+	if (jenova::GlobalStorage::BuildServiceMode == jenova::BuildServiceMode::CompileWhileEditing) jenova::QueueEditedScriptCompile(p_path, p_script);
 	return Dictionary();
 }
 String CPPScriptLanguage::_validate_path(const String& p_path) const
@@ -260,16 +262,16 @@ TypedArray<Dictionary> CPPScriptLanguage::_debug_get_current_stack_info()
 }
 void CPPScriptLanguage::_reload_all_scripts()
 {
-	jenova::VerboseByID(__LINE__, "_reload_all_scripts Called");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "_reload_all_scripts Called");
 }
 void CPPScriptLanguage::_reload_scripts(const Array& p_scripts, bool p_soft_reload)
 {
 	// Called when a script gets edited while game is running
-	jenova::VerboseByID(__LINE__, "_reload_scripts Called");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "_reload_scripts Called");
 }
 void CPPScriptLanguage::_reload_tool_script(const Ref<Script>& p_script, bool p_soft_reload)
 {
-	jenova::VerboseByID(__LINE__, "_reload_tool_script Called");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "_reload_tool_script Called");
 }
 PackedStringArray CPPScriptLanguage::_get_recognized_extensions() const
 {
@@ -291,37 +293,41 @@ TypedArray<Dictionary> CPPScriptLanguage::_get_public_annotations() const
 }
 void CPPScriptLanguage::_profiling_start()
 {
+	JenovaScriptProfiler::StartProfiling();
 	jenova::Output("Jenova Profiler Started.");
 }
 void CPPScriptLanguage::_profiling_stop()
 {
+	JenovaScriptProfiler::StopProfiling();
 	jenova::Output("Jenova Profiler Stopped.");
 }
 void CPPScriptLanguage::_profiling_set_save_native_calls(bool p_enable)
 {
-	jenova::VerboseByID(__LINE__, "_profiling_set_save_native_calls : %s", p_enable ? "True" : "False");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "_profiling_set_save_native_calls : %s", p_enable ? "True" : "False");
 }
 int32_t CPPScriptLanguage::_profiling_get_accumulated_data(ScriptLanguageExtensionProfilingInfo* p_info_array, int32_t p_info_max)
 {
-	return 0;
+	return JenovaScriptProfiler::GetAccumulatedData(p_info_array, p_info_max);
 }
 int32_t CPPScriptLanguage::_profiling_get_frame_data(ScriptLanguageExtensionProfilingInfo* p_info_array, int32_t p_info_max)
 {
-	return 0;
+	return JenovaScriptProfiler::GetFrameData(p_info_array, p_info_max);
 }
 void CPPScriptLanguage::_frame()
 {
-	// Process
+	// Aggregate Profilers Frame Data
+	JenovaScriptProfiler::CollectFrame();
+	JenovaTinyProfiler::CollectFrame();
 }
 bool CPPScriptLanguage::_handles_global_class_type(const String& p_type) const
 {
-	jenova::VerboseByID(__LINE__, "_handles_global_class_type [%s]", AS_C_STRING(p_type));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "_handles_global_class_type [%s]", AS_C_STRING(p_type));
 	return p_type == _get_type();
 }
 Dictionary CPPScriptLanguage::_get_global_class_name(const String& p_path) const
 {
 	// Remove
-	jenova::VerboseByID(__LINE__, "_get_global_class_name [%s]", AS_C_STRING(p_path));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "_get_global_class_name [%s]", AS_C_STRING(p_path));
 
 	// Return Global Class Name
 	Dictionary classInfo;
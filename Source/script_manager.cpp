@@ -48,13 +48,13 @@ JenovaScriptManager* JenovaScriptManager::get_singleton()
 }
 bool JenovaScriptManager::add_script_object(CPPScript* scriptObject)
 {
-	jenova::VerboseByID(__LINE__, "New Script Object Added to Manager : %p", scriptObject);
+	JENOVA_VERBOSE_BY_ID(__LINE__, "New Script Object Added to Manager : %p", scriptObject);
 	scriptObjects.push_back(scriptObject);
 	return true;
 }
 bool JenovaScriptManager::remove_script_object(CPPScript* scriptObject)
 {
-	jenova::VerboseByID(__LINE__, "Script Object Removed from Manager : %p", scriptObject);
+	JENOVA_VERBOSE_BY_ID(__LINE__, "Script Object Removed from Manager : %p", scriptObject);
 	auto it = std::find(scriptObjects.begin(), scriptObjects.end(), scriptObject);
 	if (it != scriptObjects.end()) 
 	{
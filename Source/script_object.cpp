@@ -58,7 +58,7 @@ StringName CPPScript::_get_instance_base_type() const
 void* CPPScript::_instance_create(Object* p_for_object) const
 {
 	godot::Node* parentNode = godot::Object::cast_to<godot::Node>(p_for_object);
-	jenova::VerboseByID(__LINE__, "Adding C++ Script (%s) Instance to (%s)", AS_C_STRING(this->get_path()), AS_C_STRING(parentNode->get_name()));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "Adding C++ Script (%s) Instance to (%s)", AS_C_STRING(this->get_path()), AS_C_STRING(parentNode->get_name()));
 	CPPScriptInstance* instance = memnew(CPPScriptInstance(p_for_object, Ref<CPPScript>(this)));
 	return CPPScriptInstance::create_native_instance(instance);
 }
@@ -76,12 +76,12 @@ bool CPPScript::_has_source_code() const
 }
 String CPPScript::_get_source_code() const
 {
-	if (!this->get_path().is_empty()) jenova::VerboseByID(__LINE__, "Get C++ Script Source (%s) [%p]", AS_C_STRING(this->get_path()), this);
+	if (!this->get_path().is_empty()) JENOVA_VERBOSE_BY_ID(__LINE__, "Get C++ Script Source (%s) [%p]", AS_C_STRING(this->get_path()), this);
 	return source_code;
 }
 void CPPScript::_set_source_code(const String& p_code)
 {
-	if (!this->get_path().is_empty()) jenova::VerboseByID(__LINE__, "Set C++ Script Source (%s) [%p]", AS_C_STRING(this->get_path()), this);
+	if (!this->get_path().is_empty()) JENOVA_VERBOSE_BY_ID(__LINE__, "Set C++ Script Source (%s) [%p]", AS_C_STRING(this->get_path()), this);
 	source_code = p_code;
 
 	// Detect Tool Macro
@@ -90,7 +90,7 @@ void CPPScript::_set_source_code(const String& p_code)
 }
 Error CPPScript::_reload(bool p_keep_state)
 {
-	jenova::VerboseByID(__LINE__, "Reloading C++ Script (%s)", AS_C_STRING(this->get_path()));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "Reloading C++ Script (%s)", AS_C_STRING(this->get_path()));
 	if (!jenova::UpdateGlobalStorageFromEditorSettings()) return Error::FAILED;
 	if (jenova::GlobalStorage::CurrentChangesTriggerMode == jenova::ChangesTriggerMode::TriggerOnScriptReload)
 	{
@@ -137,7 +137,7 @@ bool CPPScript::_has_method(const StringName& p_method) const
 }
 bool CPPScript::_has_static_method(const StringName& p_method) const
 {
-	jenova::VerboseByID(__LINE__, "CPPScript::_has_static_method (%s)", AS_C_STRING(p_method));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScript::_has_static_method (%s)", AS_C_STRING(p_method));
 	return false; // Not Supported Yet
 }
 Dictionary CPPScript::_get_method_info(const StringName& p_method) const
@@ -170,28 +170,28 @@ ScriptLanguage* CPPScript::_get_language() const
 }
 bool CPPScript::_has_script_signal(const StringName& p_signal) const
 {
-	jenova::VerboseByID(__LINE__, "CPPScript::_has_script_signal (%s)", AS_C_STRING(p_signal));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScript::_has_script_signal (%s)", AS_C_STRING(p_signal));
 	return false; // Not Supported Yet
 }
 TypedArray<Dictionary> CPPScript::_get_script_signal_list() const
 {
-	jenova::VerboseByID(__LINE__, "CPPScript::_get_script_signal_list");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScript::_get_script_signal_list");
 	return TypedArray<Dictionary>();
 }
 bool CPPScript::_has_property_default_value(const StringName& p_property) const
 {
-	jenova::VerboseByID(__LINE__, "CPPScript::_has_property_default_value (%s)", AS_C_STRING(p_property));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScript::_has_property_default_value (%s)", AS_C_STRING(p_property));
 	// This will cause property change flag on assigned node!
 	return false;
 }
 Variant CPPScript::_get_property_default_value(const StringName& p_property) const
 {
-	jenova::VerboseByID(__LINE__, "CPPScript::_get_property_default_value (%s)", AS_C_STRING(p_property));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScript::_get_property_default_value (%s)", AS_C_STRING(p_property));
 	return Variant();  // Not Supported Yet
 }
 void CPPScript::_update_exports()
 {
-	jenova::VerboseByID(__LINE__, "CPPScript::_update_exports");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScript::_update_exports");
 }
 TypedArray<Dictionary> CPPScript::_get_script_method_list() const
 {
@@ -211,17 +211,17 @@ TypedArray<Dictionary> CPPScript::_get_script_property_list() const
 }
 int32_t CPPScript::_get_member_line(const StringName& p_member) const
 {
-	jenova::VerboseByID(__LINE__, "CPPScript::_get_member_line (%s)", AS_C_STRING(p_member));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScript::_get_member_line (%s)", AS_C_STRING(p_member));
 	return 0;  // Not Supported Yet
 }
 Dictionary CPPScript::_get_constants() const
 {
-	jenova::VerboseByID(__LINE__, "CPPScript::_get_constants");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScript::_get_constants");
 	return Dictionary();  // Not Supported Yet
 }
 TypedArray<StringName> CPPScript::_get_members() const
 {
-	jenova::VerboseByID(__LINE__, "CPPScript::_get_members");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScript::_get_members");
 	return TypedArray<StringName>();  // Not Supported Yet
 }
 bool CPPScript::_is_placeholder_fallback_enabled() const
@@ -230,7 +230,7 @@ bool CPPScript::_is_placeholder_fallback_enabled() const
 }
 Variant CPPScript::_get_rpc_config() const
 {
-	jenova::VerboseByID(__LINE__, "CPPScript::_get_rpc_config");
+	JENOVA_VERBOSE_BY_ID(__LINE__, "CPPScript::_get_rpc_config");
 	return Variant();  // Not Supported Yet
 }
 
@@ -36,7 +36,7 @@ Variant CPPScriptResourceLoader::_load(const String& p_path, const String& origi
 	cppScript->_set_source_code(FileAccess::get_file_as_string(p_path));
 
 	// Verbose
-	jenova::VerboseByID(__LINE__, "C++ Script (%s) Loaded.", AS_C_STRING(p_path));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "C++ Script (%s) Loaded.", AS_C_STRING(p_path));
 
 	return cppScript;
 }
@@ -71,7 +71,7 @@ void CPPScriptResourceSaver::deinit()
 }
 Error CPPScriptResourceSaver::_save(const Ref<Resource>& p_resource, const String& p_path, uint32_t p_flags)
 {
-	jenova::VerboseByID(__LINE__, "Saving C++ Script (%s)...", AS_C_STRING(p_path));
+	JENOVA_VERBOSE_BY_ID(__LINE__, "Saving C++ Script (%s)...", AS_C_STRING(p_path));
 
 	CPPScript* script = Object::cast_to<CPPScript>(p_resource.ptr());
 	if (script != nullptr)
@@ -83,7 +83,7 @@ Error CPPScriptResourceSaver::_save(const Ref<Resource>& p_resource, const Strin
 			handle->close();
 
 			// Verbose
-			jenova::VerboseByID(__LINE__, "C++ Script (%s) Saved.", AS_C_STRING(p_path));
+			JENOVA_VERBOSE_BY_ID(__LINE__, "C++ Script (%s) Saved.", AS_C_STRING(p_path));
 
 			return Error::OK;
 		}
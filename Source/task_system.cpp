@@ -38,6 +38,7 @@ struct Task
 static std::unordered_map<TaskID, Task> tasks;
 static std::mutex taskMutex;
 static TaskID nextTaskID = 1;
+static std::atomic<size_t> pendingTaskCount = 0;
 
 // Jenova Task System Implementation
 TaskID JenovaTaskSystem::InitiateTask(TaskFunction function)
@@ -47,6 +48,7 @@ TaskID JenovaTaskSystem::InitiateTask(TaskFunction function)
     Task& task = tasks[taskID];
     task.function = function;
     task.isDone = false;
+    pendingTaskCount.fetch_add(1, std::memory_order_relaxed);
     pthread_create(&task.thread, nullptr, &JenovaTaskSystem::TaskRunner, &task);
     return taskID;
 }
@@ -65,10 +67,17 @@ void JenovaTaskSystem::ClearTask(TaskID taskID)
         tasks.erase(taskID);
     }
 }
+size_t JenovaTaskSystem::GetPendingTaskCount()
+{
+    return pendingTaskCount.load(std::memory_order_relaxed);
+}
 void* JenovaTaskSystem::TaskRunner(void* taskPtr)
 {
     Task* task = static_cast<Task*>(taskPtr);
+    JenovaSamplingProfiler::RegisterThread("Task");
     task->function();
+    JenovaSamplingProfiler::UnregisterThread();
     task->isDone.store(true);
+    pendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
     return nullptr;
 }
\ No newline at end of file
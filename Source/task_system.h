@@ -23,6 +23,7 @@ public:
     static jenova::TaskID InitiateTask(jenova::TaskFunction function);
     static bool IsTaskComplete(jenova::TaskID taskID);
     static void ClearTask(jenova::TaskID taskID);
+    static size_t GetPendingTaskCount();
 
 private:
     static void* TaskRunner(void* taskPtr);
@@ -15,47 +15,1109 @@
 // Jenova SDK
 #include "Jenova.hpp"
 
+// Time Stamp Counter Intrinsics
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Standard Streams
+#include <iomanip>
+
+// Bit Manipulation
+#include <bit>
+
+// Jenova Tiny Profiler Internal Storage
+namespace jenova::profiler
+{
+    // Single Producer Ring Buffer, Owner Thread Writes And Aggregator Drains
+    struct ScopeEventBuffer
+    {
+        JenovaTinyProfiler::ProfilerEvent events[jenova::GlobalSettings::TinyProfilerEventBufferSize];
+        std::atomic<size_t> writeIndex = 0;
+        std::atomic<size_t> readIndex = 0;
+        std::atomic<size_t> droppedEvents = 0;
+        uint32_t scopeDepth = 0;
+        uint32_t threadIndex = 0;
+    };
+    struct TraceEvent
+    {
+        JenovaTinyProfiler::ProfilerEvent profilerEvent;
+        uint32_t threadIndex;
+    };
+    struct OpenScope
+    {
+        JenovaTinyProfiler::ScopeHash scopeHash;
+        int64_t timestamp;
+    };
+    struct ScopeAggregator
+    {
+        ScopeEventBuffer* eventBuffer;
+        std::vector<OpenScope> openScopes;
+    };
+    struct ScopeBufferLease
+    {
+        ScopeEventBuffer* eventBuffer = nullptr;
+        ~ScopeBufferLease();
+    };
+
+    // Tiny Profiler State
+    static std::atomic<bool> isScopeRecording = false;
+    static std::mutex scopeBuffersMutex;
+    static std::vector<std::unique_ptr<ScopeEventBuffer>> scopeBuffers;
+    static std::vector<ScopeEventBuffer*> freeScopeBuffers;
+    static std::vector<ScopeAggregator> scopeAggregators;
+    static std::vector<JenovaTinyProfiler::ScopeStatistics> scopeFrameStatistics;
+    static thread_local ScopeEventBuffer* currentScopeBuffer = nullptr;
+    static thread_local ScopeBufferLease scopeBufferLease;
+
+    // Trace Recorder State
+    static std::atomic<bool> isTraceRecording = false;
+    static bool scopeRecordingBeforeTrace = false;
+    static std::vector<TraceEvent> traceEvents;
+    static size_t traceRingCapacity = 0;
+    static size_t traceRingHead = 0;
+    static bool isTraceRingWrapped = false;
+    static std::unordered_set<std::string> internedScopeNames;
+    static std::mutex internedScopeNamesMutex;
+
+    // Utilities
+    static ScopeEventBuffer* AcquireScopeBuffer()
+    {
+        // Buffers Of Exited Threads Are Reused [Pending Events Are Still Drained In Order]
+        if (currentScopeBuffer) return currentScopeBuffer;
+        std::lock_guard<std::mutex> lock(scopeBuffersMutex);
+        if (!freeScopeBuffers.empty())
+        {
+            currentScopeBuffer = freeScopeBuffers.back();
+            freeScopeBuffers.pop_back();
+            currentScopeBuffer->scopeDepth = 0;
+        }
+        else
+        {
+            scopeBuffers.push_back(std::make_unique<ScopeEventBuffer>());
+            currentScopeBuffer = scopeBuffers.back().get();
+            currentScopeBuffer->threadIndex = uint32_t(scopeBuffers.size() - 1);
+        }
+        scopeBufferLease.eventBuffer = currentScopeBuffer;
+        return currentScopeBuffer;
+    }
+    ScopeBufferLease::~ScopeBufferLease()
+    {
+        if (!eventBuffer) return;
+        std::lock_guard<std::mutex> lock(scopeBuffersMutex);
+        freeScopeBuffers.push_back(eventBuffer);
+        currentScopeBuffer = nullptr;
+    }
+    static bool PushScopeEvent(ScopeEventBuffer* eventBuffer, const JenovaTinyProfiler::ProfilerEvent& profilerEvent)
+    {
+        size_t writeIndex = eventBuffer->writeIndex.load(std::memory_order_relaxed);
+        if (writeIndex - eventBuffer->readIndex.load(std::memory_order_acquire) >= jenova::GlobalSettings::TinyProfilerEventBufferSize)
+        {
+            eventBuffer->droppedEvents.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        eventBuffer->events[writeIndex % jenova::GlobalSettings::TinyProfilerEventBufferSize] = profilerEvent;
+        eventBuffer->writeIndex.store(writeIndex + 1, std::memory_order_release);
+        return true;
+    }
+    static void RecordScopeStatistics(const JenovaTinyProfiler::ProfilerEvent& endEvent, int64_t beginTimestamp)
+    {
+        double scopeTime = double(endEvent.timestamp - beginTimestamp) / 1000000.0;
+        for (auto& scopeStatistics : scopeFrameStatistics)
+        {
+            if (scopeStatistics.scopeHash == endEvent.scopeHash && scopeStatistics.depth == endEvent.depth)
+            {
+                scopeStatistics.callCount++;
+                scopeStatistics.totalTime += scopeTime;
+                scopeStatistics.minTime = std::min(scopeStatistics.minTime, scopeTime);
+                scopeStatistics.maxTime = std::max(scopeStatistics.maxTime, scopeTime);
+                return;
+            }
+        }
+        scopeFrameStatistics.push_back({ endEvent.scopeHash, endEvent.scopeName, endEvent.depth, 1, scopeTime, scopeTime, scopeTime });
+    }
+    static void DrainScopeBuffers()
+    {
+        // Caller Must Hold Scope Buffers Mutex
+        bool keepTraceEvents = isTraceRecording.load(std::memory_order_relaxed);
+        scopeAggregators.resize(scopeBuffers.size());
+        for (size_t i = 0; i < scopeBuffers.size(); i++)
+        {
+            ScopeAggregator& scopeAggregator = scopeAggregators[i];
+            scopeAggregator.eventBuffer = scopeBuffers[i].get();
+            size_t readIndex = scopeAggregator.eventBuffer->readIndex.load(std::memory_order_relaxed);
+            size_t writeIndex = scopeAggregator.eventBuffer->writeIndex.load(std::memory_order_acquire);
+            for (; readIndex < writeIndex; readIndex++)
+            {
+                const JenovaTinyProfiler::ProfilerEvent& profilerEvent = scopeAggregator.eventBuffer->events[readIndex % jenova::GlobalSettings::TinyProfilerEventBufferSize];
+                if (keepTraceEvents)
+                {
+                    // Ring Traces Keep Newest Events, Linear Traces Keep First Ones
+                    size_t traceCapacity = traceRingCapacity ? traceRingCapacity : jenova::GlobalSettings::TraceRecorderMaxEvents;
+                    if (traceEvents.size() < traceCapacity) traceEvents.push_back({ profilerEvent, scopeAggregator.eventBuffer->threadIndex });
+                    else if (traceRingCapacity)
+                    {
+                        traceEvents[traceRingHead] = { profilerEvent, scopeAggregator.eventBuffer->threadIndex };
+                        traceRingHead = (traceRingHead + 1) % traceRingCapacity;
+                        isTraceRingWrapped = true;
+                    }
+                }
+                if (profilerEvent.eventType == JenovaTinyProfiler::EventType::Begin)
+                {
+                    scopeAggregator.openScopes.resize(profilerEvent.depth);
+                    scopeAggregator.openScopes.push_back({ profilerEvent.scopeHash, profilerEvent.timestamp });
+                    continue;
+                }
+
+                // Match End Event With Its Begin Event [Unmatched Events Were Dropped]
+                if (profilerEvent.depth < scopeAggregator.openScopes.size() && scopeAggregator.openScopes[profilerEvent.depth].scopeHash == profilerEvent.scopeHash)
+                {
+                    RecordScopeStatistics(profilerEvent, scopeAggregator.openScopes[profilerEvent.depth].timestamp);
+                }
+                scopeAggregator.openScopes.resize(std::min(scopeAggregator.openScopes.size(), size_t(profilerEvent.depth)));
+            }
+            scopeAggregator.eventBuffer->readIndex.store(writeIndex, std::memory_order_release);
+        }
+    }
+    static void WriteEscapedTraceString(std::ofstream& traceFile, const char* traceString)
+    {
+        for (; *traceString; traceString++)
+        {
+            char traceChar = *traceString;
+            if (traceChar == '"' || traceChar == '\\') traceFile << '\\' << traceChar;
+            else if (uint8_t(traceChar) < 0x20) traceFile << ' ';
+            else traceFile << traceChar;
+        }
+    }
+}
+
 // Jenova Tiny Profiler Implementation
-void JenovaTinyProfiler::CreateCheckpoint(const std::string& checkPointName)
+void JenovaTinyProfiler::SetScopeRecording(bool recordingState)
+{
+    jenova::profiler::isScopeRecording.store(recordingState, std::memory_order_release);
+}
+bool JenovaTinyProfiler::IsScopeRecording()
+{
+    return jenova::profiler::isScopeRecording.load(std::memory_order_relaxed);
+}
+bool JenovaTinyProfiler::BeginScope(ScopeHash scopeHash, const char* scopeName)
 {
-    auto now = std::chrono::high_resolution_clock::now();
-    checkpoints[checkPointName] = now;
+    if (!IsScopeRecording()) return false;
+    jenova::profiler::ScopeEventBuffer* eventBuffer = jenova::profiler::AcquireScopeBuffer();
+    if (eventBuffer->scopeDepth >= jenova::GlobalSettings::TinyProfilerMaxScopeDepth) return false;
+    if (!jenova::profiler::PushScopeEvent(eventBuffer, { scopeHash, scopeName, ReadClock(), eventBuffer->scopeDepth, EventType::Begin })) return false;
+    eventBuffer->scopeDepth++;
+    return true;
 }
-double JenovaTinyProfiler::GetCheckpointTime(const std::string& checkPointName)
+void JenovaTinyProfiler::EndScope(ScopeHash scopeHash, const char* scopeName)
 {
-    auto now = std::chrono::high_resolution_clock::now();
-    if (checkpoints.find(checkPointName) != checkpoints.end())
+    jenova::profiler::ScopeEventBuffer* eventBuffer = jenova::profiler::currentScopeBuffer;
+    eventBuffer->scopeDepth--;
+    jenova::profiler::PushScopeEvent(eventBuffer, { scopeHash, scopeName, ReadClock(), eventBuffer->scopeDepth, EventType::End });
+}
+void JenovaTinyProfiler::CollectFrame()
+{
+    std::lock_guard<std::mutex> lock(jenova::profiler::scopeBuffersMutex);
+    jenova::profiler::scopeFrameStatistics.clear();
+    jenova::profiler::DrainScopeBuffers();
+}
+std::vector<JenovaTinyProfiler::ScopeStatistics> JenovaTinyProfiler::GetFrameStatistics()
+{
+    std::lock_guard<std::mutex> lock(jenova::profiler::scopeBuffersMutex);
+    return jenova::profiler::scopeFrameStatistics;
+}
+size_t JenovaTinyProfiler::GetDroppedEventCount()
+{
+    std::lock_guard<std::mutex> lock(jenova::profiler::scopeBuffersMutex);
+    size_t droppedEvents = 0;
+    for (const auto& eventBuffer : jenova::profiler::scopeBuffers) droppedEvents += eventBuffer->droppedEvents.load(std::memory_order_relaxed);
+    return droppedEvents;
+}
+void JenovaTinyProfiler::StartTraceRecording(size_t ringCapacity)
+{
+    std::lock_guard<std::mutex> lock(jenova::profiler::scopeBuffersMutex);
+    if (IsTraceRecording()) return;
+
+    // Discard Events Recorded Before Trace
+    jenova::profiler::DrainScopeBuffers();
+    jenova::profiler::traceEvents.clear();
+    jenova::profiler::traceRingCapacity = ringCapacity;
+    jenova::profiler::traceRingHead = 0;
+    jenova::profiler::isTraceRingWrapped = false;
+
+    // Trace Recording Forces Scope Recording
+    jenova::profiler::scopeRecordingBeforeTrace = IsScopeRecording();
+    jenova::profiler::isTraceRecording.store(true, std::memory_order_release);
+    SetScopeRecording(true);
+}
+bool JenovaTinyProfiler::StopTraceRecording(const std::string& traceFilePath)
+{
+    std::lock_guard<std::mutex> lock(jenova::profiler::scopeBuffersMutex);
+    if (!IsTraceRecording()) return false;
+
+    // Collect Remaining Events And Stop Recording
+    jenova::profiler::DrainScopeBuffers();
+    jenova::profiler::isTraceRecording.store(false, std::memory_order_release);
+    SetScopeRecording(jenova::profiler::scopeRecordingBeforeTrace);
+    std::vector<jenova::profiler::TraceEvent> traceEvents = std::move(jenova::profiler::traceEvents);
+    jenova::profiler::traceEvents.clear();
+    std::rotate(traceEvents.begin(), traceEvents.begin() + jenova::profiler::traceRingHead, traceEvents.end());
+    if (jenova::profiler::isTraceRingWrapped)
+    {
+        // Overwritten Ring Leaves End Events Whose Begin Is Gone
+        std::unordered_map<uint32_t, std::vector<bool>> openScopes;
+        std::erase_if(traceEvents, [&](const jenova::profiler::TraceEvent& traceEvent)
+        {
+            std::vector<bool>& threadScopes = openScopes[traceEvent.threadIndex];
+            if (threadScopes.size() <= traceEvent.profilerEvent.depth) threadScopes.resize(traceEvent.profilerEvent.depth + 1, false);
+            bool isOrphanEvent = traceEvent.profilerEvent.eventType == EventType::End && !threadScopes[traceEvent.profilerEvent.depth];
+            threadScopes[traceEvent.profilerEvent.depth] = traceEvent.profilerEvent.eventType == EventType::Begin;
+            return isOrphanEvent;
+        });
+    }
+    jenova::profiler::traceRingCapacity = 0;
+    jenova::profiler::traceRingHead = 0;
+    jenova::profiler::isTraceRingWrapped = false;
+    if (traceEvents.empty()) return false;
+
+    // Write Chrome Trace Event JSON [Loadable In chrome://tracing And Perfetto UI]
+    std::ofstream traceFile(traceFilePath, std::ios::out | std::ios::trunc);
+    if (!traceFile.is_open()) return false;
+    int64_t traceStartTime = traceEvents.front().profilerEvent.timestamp;
+    for (const auto& traceEvent : traceEvents) traceStartTime = std::min(traceStartTime, traceEvent.profilerEvent.timestamp);
+    traceFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    for (size_t i = 0; i < jenova::profiler::scopeBuffers.size(); i++)
+    {
+        traceFile << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i << ",\"args\":{\"name\":\"" << "Jenova Thread " << i << "\"}},\n";
+    }
+    for (size_t i = 0; i < traceEvents.size(); i++)
     {
-        auto duration = std::chrono::duration<double, std::milli>(now - checkpoints[checkPointName]);
-        return duration.count();
+        const auto& traceEvent = traceEvents[i];
+        traceFile << "{\"name\":\"";
+        jenova::profiler::WriteEscapedTraceString(traceFile, traceEvent.profilerEvent.scopeName);
+        traceFile << "\",\"ph\":\"" << (traceEvent.profilerEvent.eventType == EventType::Begin ? "B" : "E") << "\",\"ts\":";
+        traceFile << std::fixed << std::setprecision(3) << double(traceEvent.profilerEvent.timestamp - traceStartTime) / 1000.0;
+        traceFile << ",\"pid\":1,\"tid\":" << traceEvent.threadIndex << "}" << (i + 1 == traceEvents.size() ? "\n" : ",\n");
     }
-    return -1.0;
+    traceFile << "]}\n";
+    return traceFile.good();
+}
+bool JenovaTinyProfiler::IsTraceRecording()
+{
+    return jenova::profiler::isTraceRecording.load(std::memory_order_relaxed);
+}
+const char* JenovaTinyProfiler::InternScopeName(const std::string& scopeName)
+{
+    // Interned Names Live Until Shutdown So Events Can Reference Them
+    std::lock_guard<std::mutex> lock(jenova::profiler::internedScopeNamesMutex);
+    return jenova::profiler::internedScopeNames.insert(scopeName).first->c_str();
 }
-void JenovaTinyProfiler::DeleteCheckpoint(const std::string& checkPointName)
+int64_t JenovaTinyProfiler::ReadClock()
 {
-    checkpoints.erase(checkPointName);
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
 }
-double JenovaTinyProfiler::GetCheckpointTimeAndRestart(const std::string& checkPointName)
+void JenovaTinyProfiler::CreateCheckpoint(ScopeHash checkPointHash)
+{
+    int64_t now = ReadClock();
+    std::lock_guard<std::mutex> lock(checkpointsMutex);
+    checkpoints[checkPointHash] = now;
+}
+double JenovaTinyProfiler::GetCheckpointTime(ScopeHash checkPointHash)
+{
+    int64_t now = ReadClock();
+    std::lock_guard<std::mutex> lock(checkpointsMutex);
+    auto checkpoint = checkpoints.find(checkPointHash);
+    if (checkpoint == checkpoints.end()) return -1.0;
+    return double(now - checkpoint->second) / 1000000.0;
+}
+void JenovaTinyProfiler::DeleteCheckpoint(ScopeHash checkPointHash)
+{
+    std::lock_guard<std::mutex> lock(checkpointsMutex);
+    checkpoints.erase(checkPointHash);
+}
+double JenovaTinyProfiler::GetCheckpointTimeAndRestart(ScopeHash checkPointHash)
 {
     double result = -1.0;
-    auto now = std::chrono::high_resolution_clock::now();
-    if (checkpoints.find(checkPointName) != checkpoints.end())
-    {
-        auto duration = std::chrono::duration<double, std::milli>(now - checkpoints[checkPointName]);
-        result = duration.count();
-    }
-    checkpoints[checkPointName] = std::chrono::high_resolution_clock::now();
+    int64_t now = ReadClock();
+    std::lock_guard<std::mutex> lock(checkpointsMutex);
+    auto checkpoint = checkpoints.find(checkPointHash);
+    if (checkpoint != checkpoints.end()) result = double(now - checkpoint->second) / 1000000.0;
+    checkpoints[checkPointHash] = ReadClock();
     return result;
 }
-double JenovaTinyProfiler::GetCheckpointTimeAndDispose(const std::string& checkPointName)
+double JenovaTinyProfiler::GetCheckpointTimeAndDispose(ScopeHash checkPointHash)
 {
     double result = -1.0;
-    auto now = std::chrono::high_resolution_clock::now();
-    if (checkpoints.find(checkPointName) != checkpoints.end())
+    int64_t now = ReadClock();
+    std::lock_guard<std::mutex> lock(checkpointsMutex);
+    auto checkpoint = checkpoints.find(checkPointHash);
+    if (checkpoint != checkpoints.end())
     {
-        auto duration = std::chrono::duration<double, std::milli>(now - checkpoints[checkPointName]);
-        result = duration.count();
+        result = double(now - checkpoint->second) / 1000000.0;
+        checkpoints.erase(checkpoint);
     }
-    DeleteCheckpoint(checkPointName);
     return result;
-}
\ No newline at end of file
+}
+void JenovaTinyProfiler::CreateCheckpoint(const char* checkPointName)
+{
+    CreateCheckpoint(HashScopeName(checkPointName));
+}
+double JenovaTinyProfiler::GetCheckpointTime(const char* checkPointName)
+{
+    return GetCheckpointTime(HashScopeName(checkPointName));
+}
+void JenovaTinyProfiler::DeleteCheckpoint(const char* checkPointName)
+{
+    DeleteCheckpoint(HashScopeName(checkPointName));
+}
+double JenovaTinyProfiler::GetCheckpointTimeAndRestart(const char* checkPointName)
+{
+    return GetCheckpointTimeAndRestart(HashScopeName(checkPointName));
+}
+double JenovaTinyProfiler::GetCheckpointTimeAndDispose(const char* checkPointName)
+{
+    return GetCheckpointTimeAndDispose(HashScopeName(checkPointName));
+}
+
+// Jenova Script Profiler Internal Storage
+namespace jenova::profiler
+{
+    // Counters Are Only Written By Owner Thread, Atomics Keep Aggregation Reads Well Defined
+    struct MethodCounters
+    {
+        std::atomic<uint64_t> callCount = 0;
+        std::atomic<uint64_t> totalTicks = 0;
+        std::atomic<uint64_t> selfTicks = 0;
+    };
+    struct MethodSnapshot
+    {
+        uint64_t callCount = 0;
+        uint64_t totalTicks = 0;
+        uint64_t selfTicks = 0;
+    };
+    struct CallFrame
+    {
+        JenovaScriptProfiler::MethodID methodID;
+        uint64_t startTicks;
+        uint64_t childTicks;
+    };
+    struct ThreadTable
+    {
+        MethodCounters counters[jenova::GlobalSettings::ScriptProfilerMethodCapacity];
+        CallFrame callStack[jenova::GlobalSettings::ScriptProfilerMaxCallDepth];
+        size_t callDepth = 0;
+    };
+    struct ThreadTableLease
+    {
+        ThreadTable* threadTable = nullptr;
+        ~ThreadTableLease();
+    };
+
+    // Profiler State
+    static std::atomic<bool> isProfiling = false;
+    static std::mutex profilerMutex;
+    static std::vector<std::unique_ptr<ThreadTable>> threadTables;
+    static std::vector<ThreadTable*> freeThreadTables;
+    static std::unordered_map<std::string, JenovaScriptProfiler::MethodID> methodIDs;
+    static std::vector<StringName> methodSignatures;
+    static std::vector<MethodSnapshot> baselineSnapshot;
+    static std::vector<MethodSnapshot> frameSnapshot;
+    static std::vector<MethodSnapshot> frameData;
+    static std::chrono::steady_clock::time_point calibrationTime;
+    static uint64_t calibrationTicks = 0;
+    static double ticksPerMicrosecond = 1.0;
+    static thread_local ThreadTable* currentThreadTable = nullptr;
+    static thread_local ThreadTableLease threadTableLease;
+
+    // Utilities
+    static ThreadTable* AcquireThreadTable()
+    {
+        // Tables Of Exited Threads Are Reused, Counters Keep Accumulating So Snapshot Deltas Stay Valid
+        if (currentThreadTable) return currentThreadTable;
+        std::lock_guard<std::mutex> lock(profilerMutex);
+        if (!freeThreadTables.empty())
+        {
+            currentThreadTable = freeThreadTables.back();
+            freeThreadTables.pop_back();
+            currentThreadTable->callDepth = 0;
+        }
+        else
+        {
+            threadTables.push_back(std::make_unique<ThreadTable>());
+            currentThreadTable = threadTables.back().get();
+        }
+        threadTableLease.threadTable = currentThreadTable;
+        return currentThreadTable;
+    }
+    ThreadTableLease::~ThreadTableLease()
+    {
+        if (!threadTable) return;
+        std::lock_guard<std::mutex> lock(profilerMutex);
+        freeThreadTables.push_back(threadTable);
+        currentThreadTable = nullptr;
+    }
+    static void IncrementCounter(std::atomic<uint64_t>& counter, uint64_t value)
+    {
+        // Single Writer, Plain Load/Store Avoids Locked Read-Modify-Write
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+    static void TakeSnapshot(std::vector<MethodSnapshot>& snapshot)
+    {
+        snapshot.assign(methodSignatures.size(), MethodSnapshot());
+        for (const auto& threadTable : threadTables)
+        {
+            for (size_t i = 0; i < snapshot.size(); i++)
+            {
+                snapshot[i].callCount += threadTable->counters[i].callCount.load(std::memory_order_relaxed);
+                snapshot[i].totalTicks += threadTable->counters[i].totalTicks.load(std::memory_order_relaxed);
+                snapshot[i].selfTicks += threadTable->counters[i].selfTicks.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    static void UpdateCalibration()
+    {
+        double elapsedMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - calibrationTime).count();
+        uint64_t elapsedTicks = JenovaScriptProfiler::ReadTimestamp() - calibrationTicks;
+        if (elapsedMicroseconds > 1000.0 && elapsedTicks > 0) ticksPerMicrosecond = double(elapsedTicks) / elapsedMicroseconds;
+    }
+    static uint64_t TicksToMicroseconds(uint64_t ticks)
+    {
+        return uint64_t(double(ticks) / ticksPerMicrosecond);
+    }
+    static int32_t FillProfilingInfo(const std::vector<MethodSnapshot>& data, ScriptLanguageExtensionProfilingInfo* infoArray, int32_t infoMax)
+    {
+        int32_t infoCount = 0;
+        for (size_t i = 0; i < data.size() && infoCount < infoMax; i++)
+        {
+            if (data[i].callCount == 0) continue;
+            infoArray[infoCount].signature = methodSignatures[i];
+            infoArray[infoCount].call_count = data[i].callCount;
+            infoArray[infoCount].total_time = TicksToMicroseconds(data[i].totalTicks);
+            infoArray[infoCount].self_time = TicksToMicroseconds(data[i].selfTicks);
+            infoCount++;
+        }
+        return infoCount;
+    }
+}
+
+// Jenova Script Profiler Implementation
+using namespace jenova::profiler;
+void JenovaScriptProfiler::StartProfiling()
+{
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    calibrationTime = std::chrono::steady_clock::now();
+    calibrationTicks = ReadTimestamp();
+    TakeSnapshot(baselineSnapshot);
+    frameSnapshot = baselineSnapshot;
+    frameData.clear();
+    jenova::profiler::isProfiling.store(true, std::memory_order_release);
+}
+void JenovaScriptProfiler::StopProfiling()
+{
+    jenova::profiler::isProfiling.store(false, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    UpdateCalibration();
+}
+bool JenovaScriptProfiler::IsProfiling()
+{
+    return jenova::profiler::isProfiling.load(std::memory_order_relaxed);
+}
+JenovaScriptProfiler::MethodID JenovaScriptProfiler::RegisterMethod(const std::string& methodSignature)
+{
+    // Method IDs Stay Stable Across Module Reloads
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    auto methodIDIterator = methodIDs.find(methodSignature);
+    if (methodIDIterator != methodIDs.end()) return methodIDIterator->second;
+    if (methodSignatures.size() >= jenova::GlobalSettings::ScriptProfilerMethodCapacity) return InvalidMethodID;
+    MethodID methodID = MethodID(methodSignatures.size());
+    methodIDs[methodSignature] = methodID;
+    methodSignatures.push_back(StringName(methodSignature.c_str()));
+    return methodID;
+}
+bool JenovaScriptProfiler::BeginCall(MethodID methodID)
+{
+    if (methodID == InvalidMethodID || !IsProfiling()) return false;
+    ThreadTable* threadTable = AcquireThreadTable();
+    if (threadTable->callDepth >= jenova::GlobalSettings::ScriptProfilerMaxCallDepth) return false;
+    threadTable->callStack[threadTable->callDepth++] = CallFrame{ methodID, ReadTimestamp(), 0 };
+    return true;
+}
+void JenovaScriptProfiler::EndCall()
+{
+    uint64_t endTicks = ReadTimestamp();
+    ThreadTable* threadTable = currentThreadTable;
+    const CallFrame& callFrame = threadTable->callStack[--threadTable->callDepth];
+    uint64_t totalTicks = endTicks - callFrame.startTicks;
+    uint64_t selfTicks = totalTicks > callFrame.childTicks ? totalTicks - callFrame.childTicks : 0;
+    MethodCounters& methodCounters = threadTable->counters[callFrame.methodID];
+    IncrementCounter(methodCounters.callCount, 1);
+    IncrementCounter(methodCounters.totalTicks, totalTicks);
+    IncrementCounter(methodCounters.selfTicks, selfTicks);
+    if (threadTable->callDepth > 0) threadTable->callStack[threadTable->callDepth - 1].childTicks += totalTicks;
+}
+void JenovaScriptProfiler::CollectFrame()
+{
+    if (!IsProfiling()) return;
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    std::vector<MethodSnapshot> currentSnapshot;
+    TakeSnapshot(currentSnapshot);
+    frameData.assign(currentSnapshot.size(), MethodSnapshot());
+    for (size_t i = 0; i < currentSnapshot.size(); i++)
+    {
+        const MethodSnapshot previous = i < frameSnapshot.size() ? frameSnapshot[i] : MethodSnapshot();
+        frameData[i].callCount = currentSnapshot[i].callCount - previous.callCount;
+        frameData[i].totalTicks = currentSnapshot[i].totalTicks - previous.totalTicks;
+        frameData[i].selfTicks = currentSnapshot[i].selfTicks - previous.selfTicks;
+    }
+    frameSnapshot = std::move(currentSnapshot);
+    UpdateCalibration();
+}
+int32_t JenovaScriptProfiler::GetAccumulatedData(ScriptLanguageExtensionProfilingInfo* infoArray, int32_t infoMax)
+{
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    std::vector<MethodSnapshot> accumulatedData;
+    TakeSnapshot(accumulatedData);
+    UpdateCalibration();
+    for (size_t i = 0; i < accumulatedData.size() && i < baselineSnapshot.size(); i++)
+    {
+        accumulatedData[i].callCount -= baselineSnapshot[i].callCount;
+        accumulatedData[i].totalTicks -= baselineSnapshot[i].totalTicks;
+        accumulatedData[i].selfTicks -= baselineSnapshot[i].selfTicks;
+    }
+    return FillProfilingInfo(accumulatedData, infoArray, infoMax);
+}
+int32_t JenovaScriptProfiler::GetFrameData(ScriptLanguageExtensionProfilingInfo* infoArray, int32_t infoMax)
+{
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    return FillProfilingInfo(frameData, infoArray, infoMax);
+}
+String JenovaScriptProfiler::GetMethodSignature(MethodID methodID)
+{
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    if (methodID >= methodSignatures.size()) return String();
+    return String(methodSignatures[methodID]);
+}
+uint64_t JenovaScriptProfiler::ReadTimestamp()
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+// Jenova Runtime Counters Internal Storage
+namespace jenova::profiler
+{
+    // Log-Linear Latency Buckets : Exact Below 16 Ticks, Then 8 Sub-Buckets Per Power of Two
+    constexpr size_t LatencyLinearBuckets = 16;
+    constexpr size_t LatencySubBuckets = 8;
+    constexpr size_t LatencyBucketCount = LatencyLinearBuckets + (64 - 4) * LatencySubBuckets;
+    constexpr size_t RuntimeCounterCount = size_t(JenovaRuntimeCounters::Counter::CounterCount);
+
+    // Counters Are Only Written By Owner Thread
+    struct CounterBlock
+    {
+        std::atomic<uint64_t> counters[RuntimeCounterCount] = {};
+        std::atomic<uint64_t> callTicks = 0;
+        std::atomic<uint64_t> latencyBuckets[LatencyBucketCount] = {};
+    };
+    struct CounterBlockLease
+    {
+        CounterBlock* counterBlock = nullptr;
+        ~CounterBlockLease();
+    };
+    struct CounterTotals
+    {
+        uint64_t counters[RuntimeCounterCount] = {};
+        uint64_t callTicks = 0;
+        std::vector<uint64_t> latencyBuckets = std::vector<uint64_t>(LatencyBucketCount, 0);
+    };
+
+    // Counters State
+    static std::mutex counterBlocksMutex;
+    static std::vector<std::unique_ptr<CounterBlock>> counterBlocks;
+    static std::vector<CounterBlock*> freeCounterBlocks;
+    static thread_local CounterBlock* currentCounterBlock = nullptr;
+    static thread_local CounterBlockLease counterBlockLease;
+    static CounterTotals previousTotals;
+    static double monitorValues[size_t(JenovaRuntimeCounters::Monitor::MonitorCount)] = {};
+    static std::chrono::steady_clock::time_point counterCalibrationTime = std::chrono::steady_clock::now();
+    static uint64_t counterCalibrationTicks = JenovaScriptProfiler::ReadTimestamp();
+    static bool areMonitorsRegistered = false;
+
+    // Monitor Identifiers [Indexed By Monitor]
+    static constexpr const char* MonitorNames[] =
+    {
+        "Jenova/Script Calls",
+        "Jenova/Failed Calls",
+        "Jenova/Average Call Latency (us)",
+        "Jenova/P99 Call Latency (us)",
+        "Jenova/Properties Marshalled",
+        "Jenova/JIT Thunks Compiled",
+        "Jenova/Property Cache Hit Rate (%)",
+        "Jenova/Module Reloads",
+        "Jenova/Live Script Instances",
+        "Jenova/Module Memory (KB)",
+        "Jenova/Task Queue Depth",
+    };
+    static_assert(std::size(MonitorNames) == size_t(JenovaRuntimeCounters::Monitor::MonitorCount), "Monitor Names Must Match Monitor Enumeration.");
+
+    // Utilities
+    static CounterBlock* AcquireCounterBlock()
+    {
+        // Blocks Of Exited Threads Are Reused, Totals Are Cumulative So Nothing Is Reset
+        if (currentCounterBlock) return currentCounterBlock;
+        std::lock_guard<std::mutex> lock(counterBlocksMutex);
+        if (!freeCounterBlocks.empty())
+        {
+            currentCounterBlock = freeCounterBlocks.back();
+            freeCounterBlocks.pop_back();
+        }
+        else
+        {
+            counterBlocks.push_back(std::make_unique<CounterBlock>());
+            currentCounterBlock = counterBlocks.back().get();
+        }
+        counterBlockLease.counterBlock = currentCounterBlock;
+        return currentCounterBlock;
+    }
+    CounterBlockLease::~CounterBlockLease()
+    {
+        if (!counterBlock) return;
+        std::lock_guard<std::mutex> lock(counterBlocksMutex);
+        freeCounterBlocks.push_back(counterBlock);
+        currentCounterBlock = nullptr;
+    }
+    static size_t GetLatencyBucket(uint64_t ticks)
+    {
+        if (ticks < LatencyLinearBuckets) return size_t(ticks);
+        size_t exponent = 63 - size_t(std::countl_zero(ticks));
+        size_t subBucket = size_t(ticks >> (exponent - 3)) & (LatencySubBuckets - 1);
+        return LatencyLinearBuckets + (exponent - 4) * LatencySubBuckets + subBucket;
+    }
+    static uint64_t GetLatencyBucketUpperBound(size_t bucketIndex)
+    {
+        if (bucketIndex < LatencyLinearBuckets) return bucketIndex + 1;
+        size_t exponent = (bucketIndex - LatencyLinearBuckets) / LatencySubBuckets + 4;
+        size_t subBucket = (bucketIndex - LatencyLinearBuckets) % LatencySubBuckets;
+        return uint64_t(LatencySubBuckets + subBucket + 1) << (exponent - 3);
+    }
+}
+
+// Jenova Runtime Counters Implementation
+void JenovaRuntimeCounters::Increment(Counter counter, uint64_t value)
+{
+    IncrementCounter(AcquireCounterBlock()->counters[size_t(counter)], value);
+}
+void JenovaRuntimeCounters::RecordCall(uint64_t callTicks, bool isSucceeded)
+{
+    CounterBlock* counterBlock = AcquireCounterBlock();
+    IncrementCounter(counterBlock->counters[size_t(Counter::ScriptCalls)], 1);
+    if (!isSucceeded) IncrementCounter(counterBlock->counters[size_t(Counter::FailedCalls)], 1);
+    IncrementCounter(counterBlock->callTicks, callTicks);
+    IncrementCounter(counterBlock->latencyBuckets[GetLatencyBucket(callTicks)], 1);
+}
+void JenovaRuntimeCounters::CollectFrame()
+{
+    // Sum All Thread Blocks
+    CounterTotals currentTotals;
+    {
+        std::lock_guard<std::mutex> lock(counterBlocksMutex);
+        for (const auto& counterBlock : counterBlocks)
+        {
+            for (size_t i = 0; i < RuntimeCounterCount; i++) currentTotals.counters[i] += counterBlock->counters[i].load(std::memory_order_relaxed);
+            currentTotals.callTicks += counterBlock->callTicks.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < LatencyBucketCount; i++) currentTotals.latencyBuckets[i] += counterBlock->latencyBuckets[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    // Calibrate Timestamp Ticks Against Steady Clock
+    double elapsedMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - counterCalibrationTime).count();
+    uint64_t elapsedTicks = JenovaScriptProfiler::ReadTimestamp() - counterCalibrationTicks;
+    double ticksPerMicrosecond = elapsedMicroseconds > 1000.0 && elapsedTicks > 0 ? double(elapsedTicks) / elapsedMicroseconds : 1000.0;
+
+    // Frame Deltas
+    uint64_t frameCounters[RuntimeCounterCount];
+    for (size_t i = 0; i < RuntimeCounterCount; i++) frameCounters[i] = currentTotals.counters[i] - previousTotals.counters[i];
+    uint64_t frameCallTicks = currentTotals.callTicks - previousTotals.callTicks;
+    uint64_t frameCalls = frameCounters[size_t(Counter::ScriptCalls)];
+
+    // P99 From Frame Histogram
+    uint64_t p99Ticks = 0;
+    if (frameCalls != 0)
+    {
+        uint64_t p99Rank = frameCalls - frameCalls / 100, accumulatedCalls = 0;
+        for (size_t i = 0; i < LatencyBucketCount; i++)
+        {
+            accumulatedCalls += currentTotals.latencyBuckets[i] - previousTotals.latencyBuckets[i];
+            if (accumulatedCalls < p99Rank) continue;
+            p99Ticks = GetLatencyBucketUpperBound(i);
+            break;
+        }
+    }
+    previousTotals = std::move(currentTotals);
+
+    // Update Monitor Values
+    uint64_t propertyLookups = frameCounters[size_t(Counter::PropertyCacheHits)] + frameCounters[size_t(Counter::PropertyCacheMisses)];
+    monitorValues[size_t(Monitor::ScriptCalls)] = double(frameCalls);
+    monitorValues[size_t(Monitor::FailedCalls)] = double(frameCounters[size_t(Counter::FailedCalls)]);
+    monitorValues[size_t(Monitor::AverageCallLatency)] = frameCalls != 0 ? double(frameCallTicks) / double(frameCalls) / ticksPerMicrosecond : 0.0;
+    monitorValues[size_t(Monitor::P99CallLatency)] = double(p99Ticks) / ticksPerMicrosecond;
+    monitorValues[size_t(Monitor::PropertiesMarshalled)] = double(frameCounters[size_t(Counter::PropertiesMarshalled)]);
+    monitorValues[size_t(Monitor::ThunksCompiled)] = double(frameCounters[size_t(Counter::ThunksCompiled)]);
+    monitorValues[size_t(Monitor::PropertyCacheHitRate)] = propertyLookups != 0 ? double(frameCounters[size_t(Counter::PropertyCacheHits)]) * 100.0 / double(propertyLookups) : 100.0;
+    monitorValues[size_t(Monitor::ModuleReloads)] = double(previousTotals.counters[size_t(Counter::ModuleReloads)]);
+
+    // Sample Gauges
+    monitorValues[size_t(Monitor::LiveScriptInstances)] = JenovaScriptManager::get_singleton() ? double(JenovaScriptManager::get_singleton()->get_script_instance_count()) : 0.0;
+    monitorValues[size_t(Monitor::ModuleMemoryFootprint)] = double(JenovaInterpreter::GetModuleMemoryFootprint()) / 1024.0;
+    monitorValues[size_t(Monitor::TaskQueueDepth)] = double(JenovaTaskSystem::GetPendingTaskCount());
+}
+double JenovaRuntimeCounters::GetMonitorValue(Monitor monitor)
+{
+    if (monitor >= Monitor::MonitorCount) return 0.0;
+    return monitorValues[size_t(monitor)];
+}
+bool JenovaRuntimeCounters::RegisterMonitors()
+{
+    Performance* performance = Performance::get_singleton();
+    if (!performance || areMonitorsRegistered) return false;
+    for (uint32_t i = 0; i < uint32_t(Monitor::MonitorCount); i++)
+    {
+        if (performance->has_custom_monitor(MonitorNames[i])) continue;
+        Array monitorArguments;
+        monitorArguments.push_back(i);
+        performance->add_custom_monitor(MonitorNames[i], callable_mp_static(&JenovaRuntimeCounters::QueryMonitor), monitorArguments);
+    }
+    areMonitorsRegistered = true;
+    return true;
+}
+void JenovaRuntimeCounters::UnregisterMonitors()
+{
+    Performance* performance = Performance::get_singleton();
+    if (!performance || !areMonitorsRegistered) return;
+    for (uint32_t i = 0; i < uint32_t(Monitor::MonitorCount); i++)
+    {
+        if (performance->has_custom_monitor(MonitorNames[i])) performance->remove_custom_monitor(MonitorNames[i]);
+    }
+    areMonitorsRegistered = false;
+}
+Variant JenovaRuntimeCounters::QueryMonitor(uint32_t monitorIndex)
+{
+    return GetMonitorValue(Monitor(monitorIndex));
+}
+
+// Jenova Frame Budget Internal Storage
+namespace jenova::profiler
+{
+    // Structures
+    struct CallbackTiming
+    {
+        std::string callbackName;
+        int64_t frameTime = 0;
+        int64_t lastFrameTime = 0;
+        int64_t totalTime = 0;
+        int64_t maxTime = 0;
+        uint64_t frameCount = 0;
+    };
+    struct MethodFrameTime
+    {
+        std::atomic<uint64_t> frameIndex = UINT64_MAX;
+        std::atomic<int64_t> frameTime = 0;
+    };
+    struct FrameSample
+    {
+        double frameTime = 0.0;
+        double jenovaTime = 0.0;
+    };
+
+    // Histogram Bucket Upper Bounds [Milliseconds]
+    static constexpr double FrameBucketBounds[] = { 0.1, 0.25, 0.5, 1.0, 2.0, 4.0, 8.0, 16.0, 33.0, 66.0, DBL_MAX };
+    static constexpr size_t FrameBucketCount = sizeof(FrameBucketBounds) / sizeof(FrameBucketBounds[0]);
+
+    // Runtime Event Names [Must Match jenova::sdk::RuntimeEvent]
+    static constexpr const char* RuntimeEventNames[] =
+    {
+        "Initialized", "Started", "Stopped", "Ready", "EnterTree", "ExitTree", "FrameBegin",
+        "FrameIdle", "FrameEnd", "FramePresent", "Process", "PhysicsProcess", "ReceivedDebuggerMessage"
+    };
+
+    // Frame Budget State
+    static std::atomic<double> frameBudget = 0.0;
+    static std::atomic<bool> isBudgetEnabled = false;
+    static std::atomic<uint64_t> currentFrameIndex = 0;
+    static std::atomic<int64_t> frameScriptTime = 0;
+    static int64_t frameStartTime = 0;
+    static int64_t frameCallbackTime = 0;
+    static int64_t lastWarningTime = 0;
+    static uint64_t recordedFrameCount = 0;
+    static uint64_t totalAlarmCount = 0;
+    static std::mutex frameBudgetMutex;
+    static std::unordered_map<uint64_t, CallbackTiming> callbackTimings;
+    static std::unique_ptr<MethodFrameTime[]> methodFrameTimes;
+    static std::vector<FrameSample> frameHistory;
+    static std::vector<JenovaFrameBudget::BudgetAlarm> alarmHistory;
+    static thread_local size_t methodCallDepth = 0;
+
+    // Utilities
+    static double NanosecondsToMilliseconds(int64_t nanoseconds)
+    {
+        return double(nanoseconds) / 1000000.0;
+    }
+    static size_t GetFrameBucket(double milliseconds)
+    {
+        size_t bucketIndex = 0;
+        while (bucketIndex < FrameBucketCount - 1 && milliseconds > FrameBucketBounds[bucketIndex]) bucketIndex++;
+        return bucketIndex;
+    }
+    static double GetPercentile(const std::vector<double>& sortedValues, double percentile)
+    {
+        if (sortedValues.empty()) return 0.0;
+        size_t rank = size_t(percentile * double(sortedValues.size() - 1) + 0.5);
+        return sortedValues[std::min(rank, sortedValues.size() - 1)];
+    }
+    static Dictionary CreateDistribution(std::vector<double> values)
+    {
+        Array histogram;
+        histogram.resize(FrameBucketCount);
+        for (size_t i = 0; i < FrameBucketCount; i++) histogram[i] = 0;
+        for (double value : values)
+        {
+            size_t bucketIndex = GetFrameBucket(value);
+            histogram[bucketIndex] = int64_t(histogram[bucketIndex]) + 1;
+        }
+        std::sort(values.begin(), values.end());
+        Dictionary distribution;
+        distribution["Histogram"] = histogram;
+        distribution["P50"] = GetPercentile(values, 0.50);
+        distribution["P95"] = GetPercentile(values, 0.95);
+        distribution["P99"] = GetPercentile(values, 0.99);
+        distribution["Max"] = values.empty() ? 0.0 : values.back();
+        return distribution;
+    }
+}
+
+// Jenova Frame Budget Implementation
+void JenovaFrameBudget::SetFrameBudget(double budgetMilliseconds)
+{
+    std::lock_guard<std::mutex> lock(frameBudgetMutex);
+    if (budgetMilliseconds > 0.0 && !methodFrameTimes) methodFrameTimes = std::make_unique<MethodFrameTime[]>(jenova::GlobalSettings::ScriptProfilerMethodCapacity);
+    frameBudget.store(std::max(budgetMilliseconds, 0.0), std::memory_order_relaxed);
+    isBudgetEnabled.store(budgetMilliseconds > 0.0, std::memory_order_release);
+}
+double JenovaFrameBudget::GetFrameBudget()
+{
+    return frameBudget.load(std::memory_order_relaxed);
+}
+bool JenovaFrameBudget::IsEnabled()
+{
+    return isBudgetEnabled.load(std::memory_order_relaxed);
+}
+void JenovaFrameBudget::BeginFrame()
+{
+    if (!IsEnabled()) return;
+    frameStartTime = JenovaTinyProfiler::ReadClock();
+}
+void JenovaFrameBudget::RecordCallback(const void* callbackAddress, uint32_t runtimeEvent, int64_t elapsedTime)
+{
+    // Key Combines Callback Address And Event, Same Callback Is Reported Per Event
+    uint64_t callbackKey = uint64_t(uintptr_t(callbackAddress)) ^ (uint64_t(runtimeEvent) << 56);
+    std::lock_guard<std::mutex> lock(frameBudgetMutex);
+    CallbackTiming& callbackTiming = callbackTimings[callbackKey];
+    if (callbackTiming.callbackName.empty()) callbackTiming.callbackName = ResolveCallbackName(callbackAddress, runtimeEvent);
+    callbackTiming.frameTime += elapsedTime;
+    frameCallbackTime += elapsedTime;
+}
+int64_t JenovaFrameBudget::EnterMethod()
+{
+    methodCallDepth++;
+    return JenovaTinyProfiler::ReadClock();
+}
+void JenovaFrameBudget::LeaveMethod(JenovaScriptProfiler::MethodID methodID, int64_t startTime)
+{
+    int64_t elapsedTime = JenovaTinyProfiler::ReadClock() - startTime;
+
+    // Only Outermost Calls Count Towards Jenova Time, Nested Calls Are Already Included
+    if (--methodCallDepth == 0) frameScriptTime.fetch_add(elapsedTime, std::memory_order_relaxed);
+
+    // Inclusive Time Per Method, Reset Lazily On First Call Of Each Frame
+    if (methodID == JenovaScriptProfiler::InvalidMethodID || !methodFrameTimes) return;
+    MethodFrameTime& methodFrameTime = methodFrameTimes[methodID];
+    uint64_t frameIndex = currentFrameIndex.load(std::memory_order_relaxed);
+    uint64_t recordedFrame = methodFrameTime.frameIndex.load(std::memory_order_relaxed);
+    if (recordedFrame != frameIndex && methodFrameTime.frameIndex.compare_exchange_strong(recordedFrame, frameIndex, std::memory_order_relaxed))
+    {
+        methodFrameTime.frameTime.store(elapsedTime, std::memory_order_relaxed);
+        return;
+    }
+    methodFrameTime.frameTime.fetch_add(elapsedTime, std::memory_order_relaxed);
+}
+void JenovaFrameBudget::EndFrame()
+{
+    if (!IsEnabled() || frameStartTime == 0) return;
+    int64_t now = JenovaTinyProfiler::ReadClock();
+    uint64_t frameIndex = currentFrameIndex.load(std::memory_order_relaxed);
+    BudgetAlarm budgetAlarm;
+    bool isBudgetExceeded = false;
+    {
+        std::lock_guard<std::mutex> lock(frameBudgetMutex);
+
+        // Measure Frame
+        int64_t scriptTime = frameScriptTime.exchange(0, std::memory_order_relaxed);
+        FrameSample frameSample{ NanosecondsToMilliseconds(now - frameStartTime), NanosecondsToMilliseconds(frameCallbackTime + scriptTime) };
+        if (frameHistory.size() < jenova::GlobalSettings::FrameBudgetHistorySize) frameHistory.push_back(frameSample);
+        else frameHistory[recordedFrameCount % jenova::GlobalSettings::FrameBudgetHistorySize] = frameSample;
+        recordedFrameCount++;
+
+        // Update Callback Statistics And Find Largest Callback
+        const CallbackTiming* slowestCallback = nullptr;
+        for (auto& [callbackKey, callbackTiming] : callbackTimings)
+        {
+            callbackTiming.lastFrameTime = callbackTiming.frameTime;
+            if (callbackTiming.frameTime == 0) continue;
+            callbackTiming.totalTime += callbackTiming.frameTime;
+            callbackTiming.maxTime = std::max(callbackTiming.maxTime, callbackTiming.frameTime);
+            callbackTiming.frameCount++;
+            callbackTiming.frameTime = 0;
+            if (!slowestCallback || callbackTiming.lastFrameTime > slowestCallback->lastFrameTime) slowestCallback = &callbackTiming;
+        }
+        frameCallbackTime = 0;
+
+        // Check Budget
+        isBudgetExceeded = frameSample.jenovaTime > GetFrameBudget();
+        if (isBudgetExceeded)
+        {
+            budgetAlarm.frameIndex = frameIndex;
+            budgetAlarm.frameTime = frameSample.frameTime;
+            budgetAlarm.jenovaTime = frameSample.jenovaTime;
+            if (slowestCallback)
+            {
+                budgetAlarm.offenderName = slowestCallback->callbackName;
+                budgetAlarm.offenderTime = NanosecondsToMilliseconds(slowestCallback->lastFrameTime);
+            }
+
+            // Slowest Script Method [Inclusive Time]
+            JenovaScriptProfiler::MethodID slowestMethod = JenovaScriptProfiler::InvalidMethodID;
+            int64_t slowestMethodTime = 0;
+            for (size_t i = 0; methodFrameTimes && i < jenova::GlobalSettings::ScriptProfilerMethodCapacity; i++)
+            {
+                if (methodFrameTimes[i].frameIndex.load(std::memory_order_relaxed) != frameIndex) continue;
+                int64_t methodTime = methodFrameTimes[i].frameTime.load(std::memory_order_relaxed);
+                if (methodTime > slowestMethodTime) { slowestMethodTime = methodTime; slowestMethod = JenovaScriptProfiler::MethodID(i); }
+            }
+            if (slowestMethod != JenovaScriptProfiler::InvalidMethodID && NanosecondsToMilliseconds(slowestMethodTime) > budgetAlarm.offenderTime)
+            {
+                budgetAlarm.offenderName = AS_STD_STRING(JenovaScriptProfiler::GetMethodSignature(slowestMethod));
+                budgetAlarm.offenderTime = NanosecondsToMilliseconds(slowestMethodTime);
+            }
+
+            // Store Alarm
+            if (alarmHistory.size() < jenova::GlobalSettings::FrameBudgetAlarmHistory) alarmHistory.push_back(budgetAlarm);
+            else alarmHistory[totalAlarmCount % jenova::GlobalSettings::FrameBudgetAlarmHistory] = budgetAlarm;
+            totalAlarmCount++;
+        }
+    }
+
+    // Advance Frame, Method Times Of Previous Frame Become Stale
+    currentFrameIndex.fetch_add(1, std::memory_order_relaxed);
+    frameStartTime = 0;
+    if (isBudgetExceeded) RaiseAlarm(budgetAlarm);
+}
+Dictionary JenovaFrameBudget::GetFrameTimingReport()
+{
+    std::lock_guard<std::mutex> lock(frameBudgetMutex);
+
+    // Frame Distributions
+    std::vector<double> frameTimes, jenovaTimes;
+    for (const FrameSample& frameSample : frameHistory)
+    {
+        frameTimes.push_back(frameSample.frameTime);
+        jenovaTimes.push_back(frameSample.jenovaTime);
+    }
+    Array bucketBounds;
+    for (size_t i = 0; i < FrameBucketCount; i++) bucketBounds.push_back(FrameBucketBounds[i] == DBL_MAX ? INFINITY : FrameBucketBounds[i]);
+
+    // Callback Statistics
+    Array callbacks;
+    for (const auto& [callbackKey, callbackTiming] : callbackTimings)
+    {
+        Dictionary callbackReport;
+        callbackReport["Name"] = String(callbackTiming.callbackName.c_str());
+        callbackReport["LastFrameTime"] = NanosecondsToMilliseconds(callbackTiming.lastFrameTime);
+        callbackReport["AverageTime"] = callbackTiming.frameCount != 0 ? NanosecondsToMilliseconds(callbackTiming.totalTime) / double(callbackTiming.frameCount) : 0.0;
+        callbackReport["MaxTime"] = NanosecondsToMilliseconds(callbackTiming.maxTime);
+        callbacks.push_back(callbackReport);
+    }
+
+    // Recent Alarms [Oldest First]
+    Array alarms;
+    size_t alarmStart = alarmHistory.size() < jenova::GlobalSettings::FrameBudgetAlarmHistory ? 0 : totalAlarmCount % jenova::GlobalSettings::FrameBudgetAlarmHistory;
+    for (size_t i = 0; i < alarmHistory.size(); i++)
+    {
+        const BudgetAlarm& budgetAlarm = alarmHistory[(alarmStart + i) % alarmHistory.size()];
+        Dictionary alarmReport;
+        alarmReport["Frame"] = int64_t(budgetAlarm.frameIndex);
+        alarmReport["FrameTime"] = budgetAlarm.frameTime;
+        alarmReport["JenovaTime"] = budgetAlarm.jenovaTime;
+        alarmReport["Offender"] = String(budgetAlarm.offenderName.c_str());
+        alarmReport["OffenderTime"] = budgetAlarm.offenderTime;
+        alarms.push_back(alarmReport);
+    }
+
+    // Create Report
+    Dictionary timingReport;
+    timingReport["FrameBudget"] = GetFrameBudget();
+    timingReport["FrameCount"] = int64_t(frameHistory.size());
+    timingReport["AlarmCount"] = int64_t(totalAlarmCount);
+    timingReport["BucketBounds"] = bucketBounds;
+    timingReport["FrameTime"] = CreateDistribution(std::move(frameTimes));
+    timingReport["JenovaTime"] = CreateDistribution(std::move(jenovaTimes));
+    timingReport["Callbacks"] = callbacks;
+    timingReport["Alarms"] = alarms;
+    return timingReport;
+}
+std::string JenovaFrameBudget::ResolveCallbackName(const void* callbackAddress, uint32_t runtimeEvent)
+{
+    std::string callbackName;
+    #ifdef TARGET_PLATFORM_LINUX
+    Dl_info symbolInfo;
+    if (dladdr(callbackAddress, &symbolInfo) && symbolInfo.dli_sname)
+    {
+        int status = 0;
+        char* demangledName = abi::__cxa_demangle(symbolInfo.dli_sname, nullptr, nullptr, &status);
+        callbackName = (status == 0 && demangledName) ? demangledName : symbolInfo.dli_sname;
+        free(demangledName);
+    }
+    #endif
+    if (callbackName.empty()) callbackName = jenova::Format("RuntimeCallback@%p", callbackAddress);
+    const char* eventName = runtimeEvent < std::size(RuntimeEventNames) ? RuntimeEventNames[runtimeEvent] : "Unknown";
+    return callbackName + " [" + eventName + "]";
+}
+void JenovaFrameBudget::RaiseAlarm(const BudgetAlarm& budgetAlarm)
+{
+    // Rate Limited Warning
+    int64_t now = JenovaTinyProfiler::ReadClock();
+    if (now - lastWarningTime >= int64_t(jenova::GlobalSettings::FrameBudgetWarningCooldown) * 1000000)
+    {
+        lastWarningTime = now;
+        jenova::Warning("Jenova Frame Budget", "Frame %llu Exceeded Budget : Jenova Time %.3fms of %.3fms (Frame %.3fms), Largest Offender '%s' Took %.3fms.",
+            (unsigned long long)budgetAlarm.frameIndex, budgetAlarm.jenovaTime, GetFrameBudget(), budgetAlarm.frameTime,
+            budgetAlarm.offenderName.empty() ? "Unknown" : budgetAlarm.offenderName.c_str(), budgetAlarm.offenderTime);
+    }
+
+    // Notify Debugger In Debug Sessions
+    EngineDebugger* engineDebugger = EngineDebugger::get_singleton();
+    if (engineDebugger && engineDebugger->is_active())
+    {
+        Array alarmData;
+        alarmData.push_back(int64_t(budgetAlarm.frameIndex));
+        alarmData.push_back(budgetAlarm.frameTime);
+        alarmData.push_back(budgetAlarm.jenovaTime);
+        alarmData.push_back(String(budgetAlarm.offenderName.c_str()));
+        alarmData.push_back(budgetAlarm.offenderTime);
+        engineDebugger->send_message("jenova:frame_budget_exceeded", alarmData);
+    }
+}
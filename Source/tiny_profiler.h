@@ -16,16 +16,245 @@
 // Jenova SDK
 #include "Jenova.hpp"
 
+// Jenova Tiny Profiler Macros
+#define JENOVA_PROFILER_CONCAT_IMPL(a, b) a##b
+#define JENOVA_PROFILER_CONCAT(a, b) JENOVA_PROFILER_CONCAT_IMPL(a, b)
+#define JENOVA_PROFILE_SCOPE(scopeName) JenovaTinyProfiler::ScopedTimer JENOVA_PROFILER_CONCAT(profilerScope, __LINE__) \
+    (std::integral_constant<uint64_t, JenovaTinyProfiler::HashScopeName(scopeName)>::value, scopeName)
+
 // Jenova Tiny Profiler Definition
+/*
+    Scopes Are Identified By Compile-Time Hashed Names And Recorded As Begin/End Events Into
+    Per-Thread Single Producer Ring Buffers, Recording A Scope Never Locks Or Allocates.
+    CollectFrame Drains All Buffers And Aggregates Events Into Per-Frame Scope Statistics.
+    Checkpoint API Is Kept As A Thin Thread-Safe Wrapper Keyed By Hashed Names.
+    While Trace Recording Is Active Drained Events Are Also Kept And Written As Chrome Trace JSON.
+*/
 class JenovaTinyProfiler
 {
 public:
-    static void CreateCheckpoint(const std::string& checkPointName);
-    static double GetCheckpointTime(const std::string& checkPointName);
-    static void DeleteCheckpoint(const std::string& checkPointName);
-    static double GetCheckpointTimeAndRestart(const std::string& checkPointName);
-    static double GetCheckpointTimeAndDispose(const std::string& checkPointName);
+    typedef uint64_t ScopeHash;
+    enum class EventType : uint8_t { Begin, End };
+
+    // Profiler Structures
+    struct ProfilerEvent
+    {
+        ScopeHash scopeHash;
+        const char* scopeName;
+        int64_t timestamp;
+        uint32_t depth;
+        EventType eventType;
+    };
+    struct ScopeStatistics
+    {
+        ScopeHash scopeHash;
+        const char* scopeName;
+        uint32_t depth;
+        uint64_t callCount;
+        double totalTime;
+        double minTime;
+        double maxTime;
+    };
+    struct ScopedTimer
+    {
+        ScopeHash scopeHash;
+        const char* scopeName;
+        bool isRecording;
+        ScopedTimer(ScopeHash hash, const char* name) : scopeHash(hash), scopeName(name), isRecording(JenovaTinyProfiler::BeginScope(hash, name)) {}
+        ScopedTimer(const char* name) : ScopedTimer(JenovaTinyProfiler::HashScopeName(name), name) {}
+        ~ScopedTimer() { Stop(); }
+        void Stop() { if (isRecording) JenovaTinyProfiler::EndScope(scopeHash, scopeName); isRecording = false; }
+    };
+
+public:
+    // Scope Hashing [FNV-1a, ASCII Names Hash Equally As Narrow And Wide Strings]
+    static constexpr ScopeHash HashScopeName(const char* scopeName)
+    {
+        ScopeHash scopeHash = 14695981039346656037ull;
+        while (*scopeName) { scopeHash ^= ScopeHash(uint8_t(*scopeName++)); scopeHash *= 1099511628211ull; }
+        return scopeHash;
+    }
+    template <typename CharType> static constexpr ScopeHash HashScopeName(const CharType* scopeName, size_t nameLength)
+    {
+        ScopeHash scopeHash = 14695981039346656037ull;
+        for (size_t i = 0; i < nameLength; i++) { scopeHash ^= ScopeHash(scopeName[i]); scopeHash *= 1099511628211ull; }
+        return scopeHash;
+    }
+
+    // Scoped Events
+    static void SetScopeRecording(bool recordingState);
+    static bool IsScopeRecording();
+    static bool BeginScope(ScopeHash scopeHash, const char* scopeName);
+    static void EndScope(ScopeHash scopeHash, const char* scopeName);
+    static void CollectFrame();
+    static std::vector<ScopeStatistics> GetFrameStatistics();
+    static size_t GetDroppedEventCount();
+    static int64_t ReadClock();
+
+    // Trace Recording [Chrome Trace Event Format]
+    static void StartTraceRecording(size_t ringCapacity = 0);
+    static bool StopTraceRecording(const std::string& traceFilePath);
+    static bool IsTraceRecording();
+    static const char* InternScopeName(const std::string& scopeName);
+
+    // Checkpoints
+    static void CreateCheckpoint(ScopeHash checkPointHash);
+    static double GetCheckpointTime(ScopeHash checkPointHash);
+    static void DeleteCheckpoint(ScopeHash checkPointHash);
+    static double GetCheckpointTimeAndRestart(ScopeHash checkPointHash);
+    static double GetCheckpointTimeAndDispose(ScopeHash checkPointHash);
+    static void CreateCheckpoint(const char* checkPointName);
+    static double GetCheckpointTime(const char* checkPointName);
+    static void DeleteCheckpoint(const char* checkPointName);
+    static double GetCheckpointTimeAndRestart(const char* checkPointName);
+    static double GetCheckpointTimeAndDispose(const char* checkPointName);
+
+private:
+    inline static std::mutex checkpointsMutex;
+    inline static std::unordered_map<ScopeHash, int64_t> checkpoints;
+};
+
+// Jenova Script Profiler Definition
+/*
+    Collects Per-Method Call Counts And Self/Total Time For C++ Scripts.
+    Calls Are Timed Using The Time Stamp Counter And Recorded Into Thread Local Counter Tables
+    Indexed By Method ID, Aggregation Only Happens When Godot Requests Profiling Data.
+    Overhead Budget : ScriptProfilerOverheadBudget (Microseconds) Per Profiled Call While Active,
+    A Single Relaxed Atomic Load Per Call While Inactive.
+*/
+class JenovaScriptProfiler
+{
+public:
+    typedef uint32_t MethodID;
+    static constexpr MethodID InvalidMethodID = UINT32_MAX;
+
+    // Scoped Call Recorder
+    struct ScopedCall
+    {
+        bool isRecording;
+        ScopedCall(MethodID methodID) : isRecording(JenovaScriptProfiler::BeginCall(methodID)) {}
+        ~ScopedCall() { if (isRecording) JenovaScriptProfiler::EndCall(); }
+    };
+
+public:
+    static void StartProfiling();
+    static void StopProfiling();
+    static bool IsProfiling();
+    static MethodID RegisterMethod(const std::string& methodSignature);
+    static bool BeginCall(MethodID methodID);
+    static void EndCall();
+    static void CollectFrame();
+    static int32_t GetAccumulatedData(ScriptLanguageExtensionProfilingInfo* infoArray, int32_t infoMax);
+    static int32_t GetFrameData(ScriptLanguageExtensionProfilingInfo* infoArray, int32_t infoMax);
+    static String GetMethodSignature(MethodID methodID);
+    static uint64_t ReadTimestamp();
+};
+
+// Jenova Runtime Counters Definition
+/*
+    Always-On Runtime Counters Exposed As Godot Performance Custom Monitors (Jenova/...).
+    Each Thread Increments Its Own Counter Block And Call Latency Histogram, No Locks Or Atomic Read-Modify-Write.
+    CollectFrame Runs Once Per Frame From JenovaRuntime::OnFrameEnd, Sums All Blocks Into Per-Frame Deltas,
+    Derives Average/P99 Call Latency And Samples Gauges (Instances, Module Memory, Pending Tasks).
+    Monitors Only Read The Values Aggregated By The Last CollectFrame.
+*/
+class JenovaRuntimeCounters
+{
+public:
+    enum class Counter : uint32_t
+    {
+        ScriptCalls,
+        FailedCalls,
+        PropertiesMarshalled,
+        ThunksCompiled,
+        PropertyCacheHits,
+        PropertyCacheMisses,
+        ModuleReloads,
+        CounterCount
+    };
+    enum class Monitor : uint32_t
+    {
+        ScriptCalls,
+        FailedCalls,
+        AverageCallLatency,
+        P99CallLatency,
+        PropertiesMarshalled,
+        ThunksCompiled,
+        PropertyCacheHitRate,
+        ModuleReloads,
+        LiveScriptInstances,
+        ModuleMemoryFootprint,
+        TaskQueueDepth,
+        MonitorCount
+    };
+
+    // Scoped Call Recorder [Counts Call And Records Latency, Failed Unless Marked Succeeded]
+    struct ScopedCallTimer
+    {
+        uint64_t startTicks;
+        bool isSucceeded = false;
+        ScopedCallTimer() : startTicks(JenovaScriptProfiler::ReadTimestamp()) {}
+        ~ScopedCallTimer() { JenovaRuntimeCounters::RecordCall(JenovaScriptProfiler::ReadTimestamp() - startTicks, isSucceeded); }
+        void MarkSucceeded() { isSucceeded = true; }
+    };
+
+public:
+    static void Increment(Counter counter, uint64_t value = 1);
+    static void RecordCall(uint64_t callTicks, bool isSucceeded);
+    static void CollectFrame();
+    static double GetMonitorValue(Monitor monitor);
+    static bool RegisterMonitors();
+    static void UnregisterMonitors();
+
+private:
+    static Variant QueryMonitor(uint32_t monitorIndex);
+};
+
+// Jenova Frame Budget Definition
+/*
+    When A Frame Budget Is Set, Every Runtime Event Callback And Script Method Call Is Timed Per Frame.
+    At Frame End The Jenova Time (Callbacks + Outermost Script Calls) Is Compared Against The Budget,
+    Overruns Record Their Largest Offender, Raise A Rate-Limited Warning And Notify The Debugger In Debug Sessions.
+    The Last Frames Are Kept In A Rolling Window Reported As Histograms Through The SDK.
+*/
+class JenovaFrameBudget
+{
+public:
+    // Budget Structures
+    struct BudgetAlarm
+    {
+        uint64_t frameIndex = 0;
+        double frameTime = 0.0;
+        double jenovaTime = 0.0;
+        std::string offenderName;
+        double offenderTime = 0.0;
+    };
+
+    // Scoped Script Method Timer [Only Active While A Budget Is Set]
+    struct ScopedMethodTimer
+    {
+        JenovaScriptProfiler::MethodID methodID;
+        int64_t startTime;
+        bool isTiming;
+        ScopedMethodTimer(JenovaScriptProfiler::MethodID id) : methodID(id), startTime(0), isTiming(JenovaFrameBudget::IsEnabled())
+        {
+            if (isTiming) startTime = JenovaFrameBudget::EnterMethod();
+        }
+        ~ScopedMethodTimer() { if (isTiming) JenovaFrameBudget::LeaveMethod(methodID, startTime); }
+    };
+
+public:
+    static void SetFrameBudget(double budgetMilliseconds);
+    static double GetFrameBudget();
+    static bool IsEnabled();
+    static void BeginFrame();
+    static void RecordCallback(const void* callbackAddress, uint32_t runtimeEvent, int64_t elapsedTime);
+    static int64_t EnterMethod();
+    static void LeaveMethod(JenovaScriptProfiler::MethodID methodID, int64_t startTime);
+    static void EndFrame();
+    static Dictionary GetFrameTimingReport();
 
 private:
-    inline static std::unordered_map<std::string, std::chrono::high_resolution_clock::time_point> checkpoints;
-};
\ No newline at end of file
+    static std::string ResolveCallbackName(const void* callbackAddress, uint32_t runtimeEvent);
+    static void RaiseAlarm(const BudgetAlarm& budgetAlarm);
+};